@@ -0,0 +1,613 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_BTREE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_BTREE_H_
+
+#include <cstddef>      // для std::size_t
+#include <cstdint>      // для SIZE_MAX
+#include <functional>   // для std::less
+#include <new>          // для placement new
+#include <type_traits>  // для std::conditional, std::is_arithmetic
+#include <utility>      // для std::pair, std::swap, std::forward
+
+#include "iterator_btree.h"
+#include "memory_report.h"
+#include "node_btree.h"
+
+namespace s21 {
+// B-дерево для btree_map/btree_set/btree_multiset. В отличие от RBTree,
+// где на каждый ключ свой узел и поиск - цепочка промахов кэша, здесь узел
+// занимает около kNodeBytes байт (несколько кэш-линий) и хранит десятки
+// ключей подряд, так что высота дерева в разы меньше, а внутри узла поиск -
+// линейный просмотр. Для арифметических ключей со std::less просмотр без
+// ветвлений (число ключей меньше искомого), его компилятор векторизует.
+// Mapped = BTreeNoValue - множество, Multi - разрешены равные ключи (новый
+// встаёт после равных). Все изменения делают итераторы недействительными:
+// элементы переезжают между узлами при разделении и слиянии.
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+class BTree {
+ public:
+  static constexpr bool kIsSet = std::is_same<Mapped, BTreeNoValue>::value;
+  static constexpr std::size_t kNodeBytes = 256;
+  static constexpr std::size_t kSlotBytes =
+      sizeof(Key) + (kIsSet ? 0 : sizeof(Mapped));
+  static constexpr std::size_t kSlots =
+      kNodeBytes / kSlotBytes > 3 ? kNodeBytes / kSlotBytes : 3;
+  static constexpr std::size_t kMinSlots = kSlots / 2;
+
+  using key_type = Key;
+  using size_type = std::size_t;
+  using Node = BTreeNode<Key, Mapped, kSlots>;
+  using InternalNode = BTreeInternalNode<Key, Mapped, kSlots>;
+  using iterator = BTreeIterator<
+      Node, typename std::conditional<kIsSet, void, Mapped>::type>;
+  using const_iterator = BTreeIterator<
+      Node, typename std::conditional<kIsSet, void, const Mapped>::type>;
+
+  BTree() {}
+  BTree(const BTree &other);
+  BTree(BTree &&other);
+  ~BTree();
+  BTree &operator=(const BTree &other);
+  BTree &operator=(BTree &&other);
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // обходит все узлы: незанятые ячейки узлов - slack, у множеств туда же
+  // идёт массив values_ из заглушек
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void clear();
+  void swap(BTree &other);
+
+  iterator find(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+  size_type count(const key_type &key) const;
+
+  // вставка ключа со значением, построенным из args; для уникальных
+  // ключей при совпадении ничего не вставляется: {найденный, false}
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(K &&key, Args &&...args);
+  void erase_at(iterator pos);
+
+ protected:
+  Node *root_{nullptr};
+  size_type size_{0};
+  Compare comp_{};
+
+ private:
+  // узлов не больше, чем уровней (не выше 64 при минимум двух детях) плюс
+  // новый корень
+  static constexpr std::size_t kMaxHeight = 65;
+  static constexpr bool kCountScan =
+      std::is_arithmetic<Key>::value &&
+      std::is_same<Compare, std::less<Key>>::value;
+
+  unsigned lower_in(const Node *node, const key_type &key) const;
+  unsigned upper_in(const Node *node, const key_type &key) const;
+
+  static Node *new_node(bool leaf);
+  static void free_node(Node *node);
+  static void destroy_subtree(Node *node);
+  static Node *clone(const Node *src, Node *parent, unsigned position);
+  static void transfer(Node *dst, unsigned di, Node *src, unsigned si);
+  static void destroy_slot(Node *node, unsigned i);
+  static void set_child(Node *parent, unsigned i, Node *child);
+  static void report_subtree(const Node *node, MemoryReport &report);
+
+  void split(Node *node, Node **spare, Node *&track, unsigned &track_pos);
+  void rebalance(Node *node);
+  void rotate_right(Node *left, Node *node, unsigned sep);
+  void rotate_left(Node *node, Node *right, unsigned sep);
+  void merge_nodes(Node *left, Node *right, unsigned sep);
+};
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+BTree<Key, Mapped, Compare, Multi>::BTree(const BTree &other)
+    : size_(other.size_), comp_(other.comp_) {
+  if (other.root_) root_ = clone(other.root_, nullptr, 0);
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+BTree<Key, Mapped, Compare, Multi>::BTree(BTree &&other) {
+  swap(other);
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+BTree<Key, Mapped, Compare, Multi>::~BTree() {
+  destroy_subtree(root_);
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+BTree<Key, Mapped, Compare, Multi> &
+BTree<Key, Mapped, Compare, Multi>::operator=(const BTree &other) {
+  if (this != &other) {
+    BTree tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+BTree<Key, Mapped, Compare, Multi> &
+BTree<Key, Mapped, Compare, Multi>::operator=(BTree &&other) {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::iterator
+BTree<Key, Mapped, Compare, Multi>::begin() const {
+  Node *node = root_;
+  if (node == nullptr) return end();
+  while (!node->leaf_) node = node->child(0);
+  return iterator(root_, node, 0);
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::iterator
+BTree<Key, Mapped, Compare, Multi>::end() const {
+  return iterator(root_, nullptr, 0);
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+bool BTree<Key, Mapped, Compare, Multi>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::size_type
+BTree<Key, Mapped, Compare, Multi>::size() const {
+  return size_;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::size_type
+BTree<Key, Mapped, Compare, Multi>::max_size() const {
+  return SIZE_MAX / kSlotBytes / 2;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::size_type
+BTree<Key, Mapped, Compare, Multi>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+MemoryReport BTree<Key, Mapped, Compare, Multi>::memory_report() const {
+  MemoryReport report;
+  report_subtree(root_, report);
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::clear() {
+  destroy_subtree(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::swap(BTree &other) {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+}
+
+// ключ, равный искомому, может найтись на любом уровне; для уникальных
+// ключей это сразу ответ, иначе спуск продолжается за первым из равных
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::iterator
+BTree<Key, Mapped, Compare, Multi>::lower_bound(const key_type &key) const {
+  iterator result = end();
+  for (Node *node = root_; node;) {
+    unsigned i = lower_in(node, key);
+    if (i < node->count_) {
+      result = iterator(root_, node, i);
+      if (!Multi && !comp_(key, *node->key(i))) break;
+    }
+    node = node->leaf_ ? nullptr : node->child(i);
+  }
+  return result;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::iterator
+BTree<Key, Mapped, Compare, Multi>::upper_bound(const key_type &key) const {
+  iterator result = end();
+  for (Node *node = root_; node;) {
+    unsigned i = upper_in(node, key);
+    if (i < node->count_) result = iterator(root_, node, i);
+    node = node->leaf_ ? nullptr : node->child(i);
+  }
+  return result;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::iterator
+BTree<Key, Mapped, Compare, Multi>::find(const key_type &key) const {
+  iterator it = lower_bound(key);
+  if (it != end() && comp_(key, *it.node_->key(it.pos_))) it = end();
+  return it;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::size_type
+BTree<Key, Mapped, Compare, Multi>::count(const key_type &key) const {
+  size_type result = 0;
+  for (iterator it = find(key);
+       it != end() && !comp_(key, *it.node_->key(it.pos_)); ++it) {
+    ++result;
+  }
+  return result;
+}
+
+// Ключ вставляется в лист, переполненный узел делится пополам, а средний
+// ключ уходит в родителя - и так вверх. Узлы для всех разделений выделяются
+// заранее: если памяти нет, дерево остаётся нетронутым.
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+template <typename K, typename... Args>
+std::pair<typename BTree<Key, Mapped, Compare, Multi>::iterator, bool>
+BTree<Key, Mapped, Compare, Multi>::emplace_key(K &&key, Args &&...args) {
+  Node *node = root_;
+  unsigned i = 0;
+  while (node) {
+    if (Multi) {
+      i = upper_in(node, key);
+    } else {
+      i = lower_in(node, key);
+      if (i < node->count_ && !comp_(key, *node->key(i))) {
+        return {iterator(root_, node, i), false};
+      }
+    }
+    if (node->leaf_) break;
+    node = node->child(i);
+  }
+  key_type new_key(std::forward<K>(key));
+  Mapped new_value = Mapped(std::forward<Args>(args)...);
+  if (root_ == nullptr) root_ = node = new_node(true);
+
+  Node *spare[kMaxHeight];
+  unsigned spares = 0;
+  try {
+    for (Node *n = node; n && n->count_ == kSlots; n = n->parent_) {
+      spare[spares++] = new_node(n->leaf_);
+      if (n->parent_ == nullptr) spare[spares++] = new_node(false);
+    }
+  } catch (...) {
+    while (spares) free_node(spare[--spares]);
+    throw;
+  }
+
+  for (unsigned j = node->count_; j > i; --j) transfer(node, j, node, j - 1);
+  ::new (static_cast<void *>(node->key(i))) key_type(std::move(new_key));
+  ::new (static_cast<void *>(node->value(i))) Mapped(std::move(new_value));
+  ++node->count_;
+  ++size_;
+  Node *track = node;
+  for (Node **next = spare; node && node->count_ > kSlots; next += 1) {
+    Node *parent = node->parent_;
+    split(node, next, track, i);
+    if (parent == nullptr) ++next;
+    node = node->parent_;
+  }
+  return {iterator(root_, track, i), true};
+}
+
+// Ключ внутреннего узла заменяется предыдущим из листа, так что удаление
+// всегда сводится к листу; недобор в узле исправляется у соседей
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::erase_at(iterator pos) {
+  Node *node = pos.node_;
+  if (node == nullptr) return;
+  unsigned i = pos.pos_;
+  destroy_slot(node, i);
+  if (!node->leaf_) {
+    Node *leaf = node->child(i);
+    while (!leaf->leaf_) leaf = leaf->child(leaf->count_);
+    transfer(node, i, leaf, leaf->count_ - 1);
+    node = leaf;
+  } else {
+    for (unsigned j = i + 1; j < node->count_; ++j) {
+      transfer(node, j - 1, node, j);
+    }
+  }
+  --node->count_;
+  --size_;
+  rebalance(node);
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+unsigned BTree<Key, Mapped, Compare, Multi>::lower_in(
+    const Node *node, const key_type &key) const {
+  unsigned i = 0;
+  if constexpr (kCountScan) {
+    for (unsigned j = 0; j < node->count_; ++j) i += *node->key(j) < key;
+  } else {
+    while (i < node->count_ && comp_(*node->key(i), key)) ++i;
+  }
+  return i;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+unsigned BTree<Key, Mapped, Compare, Multi>::upper_in(
+    const Node *node, const key_type &key) const {
+  unsigned i = 0;
+  if constexpr (kCountScan) {
+    for (unsigned j = 0; j < node->count_; ++j) i += !(key < *node->key(j));
+  } else {
+    while (i < node->count_ && !comp_(key, *node->key(i))) ++i;
+  }
+  return i;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::Node *
+BTree<Key, Mapped, Compare, Multi>::new_node(bool leaf) {
+  if (leaf) return new Node;
+  return new InternalNode;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::free_node(Node *node) {
+  if (node->leaf_) {
+    delete node;
+  } else {
+    delete static_cast<InternalNode *>(node);
+  }
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::report_subtree(const Node *node,
+                                                        MemoryReport &report) {
+  if (node == nullptr) return;
+  std::size_t bytes = sizeof(Node);
+  std::size_t pointers = sizeof(node->parent_);
+  if (!node->leaf_) {
+    bytes = sizeof(InternalNode);
+    pointers += sizeof(InternalNode::children_);
+    for (unsigned j = 0; j <= node->count_; ++j) {
+      report_subtree(node->child(j), report);
+    }
+  }
+  std::size_t payload =
+      node->count_ * (memory::payload_size<Key>::value +
+                      (kIsSet ? 0 : memory::payload_size<Mapped>::value));
+  std::size_t slack =
+      sizeof(node->keys_) + sizeof(node->values_) - node->count_ * kSlotBytes;
+  std::size_t control =
+      sizeof(node->position_) + sizeof(node->count_) + sizeof(node->leaf_);
+  report.payload += payload;
+  report.slack += slack;
+  report.pointers += pointers;
+  report.control += control;
+  report.padding += bytes - payload - slack - pointers - control;
+  report.headers += memory::heap_overhead(bytes);
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::destroy_subtree(Node *node) {
+  if (node == nullptr) return;
+  if (!node->leaf_) {
+    for (unsigned j = 0; j <= node->count_; ++j) {
+      destroy_subtree(node->child(j));
+    }
+  }
+  for (unsigned j = 0; j < node->count_; ++j) destroy_slot(node, j);
+  free_node(node);
+}
+
+// Дети ещё не скопированного узла остаются nullptr (так их заполняет
+// конструктор InternalNode), поэтому при исключении копию можно удалить
+// обычным destroy_subtree.
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+typename BTree<Key, Mapped, Compare, Multi>::Node *
+BTree<Key, Mapped, Compare, Multi>::clone(const Node *src, Node *parent,
+                                          unsigned position) {
+  Node *dst = new_node(src->leaf_);
+  dst->parent_ = parent;
+  dst->position_ = position;
+  try {
+    for (unsigned j = 0; j < src->count_; ++j) {
+      ::new (static_cast<void *>(dst->key(j))) key_type(*src->key(j));
+      try {
+        ::new (static_cast<void *>(dst->value(j))) Mapped(*src->value(j));
+      } catch (...) {
+        dst->key(j)->~key_type();
+        throw;
+      }
+      ++dst->count_;
+    }
+    if (!src->leaf_) {
+      for (unsigned j = 0; j <= src->count_; ++j) {
+        dst->child(j) = clone(src->child(j), dst, j);
+      }
+    }
+  } catch (...) {
+    destroy_subtree(dst);
+    throw;
+  }
+  return dst;
+}
+
+// перенос элемента в неинициализированный слот, исходный разрушается
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::transfer(Node *dst, unsigned di,
+                                                  Node *src, unsigned si) {
+  ::new (static_cast<void *>(dst->key(di))) key_type(std::move(*src->key(si)));
+  ::new (static_cast<void *>(dst->value(di)))
+      Mapped(std::move(*src->value(si)));
+  destroy_slot(src, si);
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::destroy_slot(Node *node, unsigned i) {
+  node->key(i)->~key_type();
+  node->value(i)->~Mapped();
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::set_child(Node *parent, unsigned i,
+                                                   Node *child) {
+  parent->child(i) = child;
+  child->parent_ = parent;
+  child->position_ = i;
+}
+
+// Узел с kSlots + 1 ключами делится: первые mid остаются, ключ mid уходит
+// в родителя (при делении корня - в новый корень из spare), остальные - в
+// новый правый узел spare[0]. (track, track_pos) - вставленный элемент,
+// его положение пересчитывается.
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::split(Node *node, Node **spare,
+                                               Node *&track,
+                                               unsigned &track_pos) {
+  const unsigned mid = (kSlots + 1) / 2;
+  Node *right = spare[0];
+  unsigned moved = node->count_ - mid - 1;
+  for (unsigned j = 0; j < moved; ++j) transfer(right, j, node, mid + 1 + j);
+  if (!node->leaf_) {
+    for (unsigned j = 0; j <= moved; ++j) {
+      set_child(right, j, node->child(mid + 1 + j));
+    }
+  }
+  right->count_ = moved;
+
+  Node *parent = node->parent_;
+  if (parent == nullptr) {
+    parent = spare[1];
+    set_child(parent, 0, node);
+    root_ = parent;
+  }
+  unsigned p = node->position_;
+  for (unsigned j = parent->count_; j > p; --j) {
+    transfer(parent, j, parent, j - 1);
+  }
+  for (unsigned j = parent->count_ + 1; j > p + 1; --j) {
+    set_child(parent, j, parent->child(j - 1));
+  }
+  transfer(parent, p, node, mid);
+  set_child(parent, p + 1, right);
+  node->count_ = mid;
+  ++parent->count_;
+
+  if (track == parent && track_pos >= p) {
+    ++track_pos;
+  } else if (track == node && track_pos == mid) {
+    track = parent;
+    track_pos = p;
+  } else if (track == node && track_pos > mid) {
+    track = right;
+    track_pos -= mid + 1;
+  }
+}
+
+// Узлу с недобором ключ занимается у соседа, у которого их больше
+// минимума, иначе узел сливается с соседом и недобор переходит к родителю.
+// Опустевший корень заменяется единственным ребёнком.
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::rebalance(Node *node) {
+  while (node != root_ && node->count_ < kMinSlots) {
+    Node *parent = node->parent_;
+    unsigned i = node->position_;
+    Node *left = i > 0 ? parent->child(i - 1) : nullptr;
+    Node *right = i < parent->count_ ? parent->child(i + 1) : nullptr;
+    if (left && left->count_ > kMinSlots) {
+      rotate_right(left, node, i - 1);
+      return;
+    }
+    if (right && right->count_ > kMinSlots) {
+      rotate_left(node, right, i);
+      return;
+    }
+    if (left) {
+      merge_nodes(left, node, i - 1);
+    } else {
+      merge_nodes(node, right, i);
+    }
+    node = parent;
+  }
+  if (root_->count_ == 0) {
+    Node *old = root_;
+    if (old->leaf_) {
+      root_ = nullptr;
+    } else {
+      root_ = old->child(0);
+      root_->parent_ = nullptr;
+      root_->position_ = 0;
+    }
+    free_node(old);
+  }
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::rotate_right(Node *left, Node *node,
+                                                      unsigned sep) {
+  Node *parent = node->parent_;
+  for (unsigned j = node->count_; j > 0; --j) transfer(node, j, node, j - 1);
+  transfer(node, 0, parent, sep);
+  transfer(parent, sep, left, left->count_ - 1);
+  if (!node->leaf_) {
+    for (unsigned j = node->count_ + 1; j > 0; --j) {
+      set_child(node, j, node->child(j - 1));
+    }
+    set_child(node, 0, left->child(left->count_));
+  }
+  --left->count_;
+  ++node->count_;
+}
+
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::rotate_left(Node *node, Node *right,
+                                                     unsigned sep) {
+  Node *parent = node->parent_;
+  transfer(node, node->count_, parent, sep);
+  transfer(parent, sep, right, 0);
+  for (unsigned j = 1; j < right->count_; ++j) transfer(right, j - 1, right, j);
+  if (!node->leaf_) {
+    set_child(node, node->count_ + 1, right->child(0));
+    for (unsigned j = 1; j <= right->count_; ++j) {
+      set_child(right, j - 1, right->child(j));
+    }
+  }
+  ++node->count_;
+  --right->count_;
+}
+
+// left забирает разделитель из родителя и всё содержимое right
+template <typename Key, typename Mapped, typename Compare, bool Multi>
+void BTree<Key, Mapped, Compare, Multi>::merge_nodes(Node *left, Node *right,
+                                                     unsigned sep) {
+  Node *parent = left->parent_;
+  unsigned base = left->count_ + 1;
+  transfer(left, left->count_, parent, sep);
+  for (unsigned j = 0; j < right->count_; ++j) {
+    transfer(left, base + j, right, j);
+  }
+  if (!left->leaf_) {
+    for (unsigned j = 0; j <= right->count_; ++j) {
+      set_child(left, base + j, right->child(j));
+    }
+  }
+  left->count_ = base + right->count_;
+  for (unsigned j = sep + 1; j < parent->count_; ++j) {
+    transfer(parent, j - 1, parent, j);
+  }
+  for (unsigned j = sep + 2; j <= parent->count_; ++j) {
+    set_child(parent, j - 1, parent->child(j));
+  }
+  --parent->count_;
+  free_node(right);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_BTREE_H_
@@ -0,0 +1,674 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_HASHTABLE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_HASHTABLE_H_
+
+#include <cstddef>      // для std::size_t
+#include <cstdint>      // для std::int8_t, std::uint32_t, SIZE_MAX
+#include <cstring>      // для std::memset, std::memcpy
+#include <memory>       // для std::allocator
+#include <new>          // для placement new
+#include <stdexcept>    // для исключений
+#include <type_traits>  // для std::false_type, std::void_t
+#include <utility>      // для std::pair, std::swap, std::move
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "iterator_hash.h"
+#include "memory_report.h"
+
+namespace s21 {
+// Группа из 16 управляющих байтов, которые сравниваются разом: с SSE2 -
+// одной инструкцией, без него - побайтовым циклом. Бит i результата
+// соответствует байту pos[i].
+class HashGroup {
+ public:
+  static constexpr std::size_t kWidth = 16;
+  static constexpr std::int8_t kEmpty = -128;
+  static constexpr std::int8_t kDeleted = -2;
+
+  explicit HashGroup(const std::int8_t *pos);
+
+  std::uint32_t match(std::int8_t h2) const;
+  std::uint32_t match_empty() const;
+  std::uint32_t match_empty_or_deleted() const;
+
+ private:
+#ifdef __SSE2__
+  __m128i ctrl_;
+#else
+  const std::int8_t *ctrl_;
+#endif
+};
+
+#ifdef __SSE2__
+inline HashGroup::HashGroup(const std::int8_t *pos)
+    : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+inline std::uint32_t HashGroup::match(std::int8_t h2) const {
+  return static_cast<std::uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+}
+
+inline std::uint32_t HashGroup::match_empty() const {
+  return match(kEmpty);
+}
+
+// пустой (-128) и удалённый (-2) - единственные байты меньше -1
+inline std::uint32_t HashGroup::match_empty_or_deleted() const {
+  return static_cast<std::uint32_t>(
+      _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl_)));
+}
+#else
+inline HashGroup::HashGroup(const std::int8_t *pos) : ctrl_(pos) {}
+
+inline std::uint32_t HashGroup::match(std::int8_t h2) const {
+  std::uint32_t mask = 0;
+  for (std::size_t i = 0; i < kWidth; ++i) {
+    if (ctrl_[i] == h2) mask |= std::uint32_t(1) << i;
+  }
+  return mask;
+}
+
+inline std::uint32_t HashGroup::match_empty() const { return match(kEmpty); }
+
+inline std::uint32_t HashGroup::match_empty_or_deleted() const {
+  std::uint32_t mask = 0;
+  for (std::size_t i = 0; i < kWidth; ++i) {
+    if (ctrl_[i] < -1) mask |= std::uint32_t(1) << i;
+  }
+  return mask;
+}
+#endif
+
+// Тип аргумента поиска: сам K, если хеш и сравнение прозрачны
+// (HashTable::kTransparent), иначе key_type. Шаблон вынесен на уровень
+// пространства имён, иначе K в key_arg<K> не выводится.
+template <bool Transparent>
+struct HashKeyArg {
+  template <typename K, typename Key>
+  using type = Key;
+};
+
+template <>
+struct HashKeyArg<true> {
+  template <typename K, typename Key>
+  using type = K;
+};
+
+// извлечение ключа из слота для множества и для отображения
+struct HashSelfKey {
+  template <typename T>
+  const T &operator()(const T &value) const {
+    return value;
+  }
+};
+
+struct HashPairKey {
+  template <typename P>
+  const typename P::first_type &operator()(const P &value) const {
+    return value.first;
+  }
+};
+
+// Хеш-таблица с открытой адресацией в духе Swiss table: слоты лежат одним
+// массивом, а на каждый слот приходится управляющий байт - kEmpty, kDeleted
+// или младшие 7 бит хеша (h2). Поиск идёт группами по 16 байт, начиная с
+// позиции по старшим битам хеша (h1), и сравнивает ключи только в слотах с
+// совпавшим h2. Первые 16 управляющих байтов продублированы в конце
+// массива, поэтому группу можно читать с любой позиции без заворота.
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+class HashTable {
+ private:
+  template <typename T, typename = void>
+  struct is_transparent : std::false_type {};
+  template <typename T>
+  struct is_transparent<T, std::void_t<typename T::is_transparent>>
+      : std::true_type {};
+
+ public:
+  using key_type = Key;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = HashIterator<Slot>;
+  using const_iterator = HashIterator<const Slot>;
+  using size_type = std::size_t;
+
+  static constexpr bool kTransparent =
+      is_transparent<Hash>::value && is_transparent<KeyEqual>::value;
+  static constexpr size_type kWidth = HashGroup::kWidth;
+
+  HashTable() {}
+  HashTable(const HashTable &other);
+  HashTable(HashTable &&other);
+  ~HashTable() { release(); }
+  HashTable &operator=(const HashTable &other);
+  HashTable &operator=(HashTable &&other);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  size_type bucket_count() const;
+  float load_factor() const;
+  float max_load_factor() const;
+  void max_load_factor(float ml);
+  void reserve(size_type count);
+  void rehash(size_type count);
+  // управляющие байты: по одному на слот и kWidth копий начала таблицы
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void clear();
+  void swap(HashTable &other);
+
+  // индекс слота с ключом key или bucket_count(), если ключа нет
+  template <typename K>
+  size_type find_index(const K &key) const;
+  // ищет key и, если его нет, конструирует слот из args; возвращает индекс
+  // слота и признак вставки
+  template <typename K, typename... Args>
+  std::pair<size_type, bool> emplace_key(const K &key, Args &&...args);
+  void erase_index(size_type index);
+
+  iterator iterator_at(size_type index);
+  const_iterator iterator_at(size_type index) const;
+  size_type index_of(const_iterator pos) const;
+
+ protected:
+  std::int8_t *ctrl_{nullptr};
+  Slot *slots_{nullptr};
+
+ private:
+  size_type capacity_{0U};
+  size_type size_{0U};
+  size_type growth_left_{0U};
+  float max_load_factor_{0.875f};
+  Hash hash_{};
+  KeyEqual equal_{};
+
+  static size_type mix(size_type hash);
+  static std::int8_t h2(size_type hash);
+  static size_type lowest_bit(std::uint32_t mask);
+
+  size_type mask() const;
+  size_type growth_limit(size_type capacity) const;
+  size_type capacity_for(size_type count) const;
+  void set_ctrl(size_type index, std::int8_t value);
+  template <typename K>
+  size_type find_index(const K &key, size_type hash) const;
+  size_type find_insert_slot(size_type hash) const;
+  // конструирует слот из args в свободном месте для hash
+  template <typename... Args>
+  size_type place_slot(size_type hash, Args &&...args);
+  void grow();
+  void resize(size_type capacity);
+  void destroy_slots();
+  void release();
+};
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::HashTable(const HashTable &other)
+    : capacity_(other.capacity_),
+      size_(other.size_),
+      growth_left_(other.growth_left_),
+      max_load_factor_(other.max_load_factor_),
+      hash_(other.hash_),
+      equal_(other.equal_) {
+  if (capacity_ == 0) return;
+  ctrl_ = new std::int8_t[capacity_ + kWidth];
+  std::memcpy(ctrl_, other.ctrl_, capacity_ + kWidth);
+  slots_ = std::allocator<Slot>().allocate(capacity_);
+  size_type i = 0;
+  try {
+    for (; i < capacity_; ++i) {
+      if (ctrl_[i] < 0) continue;
+      ::new (static_cast<void *>(slots_ + i)) Slot(other.slots_[i]);
+    }
+  } catch (...) {
+    while (i--) {
+      if (ctrl_[i] >= 0) slots_[i].~Slot();
+    }
+    std::allocator<Slot>().deallocate(slots_, capacity_);
+    delete[] ctrl_;
+    throw;
+  }
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::HashTable(HashTable &&other) {
+  swap(other);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>
+    &HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::operator=(
+        const HashTable &other) {
+  if (this != &other) {
+    HashTable tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>
+    &HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::operator=(
+        HashTable &&other) {
+  if (this != &other) {
+    release();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::iterator
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::begin() {
+  return iterator(ctrl_, ctrl_ + capacity_, slots_);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::iterator
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::end() {
+  return iterator(ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::const_iterator
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::begin() const {
+  return const_iterator(ctrl_, ctrl_ + capacity_, slots_);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::const_iterator
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::end() const {
+  return const_iterator(ctrl_ + capacity_, ctrl_ + capacity_,
+                        slots_ + capacity_);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+bool HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size() const {
+  return size_;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::max_size() const {
+  return SIZE_MAX / ((sizeof(Slot) + 1) * 2);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::bucket_count() const {
+  return capacity_;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+float HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::load_factor() const {
+  return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+float HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::max_load_factor() const {
+  return max_load_factor_;
+}
+
+// Допустимы значения из (0, 1]; при 1 один слот всё равно остаётся пустым,
+// иначе поиск отсутствующего ключа не остановится. Таблица перестраивается,
+// чтобы сразу соблюсти новый предел и пересчитать запас под вставки.
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::max_load_factor(float ml) {
+  if (!(ml > 0.0f && ml <= 1.0f)) {
+    throw std::invalid_argument("max_load_factor must be in (0, 1]");
+  }
+  max_load_factor_ = ml;
+  if (capacity_ == 0) return;
+  size_type capacity = capacity_for(size_);
+  resize(capacity > capacity_ ? capacity : capacity_);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::reserve(size_type count) {
+  if (count == 0) return;
+  size_type capacity = capacity_for(count);
+  if (capacity > capacity_) resize(capacity);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::rehash(size_type count) {
+  if (count == 0 && size_ == 0) {
+    release();
+    return;
+  }
+  size_type capacity = capacity_for(size_);
+  while (capacity < count) capacity *= 2;
+  resize(capacity);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+MemoryReport HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::memory_report()
+    const {
+  MemoryReport report = memory::array_report<Slot>(size_, capacity_);
+  if (capacity_ != 0) {
+    report.control = capacity_ + kWidth;
+    report.headers = memory::heap_overhead(capacity_ * sizeof(Slot)) +
+                     memory::heap_overhead(capacity_ + kWidth);
+  }
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::clear() {
+  if (capacity_ == 0) return;
+  destroy_slots();
+  std::memset(ctrl_, HashGroup::kEmpty, capacity_ + kWidth);
+  size_ = 0;
+  growth_left_ = growth_limit(capacity_);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::swap(HashTable &other) {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(max_load_factor_, other.max_load_factor_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename K>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::find_index(const K &key) const {
+  if (capacity_ == 0) return capacity_;
+  return find_index(key, mix(hash_(key)));
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename K>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::find_index(const K &key,
+                                                        size_type hash) const {
+  std::int8_t tag = h2(hash);
+  size_type pos = (hash >> 7) & mask();
+  for (size_type step = kWidth;; step += kWidth) {
+    HashGroup group(ctrl_ + pos);
+    for (std::uint32_t m = group.match(tag); m; m &= m - 1) {
+      size_type index = (pos + lowest_bit(m)) & mask();
+      if (equal_(KeyOf()(slots_[index]), key)) return index;
+    }
+    if (group.match_empty()) return capacity_;
+    pos = (pos + step) & mask();
+  }
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename K, typename... Args>
+std::pair<typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type,
+          bool>
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::emplace_key(const K &key,
+                                                         Args &&...args) {
+  size_type hash = mix(hash_(key));
+  if (capacity_) {
+    size_type found = find_index(key, hash);
+    if (found != capacity_) return {found, false};
+  }
+  if (growth_left_ == 0) {
+    // args могут ссылаться на элемент этой же таблицы, а grow() переносит
+    // его: слот собирается до переезда (как value в vector::push_back)
+    Slot slot(std::forward<Args>(args)...);
+    grow();
+    return {place_slot(hash, std::move(slot)), true};
+  }
+  return {place_slot(hash, std::forward<Args>(args)...), true};
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename... Args>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::place_slot(size_type hash,
+                                                        Args &&...args) {
+  size_type index = find_insert_slot(hash);
+  ::new (static_cast<void *>(slots_ + index)) Slot(std::forward<Args>(args)...);
+  if (ctrl_[index] == HashGroup::kEmpty) --growth_left_;
+  set_ctrl(index, h2(hash));
+  ++size_;
+  return index;
+}
+
+// Удалённый слот можно сразу вернуть в пустые, если вокруг него нет
+// 16 занятых подряд: тогда ни одна проба не проходила через него дальше.
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::erase_index(size_type index) {
+  slots_[index].~Slot();
+  --size_;
+  std::uint32_t empty_after = HashGroup(ctrl_ + index).match_empty();
+  std::uint32_t empty_before =
+      HashGroup(ctrl_ + ((index - kWidth) & mask())).match_empty();
+  if (empty_after && empty_before &&
+      lowest_bit(empty_after) + (__builtin_clz(empty_before) - 16) < kWidth) {
+    set_ctrl(index, HashGroup::kEmpty);
+    ++growth_left_;
+  } else {
+    set_ctrl(index, HashGroup::kDeleted);
+  }
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::iterator
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::iterator_at(size_type index) {
+  return iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::const_iterator
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::iterator_at(
+    size_type index) const {
+  return const_iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::index_of(
+    const_iterator pos) const {
+  return static_cast<size_type>(pos.ctrl_ - ctrl_);
+}
+
+// финализатор MurmurHash3: std::hash для целых - тождественное отображение,
+// а h1 и h2 берутся из разных концов хеша
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::mix(size_type hash) {
+  std::uint64_t x = hash;
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return static_cast<size_type>(x);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+std::int8_t HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::h2(size_type hash) {
+  return static_cast<std::int8_t>(hash & 0x7F);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::lowest_bit(std::uint32_t mask) {
+  return static_cast<size_type>(__builtin_ctz(mask));
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::mask() const {
+  return capacity_ - 1;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::growth_limit(
+    size_type capacity) const {
+  if (capacity == 0) return 0;
+  size_type limit = static_cast<size_type>(capacity * max_load_factor_);
+  return limit < capacity ? limit : capacity - 1;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::capacity_for(
+    size_type count) const {
+  if (count > max_size()) throw std::length_error("HashTable is too large");
+  size_type capacity = kWidth;
+  while (growth_limit(capacity) < count) capacity *= 2;
+  return capacity;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::set_ctrl(size_type index,
+                                                           std::int8_t value) {
+  ctrl_[index] = value;
+  if (index < kWidth) ctrl_[capacity_ + index] = value;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::find_insert_slot(
+    size_type hash) const {
+  size_type pos = (hash >> 7) & mask();
+  for (size_type step = kWidth;; step += kWidth) {
+    std::uint32_t m = HashGroup(ctrl_ + pos).match_empty_or_deleted();
+    if (m) return (pos + lowest_bit(m)) & mask();
+    pos = (pos + step) & mask();
+  }
+}
+
+// Запас под вставки кончился: если его съели удалённые слоты (живых не
+// больше половины предела), таблица перестраивается в том же размере,
+// иначе - вдвое больше.
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::grow() {
+  size_type capacity = capacity_for(size_ + 1);
+  if (capacity < capacity_) capacity = capacity_;
+  if (capacity == capacity_ && size_ * 2 > growth_limit(capacity_)) {
+    capacity = capacity_ * 2;
+  }
+  resize(capacity);
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::resize(size_type capacity) {
+  std::int8_t *ctrl = new std::int8_t[capacity + kWidth];
+  Slot *slots = nullptr;
+  try {
+    slots = std::allocator<Slot>().allocate(capacity);
+  } catch (...) {
+    delete[] ctrl;
+    throw;
+  }
+  std::memset(ctrl, HashGroup::kEmpty, capacity + kWidth);
+
+  std::int8_t *old_ctrl = ctrl_;
+  Slot *old_slots = slots_;
+  size_type old_capacity = capacity_;
+  ctrl_ = ctrl;
+  slots_ = slots;
+  capacity_ = capacity;
+  growth_left_ = growth_limit(capacity) - size_;
+
+  for (size_type i = 0; i < old_capacity; ++i) {
+    if (old_ctrl[i] < 0) continue;
+    size_type hash = mix(hash_(KeyOf()(old_slots[i])));
+    size_type index = find_insert_slot(hash);
+    ::new (static_cast<void *>(slots_ + index)) Slot(std::move(old_slots[i]));
+    old_slots[i].~Slot();
+    set_ctrl(index, h2(hash));
+  }
+  if (old_capacity) std::allocator<Slot>().deallocate(old_slots, old_capacity);
+  delete[] old_ctrl;
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::destroy_slots() {
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) slots_[i].~Slot();
+  }
+}
+
+template <typename Key, typename Slot, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Key, Slot, KeyOf, Hash, KeyEqual>::release() {
+  if (capacity_ == 0) return;
+  destroy_slots();
+  std::allocator<Slot>().deallocate(slots_, capacity_);
+  delete[] ctrl_;
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = size_ = growth_left_ = 0;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_HASHTABLE_H_
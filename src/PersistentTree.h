@@ -0,0 +1,333 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_PERSISTENTTREE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_PERSISTENTTREE_H_
+
+#include <cstddef>  // для std::size_t
+#include <cstdint>  // для SIZE_MAX
+#include <memory>   // для std::shared_ptr, std::make_shared
+#include <utility>  // для std::swap
+
+#include "iterator_persistent.h"
+#include "memory_report.h"
+#include "node_persistent.h"
+
+namespace s21 {
+// извлечение ключа из элемента для множества и для отображения
+struct PersistentSelfKey {
+  template <typename T>
+  const T &operator()(const T &value) const {
+    return value;
+  }
+};
+
+struct PersistentPairKey {
+  template <typename P>
+  const typename P::first_type &operator()(const P &value) const {
+    return value.first;
+  }
+};
+
+// Персистентное AVL-дерево для persistent_map/persistent_set. Узлы не
+// меняются никогда: вставка и удаление копируют только O(log n) узлов на
+// пути от корня, остальные поддеревья общие со старой версией. Копия
+// дерева - это копия указателя на корень, то есть снимок за O(1), который
+// уже не видит дальнейших изменений оригинала.
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+class PersistentTree {
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+  using Node = PersistentNode<Value>;
+  using NodePtr = typename Node::NodePtr;
+  using iterator = PersistentIterator<Value>;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // узлы, видимые из этой версии; узлы, общие с другими версиями,
+  // учитываются в каждой из них
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void clear();
+  void swap(PersistentTree &other);
+
+  iterator find(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+  bool contains(const key_type &key) const;
+
+  // вставка; при существующем ключе значение заменяется, только если
+  // assign. Возвращает true, если ключа не было
+  bool insert_value(const Value &value, bool assign);
+  size_type erase_key(const key_type &key);
+
+ protected:
+  NodePtr root_;
+  size_type size_{0};
+  Compare comp_{};
+
+ private:
+  const key_type &key_of(const Node *node) const {
+    return KeyOf()(node->value_);
+  }
+
+  NodePtr insert(const NodePtr &node, const Value &value, bool assign,
+                 bool &inserted) const;
+  NodePtr erase(const NodePtr &node, const key_type &key, bool &erased) const;
+  static NodePtr erase_min(const NodePtr &node);
+  static NodePtr make(const Value &value, NodePtr left, NodePtr right);
+  static NodePtr balance(const Value &value, NodePtr left, NodePtr right);
+};
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::iterator
+PersistentTree<Key, Value, KeyOf, Compare>::begin() const {
+  iterator it;
+  it.push_left(root_.get());
+  return it;
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::iterator
+PersistentTree<Key, Value, KeyOf, Compare>::end() const {
+  return iterator();
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+bool PersistentTree<Key, Value, KeyOf, Compare>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::size_type
+PersistentTree<Key, Value, KeyOf, Compare>::size() const {
+  return size_;
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::size_type
+PersistentTree<Key, Value, KeyOf, Compare>::max_size() const {
+  return SIZE_MAX / (sizeof(Node) * 2);
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::size_type
+PersistentTree<Key, Value, KeyOf, Compare>::memory_usage() const {
+  return memory_report().total();
+}
+
+// make_shared кладёт узел в один блок со счётчиками ссылок; блок
+// оценивается как указатель на таблицу виртуальных функций, два счётчика
+// и сам узел (так устроен блок в libstdc++)
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+MemoryReport PersistentTree<Key, Value, KeyOf, Compare>::memory_report()
+    const {
+  struct SharedBlock {
+    void *vptr_;
+    int use_count_;
+    int weak_count_;
+    Node node_;
+  };
+  MemoryReport report;
+  report.payload = size_ * memory::payload_size<Value>::value;
+  report.pointers = size_ * 2 * sizeof(NodePtr);
+  report.control = size_ * (sizeof(void *) + 2 * sizeof(int) + sizeof(int));
+  report.padding = size_ * sizeof(SharedBlock) - report.payload -
+                   report.pointers - report.control;
+  report.headers = size_ * memory::heap_overhead(sizeof(SharedBlock));
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+void PersistentTree<Key, Value, KeyOf, Compare>::clear() {
+  root_.reset();
+  size_ = 0;
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+void PersistentTree<Key, Value, KeyOf, Compare>::swap(PersistentTree &other) {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::iterator
+PersistentTree<Key, Value, KeyOf, Compare>::find(const key_type &key) const {
+  iterator it = lower_bound(key);
+  if (it != end() && comp_(key, KeyOf()(*it))) it = end();
+  return it;
+}
+
+// в стек попадают узлы, от которых спуск ушёл налево: это следующие по
+// порядку после текущего
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::iterator
+PersistentTree<Key, Value, KeyOf, Compare>::lower_bound(
+    const key_type &key) const {
+  iterator it;
+  for (const Node *node = root_.get(); node;) {
+    if (!comp_(key_of(node), key)) {
+      it.push(node);
+      node = node->left_.get();
+    } else {
+      node = node->right_.get();
+    }
+  }
+  return it;
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::iterator
+PersistentTree<Key, Value, KeyOf, Compare>::upper_bound(
+    const key_type &key) const {
+  iterator it;
+  for (const Node *node = root_.get(); node;) {
+    if (comp_(key, key_of(node))) {
+      it.push(node);
+      node = node->left_.get();
+    } else {
+      node = node->right_.get();
+    }
+  }
+  return it;
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+bool PersistentTree<Key, Value, KeyOf, Compare>::contains(
+    const key_type &key) const {
+  const Node *node = root_.get();
+  while (node) {
+    if (comp_(key, key_of(node))) {
+      node = node->left_.get();
+    } else if (comp_(key_of(node), key)) {
+      node = node->right_.get();
+    } else {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+bool PersistentTree<Key, Value, KeyOf, Compare>::insert_value(
+    const Value &value, bool assign) {
+  bool inserted = false;
+  root_ = insert(root_, value, assign, inserted);
+  if (inserted) ++size_;
+  return inserted;
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::size_type
+PersistentTree<Key, Value, KeyOf, Compare>::erase_key(const key_type &key) {
+  bool erased = false;
+  root_ = erase(root_, key, erased);
+  if (!erased) return 0;
+  --size_;
+  return 1;
+}
+
+// если поддерево не изменилось, возвращается тот же узел, и путь выше
+// тоже не копируется
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::NodePtr
+PersistentTree<Key, Value, KeyOf, Compare>::insert(const NodePtr &node,
+                                                   const Value &value,
+                                                   bool assign,
+                                                   bool &inserted) const {
+  if (!node) {
+    inserted = true;
+    return make(value, nullptr, nullptr);
+  }
+  const key_type &key = KeyOf()(value);
+  if (comp_(key, key_of(node.get()))) {
+    NodePtr left = insert(node->left_, value, assign, inserted);
+    if (left == node->left_) return node;
+    return balance(node->value_, std::move(left), node->right_);
+  }
+  if (comp_(key_of(node.get()), key)) {
+    NodePtr right = insert(node->right_, value, assign, inserted);
+    if (right == node->right_) return node;
+    return balance(node->value_, node->left_, std::move(right));
+  }
+  if (!assign) return node;
+  return make(value, node->left_, node->right_);
+}
+
+// удаляемый узел с двумя детьми заменяется минимальным из правого поддерева
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::NodePtr
+PersistentTree<Key, Value, KeyOf, Compare>::erase(const NodePtr &node,
+                                                  const key_type &key,
+                                                  bool &erased) const {
+  if (!node) return node;
+  if (comp_(key, key_of(node.get()))) {
+    NodePtr left = erase(node->left_, key, erased);
+    if (!erased) return node;
+    return balance(node->value_, std::move(left), node->right_);
+  }
+  if (comp_(key_of(node.get()), key)) {
+    NodePtr right = erase(node->right_, key, erased);
+    if (!erased) return node;
+    return balance(node->value_, node->left_, std::move(right));
+  }
+  erased = true;
+  if (!node->left_) return node->right_;
+  if (!node->right_) return node->left_;
+  const Node *min = node->right_.get();
+  while (min->left_) min = min->left_.get();
+  return balance(min->value_, node->left_, erase_min(node->right_));
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::NodePtr
+PersistentTree<Key, Value, KeyOf, Compare>::erase_min(const NodePtr &node) {
+  if (!node->left_) return node->right_;
+  return balance(node->value_, erase_min(node->left_), node->right_);
+}
+
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::NodePtr
+PersistentTree<Key, Value, KeyOf, Compare>::make(const Value &value,
+                                                 NodePtr left, NodePtr right) {
+  return std::make_shared<const Node>(value, std::move(left),
+                                      std::move(right));
+}
+
+// Новый узел над left и right; если высоты поддеревьев разошлись на 2,
+// делается одинарный или двойной поворот - тоже новыми узлами.
+template <typename Key, typename Value, typename KeyOf, typename Compare>
+typename PersistentTree<Key, Value, KeyOf, Compare>::NodePtr
+PersistentTree<Key, Value, KeyOf, Compare>::balance(const Value &value,
+                                                    NodePtr left,
+                                                    NodePtr right) {
+  int hl = Node::height(left), hr = Node::height(right);
+  if (hl > hr + 1) {
+    if (Node::height(left->left_) >= Node::height(left->right_)) {
+      return make(left->value_, left->left_,
+                  make(value, left->right_, std::move(right)));
+    }
+    const Node *mid = left->right_.get();
+    return make(mid->value_, make(left->value_, left->left_, mid->left_),
+                make(value, mid->right_, std::move(right)));
+  }
+  if (hr > hl + 1) {
+    if (Node::height(right->right_) >= Node::height(right->left_)) {
+      return make(right->value_, make(value, std::move(left), right->left_),
+                  right->right_);
+    }
+    const Node *mid = right->left_.get();
+    return make(mid->value_, make(value, std::move(left), mid->left_),
+                make(right->value_, mid->right_, right->right_));
+  }
+  return make(value, std::move(left), std::move(right));
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_PERSISTENTTREE_H_
@@ -1,13 +1,18 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_RBTREE_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_RBTREE_H_
 
+#include "instrument.h"
 #include "iterator_tree.h"
+#include "memory_report.h"
+#include "memory_source.h"
 #include "node_tree.h"
 
 namespace s21 {
 
-template <class K, class V>
-class RBTree {
+// Kind - под каким контейнером идут счётчики S21_INSTRUMENT, Source -
+// откуда берутся узлы (см. memory_source.h)
+template <class K, class V, Tracked Kind, class Source = HeapSource>
+class RBTree : private TrackedSource<Kind, Source> {
  public:
   using key_type = K;
   using value_type = V;
@@ -16,11 +21,14 @@ class RBTree {
   using const_iterator = const RBTreeIterator<key_type, value_type>;
 
   RBTree() : _root(NULL) {}
-  explicit RBTree(const RBTree<key_type, value_type> &tree) {
+  explicit RBTree(const Source &memory) : Memory(memory), _root(NULL) {}
+  explicit RBTree(const RBTree &tree) {
     Copy(tree._root, _root);
   }
   RBTree operator=(RBTree &tree);
-  ~RBTree() { Destory(_root); }
+  ~RBTree() {
+    if (!memory().skip_destroy()) Destory(_root);
+  }
 
   void Insert(const key_type &key, const value_type &value);
   void Creat_new_node(Node *cur, Node *parent, const key_type &key,
@@ -31,7 +39,8 @@ class RBTree {
   void Case_to_delete_one(Node *cur, Node *parent, Node *del);
   void Case_to_delete_two(Node *cur, Node *parent, Node *del);
   void Case_to_delete_three(Node *cur, Node *parent, Node *del);
-  void Case_to_delete_four(Node *cur, Node *parent, Node *del);
+  void Case_to_delete_four(Node *cur, Node *parent);
+  static bool Is_black(Node *node);
 
   bool Contains(const key_type &key);
 
@@ -40,26 +49,35 @@ class RBTree {
   void Destory(Node *root);
   void RotateR(Node *parent);
   void RotateL(Node *parent);
+  MemoryReport Nodes_report(std::size_t nodes, bool key_twice) const;
+  using Memory = TrackedSource<Kind, Source>;
+  Memory &memory() { return *this; }
+  const Memory &memory() const { return *this; }
   Node *_root;
 };
 
-template <class key_type, class value_type>
-s21::RBTree<key_type, value_type> s21::RBTree<key_type, value_type>::operator=(
-    s21::RBTree<key_type, value_type> &tree) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+s21::RBTree<key_type, value_type, Kind, Source>
+s21::RBTree<key_type, value_type, Kind, Source>::operator=(
+    s21::RBTree<key_type, value_type, Kind, Source> &tree) {
   if (this != &tree) {
-    RBTree<key_type, value_type> tmp(tree);
+    RBTree tmp(tree);
     std::swap(_root, tmp._root);
   }
   return *this;
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Remove(const key_type &key) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Remove(
+    const key_type &key) {
   Node *cur = _root;
   Node *parent = NULL;
   Node *del = NULL;
 
+  S21_RECORD(Kind, Counter::kLookups, 1);
   while (cur) {  // Найти узел, который нужно удалить
+    S21_RECORD(Kind, Counter::kNodeVisits, 1);
+    S21_RECORD(Kind, Counter::kComparisons, cur->_key > key ? 1 : 2);
     if (cur->_key > key) {
       cur = cur->_left;
     } else if (cur->_key < key) {
@@ -69,6 +87,7 @@ void s21::RBTree<key_type, value_type>::Remove(const key_type &key) {
     }
   }
   del = cur;
+  if (del == NULL) return;  // ключ не найден
 
   // Если удаляемый узел имеет двух потомков, вам нужно найти самый левый узел
   // правого поддерева
@@ -85,13 +104,13 @@ void s21::RBTree<key_type, value_type>::Remove(const key_type &key) {
 
   Case_to_delete_one(cur, parent, del);
   if (_root) _root->_color = BLACK;
-  delete del;
+  memory().destroy(del);
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Case_to_delete_one(Node *cur,
-                                                           Node *parent,
-                                                           Node *del) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Case_to_delete_one(
+    Node *cur, Node *parent, Node *del) {
+  S21_RECORD(Kind, Counter::kDeleteCaseOne, 1);
   if (cur->_left == NULL) {  // Левый потомок удаляемого узла пуст или оба пусты
     if (parent == NULL) {
       _root = cur->_right;
@@ -130,30 +149,35 @@ void s21::RBTree<key_type, value_type>::Case_to_delete_one(Node *cur,
   }
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Case_to_delete_two(Node *cur,
-                                                           Node *parent,
-                                                           Node *del) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Case_to_delete_two(
+    Node *cur, Node *parent, Node *del) {
+  S21_RECORD(Kind, Counter::kDeleteCaseTwo, 1);
   if (del->_color != RED) {  // если узел красный, удаляем
     Case_to_delete_three(cur, parent, del);
   }
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Case_to_delete_three(Node *cur,
-                                                             Node *parent,
-                                                             Node *del) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Case_to_delete_three(
+    Node *cur, Node *parent, Node *del) {
+  S21_RECORD(Kind, Counter::kDeleteCaseThree, 1);
   if (del->_color == BLACK && cur && cur->_color == RED) {
     cur->_color = BLACK;
   } else {
-    Case_to_delete_four(cur, parent, del);
+    Case_to_delete_four(cur, parent);
   }
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Case_to_delete_four(Node *cur,
-                                                            Node *parent,
-                                                            Node *del) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+bool s21::RBTree<key_type, value_type, Kind, Source>::Is_black(Node *node) {
+  return node == NULL || node->_color == BLACK;  // NULL-листья черные
+}
+
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Case_to_delete_four(
+    Node *cur, Node *parent) {
+  S21_RECORD(Kind, Counter::kDeleteCaseFour, 1);
   while (parent) {  // удаляемый узел черный, а его потомки NULL или черные
     if (parent->_left == cur) {
       Node *subR = parent->_right;
@@ -161,89 +185,69 @@ void s21::RBTree<key_type, value_type>::Case_to_delete_four(Node *cur,
         RotateL(parent);
         subR->_color = BLACK;
         parent->_color = RED;
-      } else {
-        Node *subRL = subR->_left;
-        Node *subRR = subR->_right;
-        if (parent->_color == BLACK && (subRL == NULL && subRR == NULL) ||
-            (subRL && subRL->_color == BLACK && subRR &&
-             subRR->_color == BLACK)) {
-          subR->_color = RED;
-          cur = parent;
-          parent = cur->_parent;
-        } else {
-          if (parent->_color == RED) {
-            if ((subRL == NULL && subRR == NULL) ||
-                (subRL && subRL->_color == BLACK && subRR &&
-                 subRR->_color == BLACK)) {
-              parent->_color = BLACK;
-              subR->_color = RED;
-              break;
-            }
-          }
-          if (subRL && subRL->_color == RED) {
-            RotateR(subR);
-            subR = subRL;
-          }
-          RotateL(parent);
-          if (parent->_color == RED) {
-            subR->_color = RED;
-          } else {
-            subR->_color = BLACK;
-          }
+      } else if (Is_black(subR->_left) && Is_black(subR->_right)) {
+        subR->_color = RED;
+        if (parent->_color == RED) {
           parent->_color = BLACK;
-          subR->_right->_color = BLACK;
           break;
         }
+        cur = parent;
+        parent = cur->_parent;
+      } else {
+        if (Is_black(subR->_right)) {  // красный только ближний племянник
+          Node *subRL = subR->_left;
+          RotateR(subR);
+          subRL->_color = BLACK;
+          subR->_color = RED;
+          subR = subRL;
+        }
+        RotateL(parent);
+        subR->_color = parent->_color;
+        parent->_color = BLACK;
+        subR->_right->_color = BLACK;
+        break;
       }
     } else {
       Node *subL = parent->_left;
       if (subL->_color == RED) {
         RotateR(parent);
-        parent->_color = RED;
         subL->_color = BLACK;
-      } else {
-        Node *subLR = subL->_right;
-        Node *subLL = subL->_left;
-        if (parent->_color == BLACK && (subLL == NULL && subLR == NULL) ||
-            (subLL && subLL->_color == BLACK && subLR &&
-             subLR->_color == BLACK)) {
-          subL->_color = RED;
-          cur = parent;
-          parent = cur->_parent;
-        } else {
-          if (parent->_color == RED) {
-            if ((subLL == NULL && subLR == NULL) ||
-                (subLL && subLL->_color == BLACK && subLR &&
-                 subLR->_color == BLACK)) {
-              parent->_color = BLACK;
-              subL->_color = RED;
-              break;
-            }
-          }
-          if (subLR && subLR->_color == RED) {
-            RotateL(subL);
-            subL = subLR;
-          }
-          RotateR(parent);
-          if (parent->_color == RED) {
-            subL->_color = RED;
-          } else {
-            subL->_color = BLACK;
-          }
+        parent->_color = RED;
+      } else if (Is_black(subL->_left) && Is_black(subL->_right)) {
+        subL->_color = RED;
+        if (parent->_color == RED) {
           parent->_color = BLACK;
-          subL->_left->_color = BLACK;
           break;
         }
+        cur = parent;
+        parent = cur->_parent;
+      } else {
+        if (Is_black(subL->_left)) {  // красный только ближний племянник
+          Node *subLR = subL->_right;
+          RotateL(subL);
+          subLR->_color = BLACK;
+          subL->_color = RED;
+          subL = subLR;
+        }
+        RotateR(parent);
+        subL->_color = parent->_color;
+        parent->_color = BLACK;
+        subL->_left->_color = BLACK;
+        break;
       }
     }
   }
 }
 
-template <class key_type, class value_type>
-bool s21::RBTree<key_type, value_type>::Contains(const key_type &key) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+bool s21::RBTree<key_type, value_type, Kind, Source>::Contains(
+    const key_type &key) {
   bool result = false;
   Node *cur = _root;
+  S21_RECORD(Kind, Counter::kLookups, 1);
   while (cur) {
+    S21_RECORD(Kind, Counter::kNodeVisits, 1);
+    S21_RECORD(Kind, Counter::kComparisons, cur->_key < key ? 1 : 2);
     if (cur->_key < key) {
       cur = cur->_right;
     } else if (cur->_key > key) {
@@ -256,11 +260,11 @@ bool s21::RBTree<key_type, value_type>::Contains(const key_type &key) {
   return result;
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Insert(const key_type &key,
-                                               const value_type &value) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Insert(
+    const key_type &key, const value_type &value) {
   if (_root == NULL) {  // Вставляем при пустом дереве
-    _root = new Node(key, value);
+    _root = memory().template create<Node>(key, value);
     _root->_color = BLACK;
   } else {
     Node *parent{0};
@@ -270,10 +274,13 @@ void s21::RBTree<key_type, value_type>::Insert(const key_type &key,
   }
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Creat_new_node(
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Creat_new_node(
     Node *cur, Node *parent, const key_type &key, const value_type &value) {
+  S21_RECORD(Kind, Counter::kLookups, 1);
   while (cur) {  // найти позицию вставки
+    S21_RECORD(Kind, Counter::kNodeVisits, 1);
+    S21_RECORD(Kind, Counter::kComparisons, 1);
     if (cur->_key <= key) {
       parent = cur;
       cur = cur->_right;
@@ -282,7 +289,7 @@ void s21::RBTree<key_type, value_type>::Creat_new_node(
       cur = cur->_left;
     }
   }
-  cur = new Node(key, value);
+  cur = memory().template create<Node>(key, value);
   cur->_color = RED;
   if (parent->_key <= key) {
     parent->_right = cur;
@@ -294,9 +301,9 @@ void s21::RBTree<key_type, value_type>::Creat_new_node(
   Balance_insert(cur, parent);
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Balance_insert(Node *cur,
-                                                       Node *parent) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Balance_insert(
+    Node *cur, Node *parent) {
   while (parent && parent->_color == RED) {
     Node *grand = parent->_parent;  // дедушка узел
     if (parent == grand->_left) {
@@ -339,10 +346,11 @@ void s21::RBTree<key_type, value_type>::Balance_insert(Node *cur,
   }
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Copy(Node *root, Node *new_root) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Copy(Node *root,
+                                                   Node *new_root) {
   if (root != NULL) {
-    Node *cur = new Node(root->_key, root->_value);
+    Node *cur = memory().template create<Node>(root->_key, root->_value);
     cur->_color = root->_color;
     new_root = cur;
     cur->_parent = new_root;
@@ -352,17 +360,40 @@ void s21::RBTree<key_type, value_type>::Copy(Node *root, Node *new_root) {
   }
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::Destory(Node *root) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::Destory(Node *root) {
   if (root != NULL) {
     Destory(root->_left);
     Destory(root->_right);
-    delete root;
+    memory().destroy(root);
+  }
+}
+
+// Память nodes узлов. key_twice - узел хранит ключ и в _key, и в _value
+// (set, multiset): вторая копия учитывается как slack.
+template <class key_type, class value_type, Tracked Kind, class Source>
+s21::MemoryReport s21::RBTree<key_type, value_type, Kind, Source>::Nodes_report(
+    std::size_t nodes, bool key_twice) const {
+  MemoryReport report;
+  report.payload = nodes * memory::payload_size<key_type>::value;
+  if (key_twice) {
+    report.slack = nodes * sizeof(value_type);
+  } else {
+    report.payload += nodes * memory::payload_size<value_type>::value;
+  }
+  report.pointers = nodes * 3 * sizeof(Node *);
+  report.control = nodes * sizeof(Color);
+  report.padding = nodes * sizeof(Node) - report.payload - report.slack -
+                   report.pointers - report.control;
+  if constexpr (Source::kFromHeap) {
+    report.headers = nodes * memory::heap_overhead(sizeof(Node));
   }
+  return report;
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::RotateR(Node *parent) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::RotateR(Node *parent) {
+  S21_RECORD(Kind, Counter::kRotations, 1);
   Node *subL = parent->_left;
   Node *subLR = subL->_right;
   Node *ppNode = parent->_parent;
@@ -390,8 +421,9 @@ void s21::RBTree<key_type, value_type>::RotateR(Node *parent) {
   }
 }
 
-template <class key_type, class value_type>
-void s21::RBTree<key_type, value_type>::RotateL(Node *parent) {
+template <class key_type, class value_type, Tracked Kind, class Source>
+void s21::RBTree<key_type, value_type, Kind, Source>::RotateL(Node *parent) {
+  S21_RECORD(Kind, Counter::kRotations, 1);
   Node *subR = parent->_right;
   Node *subRL = subR->_left;
   Node *ppNode = parent->_parent;
@@ -0,0 +1,890 @@
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Простые замеры пропускной способности: make bench.
+// Каждый замер печатает число операций и миллионы операций в секунду.
+
+namespace {
+
+template <typename F>
+double measure_ms(F &&f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void report(const char *name, std::size_t ops, double ms) {
+  std::printf("%-40s %12zu ops %10.2f ms %10.2f Mops/s\n", name, ops, ms,
+              ops / ms / 1000.0);
+}
+
+// SPSC start
+
+void bench_spsc(std::size_t n) {
+  s21::spsc_queue<std::size_t> q(1024);
+  double ms = measure_ms([&] {
+    std::thread producer([&] {
+      for (std::size_t i = 0; i < n; ++i) {
+        while (!q.try_push(i)) std::this_thread::yield();
+      }
+    });
+    std::size_t value = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      while (!q.try_pop(value)) std::this_thread::yield();
+    }
+    producer.join();
+  });
+  report("spsc_queue try_push/try_pop", n, ms);
+}
+
+void bench_spsc_batch(std::size_t n) {
+  const std::size_t batch = 64;
+  s21::spsc_queue<std::size_t> q(1024);
+  double ms = measure_ms([&] {
+    std::thread producer([&] {
+      std::size_t in[batch];
+      for (std::size_t i = 0; i < n;) {
+        std::size_t count = (n - i < batch) ? n - i : batch;
+        for (std::size_t j = 0; j < count; ++j) in[j] = i + j;
+        std::size_t pushed = q.try_push_n(in, count);
+        if (!pushed) std::this_thread::yield();
+        i += pushed;
+      }
+    });
+    std::size_t out[batch];
+    for (std::size_t i = 0; i < n;) {
+      std::size_t popped = q.try_pop_n(out, batch);
+      if (!popped) std::this_thread::yield();
+      i += popped;
+    }
+    producer.join();
+  });
+  report("spsc_queue try_push_n/try_pop_n", n, ms);
+}
+
+void bench_mutex_queue(std::size_t n) {
+  s21::queue<std::size_t> q;
+  std::mutex m;
+  double ms = measure_ms([&] {
+    std::thread producer([&] {
+      for (std::size_t i = 0; i < n; ++i) {
+        std::lock_guard<std::mutex> lock(m);
+        q.push(i);
+      }
+    });
+    for (std::size_t i = 0; i < n;) {
+      std::lock_guard<std::mutex> lock(m);
+      if (!q.empty()) {
+        q.pop();
+        ++i;
+      }
+    }
+    producer.join();
+  });
+  report("mutex + s21::queue push/pop", n, ms);
+}
+
+// SPSC end
+
+// MPMC start
+
+// каждый из threads потоков поочерёдно кладёт и забирает элемент
+template <typename Push, typename Pop>
+double run_symmetric(std::size_t threads, std::size_t n, Push push, Pop pop) {
+  return measure_ms([&] {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&] {
+        for (std::size_t i = 0; i < n / threads; ++i) {
+          push(i);
+          pop();
+        }
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+}
+
+void bench_mpmc_contention(std::size_t n) {
+  char name[64];
+  for (std::size_t threads = 1; threads <= 64; threads *= 2) {
+    s21::mpmc_queue<std::size_t> q(1024);
+    double ms = run_symmetric(
+        threads, n,
+        [&](std::size_t i) {
+          while (!q.try_push(i)) std::this_thread::yield();
+        },
+        [&] {
+          std::size_t value = 0;
+          while (!q.try_pop(value)) std::this_thread::yield();
+        });
+    std::snprintf(name, sizeof(name), "mpmc_queue %2zu threads", threads);
+    report(name, n / threads * threads * 2, ms);
+
+    s21::queue<std::size_t> mq;
+    std::mutex m;
+    ms = run_symmetric(
+        threads, n,
+        [&](std::size_t i) {
+          std::lock_guard<std::mutex> lock(m);
+          mq.push(i);
+        },
+        [&] {
+          for (;;) {
+            std::lock_guard<std::mutex> lock(m);
+            if (!mq.empty()) {
+              mq.pop();
+              return;
+            }
+          }
+        });
+    std::snprintf(name, sizeof(name), "mutex + s21::queue %2zu threads",
+                  threads);
+    report(name, n / threads * threads * 2, ms);
+  }
+}
+
+// MPMC end
+
+// Work stealing start
+
+void bench_parallel_for(std::size_t n) {
+  std::size_t hardware = std::thread::hardware_concurrency();
+  if (hardware == 0) hardware = 1;
+  char name[64];
+  for (std::size_t threads = 1; threads <= hardware; threads *= 2) {
+    s21::thread_pool pool(threads);
+    std::atomic<double> total{0.0};
+    double ms = measure_ms([&] {
+      pool.parallel_for(0, n, 4096, [&](std::size_t first, std::size_t last) {
+        double local = 0.0;
+        for (std::size_t i = first; i < last; ++i) local += std::sqrt(i);
+        double expected = total.load();
+        while (!total.compare_exchange_weak(expected, expected + local)) {
+        }
+      });
+    });
+    std::snprintf(name, sizeof(name), "thread_pool parallel_for %2zu threads",
+                  threads);
+    report(name, n, ms);
+  }
+}
+
+// Work stealing end
+
+// Priority queue start
+
+void bench_priority_queues(std::size_t n) {
+  std::mt19937 rng(42);
+  s21::vector<int> keys;
+  keys.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) keys.push_back(static_cast<int>(rng()));
+
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> pq;
+  double ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) pq.push(keys[i]);
+    while (!pq.empty()) pq.pop();
+  });
+  report("priority_queue push+pop", n * 2, ms);
+
+  s21::d_ary_heap<int> heap;
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) heap.push(keys[i]);
+    while (!heap.empty()) heap.pop();
+  });
+  report("d_ary_heap<4> push+pop", n * 2, ms);
+
+  s21::multiset<int> ms_pq;
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) ms_pq.insert(keys[i]);
+    while (!ms_pq.empty()) ms_pq.erase(ms_pq.begin());
+  });
+  report("multiset as priority queue", n * 2, ms);
+}
+
+// Priority queue end
+
+// Hash map start
+
+template <typename Map>
+void bench_point_lookups(const char *name, const s21::vector<int> &keys) {
+  Map m;
+  std::size_t n = keys.size();
+  double ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) m.insert(keys[i], static_cast<int>(i));
+  });
+  std::printf("%s\n", name);
+  report("  insert", n, ms);
+
+  std::size_t hits = 0;
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      hits += m.contains(keys[i]);       // попадание
+      hits += m.contains(~keys[i] | 1);  // промах: все ключи чётные
+    }
+  });
+  report("  contains (50% hits)", n * 2, ms);
+  if (hits < n) std::printf("unexpected hit count %zu\n", hits);
+}
+
+void bench_hash_maps(std::size_t n) {
+  std::mt19937 rng(7);
+  s21::vector<int> keys;
+  keys.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.push_back(static_cast<int>(rng() & ~1U));
+  }
+  bench_point_lookups<s21::map<int, int>>("s21::map", keys);
+  bench_point_lookups<s21::unordered_map<int, int>>("s21::unordered_map", keys);
+}
+
+// Hash map end
+
+// Flat map start
+
+void bench_flat_map(std::size_t n) {
+  std::mt19937_64 rng(11);
+  s21::vector<std::uint64_t> keys, values, probes;
+  keys.reserve(n);
+  values.reserve(n);
+  probes.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.push_back(rng());
+    values.push_back(i);
+    probes.push_back(keys[i]);
+  }
+  for (std::size_t i = n; i > 1; --i) {
+    std::swap(probes[i - 1], probes[rng() % i]);
+  }
+
+  s21::flat_map<std::uint64_t, std::uint64_t> flat;
+  double ms = measure_ms([&] {
+    flat = s21::flat_map<std::uint64_t, std::uint64_t>(std::move(keys),
+                                                       std::move(values));
+  });
+  report("flat_map bulk build (sort + dedup)", n, ms);
+
+  std::size_t hits = 0;
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) hits += flat.contains(probes[i]);
+  });
+  report("flat_map contains", n, ms);
+
+  s21::map<std::uint64_t, std::uint64_t> tree;
+  for (std::size_t i = 0; i < n; ++i) tree.insert(probes[i], i);
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) hits += tree.contains(probes[i]);
+  });
+  report("map contains", n, ms);
+  if (hits != 2 * flat.size()) std::printf("unexpected hit count %zu\n", hits);
+
+  using Node = s21::RBTreeNode<std::uint64_t, std::uint64_t>;
+  std::size_t flat_bytes = (flat.keys().capacity() + flat.values().capacity()) *
+                           sizeof(std::uint64_t);
+  std::printf("memory: flat_map %.1f MB, map nodes %.1f MB + malloc headers\n",
+              flat_bytes / 1e6, tree.size() * sizeof(Node) / 1e6);
+}
+
+// Flat map end
+
+// Static set start
+
+void bench_static_set(std::size_t n) {
+  std::mt19937 rng(13);
+  s21::vector<std::uint32_t> keys, probes;
+  keys.reserve(n);
+  probes.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.push_back(static_cast<std::uint32_t>(rng()));
+    probes.push_back(static_cast<std::uint32_t>(rng()));
+  }
+  s21::flat_set<std::uint32_t> flat(std::move(keys));
+  s21::static_set<std::uint32_t> eytzinger(flat.begin(), flat.end());
+
+  std::size_t found = 0;
+  double ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      found += flat.lower_bound(probes[i]) != flat.end();
+    }
+  });
+  report("flat_set lower_bound", n, ms);
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      found += eytzinger.lower_bound(probes[i]) != eytzinger.end();
+    }
+  });
+  report("static_set lower_bound", n, ms);
+  if (found == 0) std::printf("unexpected: no keys found\n");
+}
+
+// Static set end
+
+// B-tree start
+
+// вставка, поиск и полный обход: B-дерево против красно-чёрного RBTree
+void bench_btree(std::size_t n) {
+  std::mt19937_64 rng(13);
+  s21::vector<std::uint64_t> keys;
+  keys.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) keys.push_back(rng());
+
+  s21::map<std::uint64_t, std::uint64_t> tree;
+  double ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) tree.insert(keys[i], i);
+  });
+  report("map insert", n, ms);
+  s21::btree_map<std::uint64_t, std::uint64_t> btree;
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) btree.insert(keys[i], i);
+  });
+  report("btree_map insert", n, ms);
+
+  for (std::size_t i = n; i > 1; --i) std::swap(keys[i - 1], keys[rng() % i]);
+  std::size_t hits = 0;
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) hits += tree.contains(keys[i]);
+  });
+  report("map find", n, ms);
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) hits += btree.contains(keys[i]);
+  });
+  report("btree_map find", n, ms);
+  if (hits != 2 * n) std::printf("unexpected hit count %zu\n", hits);
+
+  std::uint64_t sum = 0;
+  ms = measure_ms([&] {
+    for (auto value : tree) sum += value;
+  });
+  report("map iterate", n, ms);
+  ms = measure_ms([&] {
+    for (auto item : btree) sum -= item.second;
+  });
+  report("btree_map iterate", n, ms);
+  if (sum != 0) std::printf("unexpected sum %llu\n", (unsigned long long)sum);
+
+  s21::multiset<int> ms_tree;
+  s21::btree_multiset<int> ms_btree;
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) ms_tree.insert(keys[i] % 1000);
+  });
+  report("multiset insert (1000 distinct)", n, ms);
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) ms_btree.insert(keys[i] % 1000);
+  });
+  report("btree_multiset insert (1000 distinct)", n, ms);
+}
+
+// B-tree end
+
+// Persistent map start
+
+// Писатель делает updates изменений и после каждого публикует снимок,
+// readers потоков всё это время берут последний снимок и ищут в нём ключи.
+// Возвращает время писателя; в reads - сколько поисков успели читатели,
+// в hits - сколько из них нашли ключ.
+template <typename Snapshot, typename Update, typename Lookup>
+double run_with_readers(int readers, std::size_t updates, Snapshot &published,
+                        Update &&update, Lookup &&lookup, std::size_t &reads,
+                        std::size_t &hits) {
+  std::mutex lock;
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> total{0}, found{0};
+  std::vector<std::thread> threads;
+  for (int r = 0; r < readers; ++r) {
+    threads.emplace_back([&, r] {
+      std::size_t local = 0, local_found = 0;
+      while (!done.load(std::memory_order_relaxed)) {
+        Snapshot snap;
+        {
+          std::lock_guard<std::mutex> guard(lock);
+          snap = published;
+        }
+        for (int i = 0; i < 64; ++i) {
+          local_found += lookup(snap, (local + r) * 7919 + i);
+        }
+        local += 64;
+      }
+      total += local;
+      found += local_found;
+    });
+  }
+  double ms = measure_ms([&] {
+    for (std::size_t i = 0; i < updates; ++i) {
+      Snapshot next = update(i);
+      std::lock_guard<std::mutex> guard(lock);
+      published = std::move(next);
+    }
+  });
+  done = true;
+  for (auto &thread : threads) thread.join();
+  reads = total.load();
+  hits += found.load();
+  return ms;
+}
+
+// снимок + изменение: полная копия s21::map против O(1) persistent_map
+void bench_persistent_map(std::size_t n) {
+  const int readers = 2;
+  std::size_t reads = 0, found = 0;
+  s21::map<std::uint64_t, std::uint64_t> tree;
+  s21::persistent_map<std::uint64_t, std::uint64_t> persistent;
+  for (std::uint64_t i = 0; i < n; ++i) {
+    tree.insert(i, i);
+    persistent.insert(i, i);
+  }
+
+  using TreePtr = std::shared_ptr<s21::map<std::uint64_t, std::uint64_t>>;
+  TreePtr tree_published = std::make_shared<
+      s21::map<std::uint64_t, std::uint64_t>>(tree);
+  const std::size_t copy_updates = 50;
+  double ms = run_with_readers(
+      readers, copy_updates, tree_published,
+      [&](std::size_t i) {
+        tree.insert_or_assign(i % n, i);
+        return std::make_shared<s21::map<std::uint64_t, std::uint64_t>>(tree);
+      },
+      [&](TreePtr &snap, std::size_t key) {
+        return snap && snap->contains(key % n);
+      },
+      reads, found);
+  report("map update + full-copy snapshot", copy_updates, ms);
+  std::printf("  readers did %zu lookups\n", reads);
+
+  auto persistent_published = persistent;
+  ms = run_with_readers(
+      readers, n, persistent_published,
+      [&](std::size_t i) {
+        persistent.insert_or_assign(i % n, i);
+        return persistent.snapshot();
+      },
+      [&](s21::persistent_map<std::uint64_t, std::uint64_t> &snap,
+          std::size_t key) { return snap.contains(key % n); },
+      reads, found);
+  report("persistent_map update + O(1) snapshot", n, ms);
+  std::printf("  readers did %zu lookups\n", reads);
+  if (found == 0) std::printf("unexpected: no keys found\n");
+}
+
+// Persistent map end
+
+// Concurrent map start
+
+// threads потоков делают поровну операций над ключами из [0, keys):
+// read_percent процентов - поиск, остальные - вставка или удаление
+template <typename Find, typename Insert, typename Erase>
+double run_mix(std::size_t threads, std::size_t n, unsigned read_percent,
+               std::size_t keys, Find find, Insert insert, Erase erase) {
+  return measure_ms([&] {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&, t] {
+        std::mt19937 gen(static_cast<unsigned>(t) + 1);
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < n / threads; ++i) {
+          int key = static_cast<int>(gen() % keys);
+          unsigned dice = gen() % 100;
+          if (dice < read_percent) {
+            found += find(key);
+          } else if (dice & 1) {
+            insert(key);
+          } else {
+            erase(key);
+          }
+        }
+        if (found == SIZE_MAX) std::printf("unreachable\n");
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+}
+
+// concurrent_map против s21::map под std::shared_mutex при 90/10 и 50/50
+void bench_concurrent_map(std::size_t n) {
+  const std::size_t keys = 100000;
+  char name[64];
+  for (unsigned read_percent : {90U, 50U}) {
+    for (std::size_t threads = 1; threads <= 8; threads *= 2) {
+      s21::concurrent_map<int, int> cm;
+      for (std::size_t key = 0; key < keys; key += 2) {
+        cm.insert(static_cast<int>(key), 0);
+      }
+      double ms = run_mix(
+          threads, n, read_percent, keys,
+          [&](int key) { return cm.contains(key); },
+          [&](int key) { cm.insert(key, key); },
+          [&](int key) { cm.erase(key); });
+      std::snprintf(name, sizeof(name), "concurrent_map %u%% read %zu thr",
+                    read_percent, threads);
+      report(name, n / threads * threads, ms);
+
+      s21::map<int, int> m;
+      std::shared_mutex mutex;
+      for (std::size_t key = 0; key < keys; key += 2) {
+        m.insert(static_cast<int>(key), 0);
+      }
+      ms = run_mix(
+          threads, n, read_percent, keys,
+          [&](int key) {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            return m.contains(key);
+          },
+          [&](int key) {
+            std::lock_guard<std::shared_mutex> lock(mutex);
+            m.insert(key, key);
+          },
+          [&](int key) {
+            std::lock_guard<std::shared_mutex> lock(mutex);
+            auto it = m.find(key);
+            if (it != m.end()) m.erase(it);
+          });
+      std::snprintf(name, sizeof(name), "shared_mutex map %u%% read %zu thr",
+                    read_percent, threads);
+      report(name, n / threads * threads, ms);
+    }
+  }
+}
+
+// Concurrent map end
+
+// Bulk ops start
+
+// Каждая операция bulk_ops на float при нескольких длинах: скалярный путь
+// против векторного с шириной по процессору. Повторов столько, чтобы на
+// каждый замер пришлось около total элементов.
+void bench_bulk_ops(std::size_t total) {
+  const char *best = "vector";
+  switch (s21::simd_detect()) {
+    case s21::SimdLevel::k512:
+      best = "avx512";
+      break;
+    case s21::SimdLevel::k256:
+      best = "avx2";
+      break;
+    case s21::SimdLevel::k128:
+      best = "sse2";
+      break;
+    default:
+      break;
+  }
+  char name[64];
+  float sink = 0;
+  for (std::size_t n : {std::size_t(1) << 10, std::size_t(1) << 16,
+                        std::size_t(1) << 20, std::size_t(1) << 24}) {
+    s21::vector<float> a(n), b(n);
+    for (std::size_t i = 0; i < n; ++i) a[i] = b[i] = float(i % 1000);
+    std::size_t reps = total / n;
+    auto run = [&](const char *op, auto f) {
+      for (auto level : {s21::SimdLevel::kScalar, s21::simd_detect()}) {
+        s21::set_simd_level(level);
+        double ms = measure_ms([&] {
+          for (std::size_t r = 0; r < reps; ++r) sink += f();
+        });
+        std::snprintf(name, sizeof(name), "bulk %s %zuK %s", op, n >> 10,
+                      level == s21::SimdLevel::kScalar ? "scalar" : best);
+        report(name, reps * n, ms);
+      }
+    };
+    run("fill", [&] {
+      s21::bulk_fill(a, 1.0f);
+      return a[0];
+    });
+    run("replace", [&] {
+      s21::bulk_replace(a, 1.0f, 2.0f);
+      return a[n - 1];
+    });
+    s21::bulk_fill(a, 0.5f);
+    s21::bulk_fill(b, 0.5f);
+    run("find", [&] { return float(s21::bulk_find(a, -1.0f)); });
+    run("count", [&] { return float(s21::bulk_count(a, 0.5f)); });
+    run("equal", [&] { return float(s21::bulk_equal(a, b)); });
+    run("compare", [&] { return float(s21::bulk_compare(a, b)); });
+    run("minmax", [&] { return s21::bulk_minmax(a).second; });
+    run("sum", [&] { return s21::bulk_sum(a); });
+    run("dot", [&] { return s21::bulk_dot(a, b); });
+  }
+  s21::set_simd_level(s21::simd_detect());
+  if (sink == -1.0f) std::printf("unreachable\n");
+}
+
+// Bulk ops end
+
+// Small vector start
+
+// много коротких векторов по 6 элементов: s21::vector выделяет память на
+// каждом удвоении, small_vector<int, 8> - ни разу
+void bench_small_vector(std::size_t n) {
+  std::size_t sink = 0;
+  double ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      s21::vector<int> v;
+      for (int k = 0; k < 6; ++k) v.push_back(k);
+      sink += v.size();
+    }
+  });
+  report("vector<int> 6 push_back", n * 6, ms);
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      s21::small_vector<int, 8> v;
+      for (int k = 0; k < 6; ++k) v.push_back(k);
+      sink += v.size();
+    }
+  });
+  report("small_vector<int, 8> 6 push_back", n * 6, ms);
+  if (sink == 0) std::printf("unreachable\n");
+}
+
+// Small vector end
+
+// Stable vector start
+
+// append без reserve: s21::vector на каждом удвоении переносит все
+// элементы, stable_vector только добавляет кусок; затем чтение по индексу
+void bench_stable_vector(std::size_t n) {
+  std::size_t sink = 0;
+  s21::vector<std::uint64_t> v;
+  double ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) v.push_back(i);
+  });
+  report("vector<u64> push_back", n, ms);
+  s21::stable_vector<std::uint64_t> sv;
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) sv.push_back(i);
+  });
+  report("stable_vector<u64> push_back", n, ms);
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) sink += v[i];
+  });
+  report("vector<u64> operator[]", n, ms);
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) sink += sv[i];
+  });
+  report("stable_vector<u64> operator[]", n, ms);
+  if (sink == 0) std::printf("unreachable\n");
+}
+
+// Stable vector end
+
+// SoA vector start
+
+// запись с 8 полями, из которых проход читает 2
+struct Tick {
+  std::uint64_t time;
+  double price;
+  double qty;
+  std::uint32_t venue;
+  std::uint32_t flags;
+  double bid;
+  double ask;
+  std::uint64_t seq;
+};
+
+// AoS тянет через кэш все 56 байт записи ради 16 байт price и qty,
+// SoA читает только два столбца. Контейнеры живут по очереди, чтобы
+// 50M записей не занимали память дважды
+void bench_soa_vector(std::size_t n) {
+  double sum = 0;
+  {
+    s21::vector<Tick> aos;
+    aos.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      double x = static_cast<double>(i % 1000);
+      aos.push_back(Tick{i, x, 2.0, 1U, 0U, x - 1, x + 1, i});
+    }
+    double ms = measure_ms([&] {
+      double acc = 0;
+      for (std::size_t i = 0; i < n; ++i) acc += aos[i].price * aos[i].qty;
+      sum += acc;
+    });
+    report("vector<Tick> scan price*qty", n, ms);
+  }
+  {
+    s21::soa_vector<std::uint64_t, double, double, std::uint32_t,
+                    std::uint32_t, double, double, std::uint64_t>
+        soa;
+    soa.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      double x = static_cast<double>(i % 1000);
+      soa.push_back({i, x, 2.0, 1U, 0U, x - 1, x + 1, i});
+    }
+    double ms = measure_ms([&] {
+      s21::span<const double> price = soa.column<1>();
+      s21::span<const double> qty = soa.column<2>();
+      double acc = 0;
+      for (std::size_t i = 0; i < n; ++i) acc += price[i] * qty[i];
+      sum += acc;
+    });
+    report("soa_vector scan price*qty", n, ms);
+  }
+  if (sum == 0) std::printf("unreachable\n");
+}
+
+// SoA vector end
+
+// Dynamic bitset start
+
+// битовая карта принадлежности: s21::vector<bool> тратит байт на бит,
+// dynamic_bitset - бит, и считает и пересекает карты по словам
+void bench_dynamic_bitset(std::size_t n) {
+  std::size_t sink = 0;
+  s21::vector<bool> va(n), vb(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    va[i] = i % 3 == 0;
+    vb[i] = i % 5 == 0;
+  }
+  double ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) va[i] = va[i] && !vb[i];
+    for (std::size_t i = 0; i < n; ++i) sink += va[i];
+  });
+  report("vector<bool> and-not + count", n, ms);
+  s21::dynamic_bitset ba(n), bb(n);
+  for (std::size_t i = 0; i < n; i += 3) ba.set(i);
+  for (std::size_t i = 0; i < n; i += 5) bb.set(i);
+  ms = measure_ms([&] {
+    ba -= bb;
+    sink += ba.count();
+  });
+  report("dynamic_bitset and-not + count", n, ms);
+  // редкая карта, бит на 1000: find_next пропускает нулевые слова целиком.
+  // На плотной карте каждый вызов ждёт предыдущего (~5 нс на бит), и
+  // побитовый проход vector<bool> быстрее
+  bb.reset();
+  for (std::size_t i = 0; i < n; ++i) vb[i] = i % 1000 == 0;
+  for (std::size_t i = 0; i < n; i += 1000) bb.set(i);
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      if (vb[i]) sink += i;
+    }
+  });
+  report("vector<bool> scan sparse bits", n, ms);
+  ms = measure_ms([&] {
+    for (std::size_t i = bb.find_first(); i != s21::dynamic_bitset::npos;
+         i = bb.find_next(i)) {
+      sink += i;
+    }
+  });
+  report("dynamic_bitset find_next sparse", n, ms);
+  if (sink == 0) std::printf("unreachable\n");
+}
+
+// Dynamic bitset end
+
+// Circular buffer start
+
+// последние 1024 отсчёта ряда: s21::queue уже кольцевая и после разгона
+// не выделяет память, но проверка размера и pop остаются вызывающему;
+// circular_buffer с kOverwrite пишет поверх самого старого сам
+void bench_circular_buffer(std::size_t n) {
+  const std::size_t window = 1024;
+  double sink = 0;
+  s21::queue<double> q;
+  double ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      if (q.size() == window) q.pop();
+      q.push(static_cast<double>(i));
+    }
+  });
+  sink += q.back();
+  report("queue<double> push + pop", n, ms);
+  s21::circular_buffer<double> ring(window);
+  ms = measure_ms([&] {
+    for (std::size_t i = 0; i < n; ++i) ring.push_back(static_cast<double>(i));
+  });
+  sink += ring.back();
+  report("circular_buffer<double> push_back", n, ms);
+  if (sink == 0) std::printf("unreachable\n");
+}
+
+// Circular buffer end
+
+// Arena start
+
+// обработка "запроса": несколько map, list и vector по 200 элементов,
+// затем всё уничтожается; ops - число запросов
+template <typename Map, typename List, typename Vector, typename Make>
+double handle_requests(std::size_t n, Make &&make, double &sink) {
+  for (std::size_t r = 0; r < n; ++r) {
+    Map mp = make(static_cast<Map *>(nullptr));
+    List lst = make(static_cast<List *>(nullptr));
+    Vector vec = make(static_cast<Vector *>(nullptr));
+    for (int i = 0; i < 200; ++i) {
+      int key = (i * 73 + static_cast<int>(r)) % 211;
+      mp[key] = i;
+      lst.push_back(key);
+      vec.push_back(key);
+    }
+    sink += mp.size() + lst.size() + vec.size();
+  }
+  return sink;
+}
+
+void bench_arena(std::size_t n) {
+  double sink = 0;
+  double ms = measure_ms([&] {
+    handle_requests<s21::map<int, double>, s21::list<int>, s21::vector<int>>(
+        n, [](auto *type) { return std::remove_pointer_t<decltype(type)>(); },
+        sink);
+  });
+  report("requests on new/delete", n, ms);
+  s21::arena memory;
+  auto on_arena = [&](s21::pmr::DestroyMode mode) {
+    auto make = [&](auto *type) {
+      return std::remove_pointer_t<decltype(type)>(&memory, mode);
+    };
+    return measure_ms([&] {
+      for (std::size_t r = 0; r < n; ++r) {
+        handle_requests<s21::pmr::map<int, double>, s21::pmr::list<int>,
+                        s21::pmr::vector<int>>(1, make, sink);
+        memory.reset();
+      }
+    });
+  };
+  ms = on_arena(s21::pmr::DestroyMode::kDestroy);
+  report("requests on arena", n, ms);
+  ms = on_arena(s21::pmr::DestroyMode::kSkip);
+  report("requests on arena, skip destroy", n, ms);
+  if (sink == 0) std::printf("unreachable\n");
+}
+
+// Arena end
+
+}  // namespace
+
+int main() {
+  const std::size_t n = 10000000;
+
+  bench_mutex_queue(n);
+  bench_spsc(n);
+  bench_spsc_batch(n);
+  bench_mpmc_contention(n / 5);
+  bench_parallel_for(n * 5);
+  bench_priority_queues(n / 10);
+  bench_hash_maps(n / 10);
+  bench_flat_map(n / 10);
+  bench_static_set(n);
+  bench_btree(n / 10);
+  bench_persistent_map(n / 100);
+  bench_concurrent_map(n / 10);
+  bench_bulk_ops(n * 3);
+  bench_small_vector(n);
+  bench_stable_vector(n * 3);
+  bench_soa_vector(n * 5);
+  bench_dynamic_bitset(n * 20);
+  bench_circular_buffer(n);
+  bench_arena(n / 100);
+
+  return 0;
+}
@@ -0,0 +1,651 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_BULK_OPS_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_BULK_OPS_H_
+
+#include <atomic>       // для std::atomic
+#include <cstddef>      // для std::size_t
+#include <cstdint>      // для std::int64_t, std::uint64_t
+#include <stdexcept>    // для исключений
+#include <type_traits>  // для std::is_arithmetic
+#include <utility>      // для std::pair
+
+namespace s21 {
+// Массовые операции над непрерывными массивами: s21::vector, s21::array или
+// просто указатель и длина. Для арифметических типов цикл идёт векторами
+// GCC (vector_size) шириной 128, 256 или 512 бит; ширина выбирается при
+// первом вызове по возможностям процессора (SSE2, AVX2, AVX-512BW), для
+// остальных типов и хвостов - обычный скалярный цикл. Результаты совпадают
+// со скалярными, кроме двух случаев: сумма и скалярное произведение float и
+// double складываются в другом порядке, а min/max/minmax на массиве с NaN
+// возвращают неопределённое значение.
+
+// ширина векторов; kScalar - без векторов
+enum class SimdLevel { kScalar = 0, k128 = 16, k256 = 32, k512 = 64 };
+
+SimdLevel simd_detect();
+SimdLevel simd_level();
+// для замеров и тестов: ширина не выше той, что есть у процессора
+void set_simd_level(SimdLevel level);
+
+// сумма целых копится в 64 битах, вещественных - в самом типе
+template <typename T, bool Integral = std::is_integral<T>::value>
+struct BulkSum {
+  using type = T;
+};
+
+template <typename T>
+struct BulkSum<T, true> {
+  using type = typename std::conditional<std::is_signed<T>::value,
+                                         std::int64_t, std::uint64_t>::type;
+};
+
+template <typename T>
+void bulk_fill(T *first, std::size_t n, const T &value);
+template <typename T>
+void bulk_replace(T *first, std::size_t n, const T &old_value,
+                  const T &new_value);
+// индекс первого равного value, n - если такого нет
+template <typename T>
+std::size_t bulk_find(const T *first, std::size_t n, const T &value);
+template <typename T>
+std::size_t bulk_count(const T *first, std::size_t n, const T &value);
+// индекс первой пары с !(a[i] == b[i]), n - если таких нет
+template <typename T>
+std::size_t bulk_mismatch(const T *a, const T *b, std::size_t n);
+template <typename T>
+bool bulk_equal(const T *a, const T *b, std::size_t n);
+// лексикографическое сравнение: <0, 0 или >0
+template <typename T>
+int bulk_compare(const T *a, std::size_t na, const T *b, std::size_t nb);
+// на пустом массиве бросают std::invalid_argument
+template <typename T>
+T bulk_min(const T *first, std::size_t n);
+template <typename T>
+T bulk_max(const T *first, std::size_t n);
+template <typename T>
+std::pair<T, T> bulk_minmax(const T *first, std::size_t n);
+template <typename T>
+typename BulkSum<T>::type bulk_sum(const T *first, std::size_t n);
+template <typename T>
+typename BulkSum<T>::type bulk_dot(const T *a, const T *b, std::size_t n);
+
+// поразрядные операции над беззнаковыми словами: dst[i] = dst[i] op src[i],
+// kAndNot - dst[i] & ~src[i]
+enum class BitOp { kAnd, kOr, kXor, kAndNot };
+template <typename T>
+void bulk_bitwise(BitOp op, T *dst, const T *src, std::size_t n);
+// число единичных битов во всех словах
+template <typename T>
+std::size_t bulk_popcount(const T *first, std::size_t n);
+
+// то же для контейнеров с data() и size()
+template <typename Container>
+void bulk_fill(Container &c, const typename Container::value_type &value);
+template <typename Container>
+void bulk_replace(Container &c,
+                  const typename Container::value_type &old_value,
+                  const typename Container::value_type &new_value);
+template <typename Container>
+std::size_t bulk_find(const Container &c,
+                      const typename Container::value_type &value);
+template <typename Container>
+std::size_t bulk_count(const Container &c,
+                       const typename Container::value_type &value);
+template <typename Container>
+bool bulk_equal(const Container &a, const Container &b);
+template <typename Container>
+int bulk_compare(const Container &a, const Container &b);
+template <typename Container>
+typename Container::value_type bulk_min(const Container &c);
+template <typename Container>
+typename Container::value_type bulk_max(const Container &c);
+template <typename Container>
+std::pair<typename Container::value_type, typename Container::value_type>
+bulk_minmax(const Container &c);
+template <typename Container>
+typename BulkSum<typename Container::value_type>::type bulk_sum(
+    const Container &c);
+template <typename Container>
+typename BulkSum<typename Container::value_type>::type bulk_dot(
+    const Container &a, const Container &b);
+
+// Ядра. Bytes - ширина вектора, 0 - скалярный цикл. Ядра встраиваются
+// (always_inline) в обёртки run_256 и run_512, у которых свой target, и поэтому
+// компилируются в инструкции нужного набора.
+namespace bulk {
+
+template <typename T>
+constexpr bool kVectorizable =
+    std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+    sizeof(T) <= 8;
+
+// unaligned - тот же вектор с выравниванием T, через него читаются и
+// пишутся элементы массива (как __m256_u в immintrin.h)
+template <typename T, std::size_t Bytes>
+struct Vec {
+  typedef T type __attribute__((vector_size(Bytes)));
+  typedef T unaligned
+      __attribute__((vector_size(Bytes), aligned(alignof(T)), may_alias));
+};
+
+template <std::size_t Bytes>
+using Width = std::integral_constant<std::size_t, Bytes>;
+
+template <std::size_t Bytes, typename T>
+constexpr bool kUseVectors = Bytes != 0 && kVectorizable<T>;
+
+// векторы возвращаются ссылкой: передача по значению из функции без
+// target зависела бы от набора инструкций (-Wpsabi)
+template <std::size_t Bytes, typename T>
+__attribute__((always_inline)) inline const typename Vec<T, Bytes>::unaligned &
+load(const T *p) {
+  return *reinterpret_cast<const typename Vec<T, Bytes>::unaligned *>(p);
+}
+
+template <std::size_t Bytes, typename T>
+__attribute__((always_inline)) inline typename Vec<T, Bytes>::unaligned &
+store(T *p) {
+  return *reinterpret_cast<typename Vec<T, Bytes>::unaligned *>(p);
+}
+
+// есть ли в маске сравнения хоть одна ненулевая дорожка
+template <typename M>
+__attribute__((always_inline)) inline bool any(const M &mask) {
+  using W = typename Vec<std::uint64_t, sizeof(M)>::type;
+  W words = reinterpret_cast<const W &>(mask);
+  std::uint64_t acc = 0;
+  for (std::size_t i = 0; i < sizeof(M) / 8; ++i) acc |= words[i];
+  return acc != 0;
+}
+
+// value во всех дорожках. Присваиванием, а не V{} + value: сложение
+// превращает -0.0 в +0.0 (0.0 + -0.0 == +0.0).
+template <typename V, typename T>
+__attribute__((always_inline)) inline void broadcast(V &lanes,
+                                                     const T &value) {
+  for (std::size_t lane = 0; lane < sizeof(V) / sizeof(T); ++lane) {
+    lanes[lane] = value;
+  }
+}
+
+template <std::size_t Bytes, typename T>
+__attribute__((always_inline)) inline void fill(T *p, std::size_t n,
+                                                const T &value) {
+  std::size_t i = 0;
+  if constexpr (kUseVectors<Bytes, T>) {
+    using V = typename Vec<T, Bytes>::type;
+    constexpr std::size_t L = Bytes / sizeof(T);
+    V splat{};
+    broadcast(splat, value);
+    for (; i + L <= n; i += L) store<Bytes>(p + i) = splat;
+  }
+  for (; i < n; ++i) p[i] = value;
+}
+
+template <std::size_t Bytes, typename T>
+__attribute__((always_inline)) inline void replace(T *p, std::size_t n,
+                                                   const T &old_value,
+                                                   const T &new_value) {
+  std::size_t i = 0;
+  if constexpr (kUseVectors<Bytes, T>) {
+    using V = typename Vec<T, Bytes>::type;
+    constexpr std::size_t L = Bytes / sizeof(T);
+    V from{}, to{};
+    broadcast(from, old_value);
+    broadcast(to, new_value);
+    for (; i + L <= n; i += L) {
+      V x = load<Bytes>(p + i);
+      x = x == from ? to : x;
+      store<Bytes>(p + i) = x;
+    }
+  }
+  for (; i < n; ++i) {
+    if (p[i] == old_value) p[i] = new_value;
+  }
+}
+
+// Четыре вектора за шаг: маски объединяются, и проверка на выход одна.
+// Маски копятся через |= в переменной: выражение (a == s) | (b == s) GCC
+// для 512 бит разбирает на скалярные сравнения.
+template <std::size_t Bytes, typename T>
+__attribute__((always_inline)) inline std::size_t find(const T *p,
+                                                       std::size_t n,
+                                                       const T &value) {
+  std::size_t i = 0;
+  if constexpr (kUseVectors<Bytes, T>) {
+    using V = typename Vec<T, Bytes>::type;
+    using M = decltype(V{} == V{});
+    constexpr std::size_t L = Bytes / sizeof(T);
+    V splat{};
+    broadcast(splat, value);
+    for (; i + 4 * L <= n; i += 4 * L) {
+      M mask = load<Bytes>(p + i) == splat;
+      for (std::size_t k = 1; k < 4; ++k) {
+        mask |= load<Bytes>(p + i + k * L) == splat;
+      }
+      if (any(mask)) break;
+    }
+  }
+  for (; i < n; ++i) {
+    if (p[i] == value) return i;
+  }
+  return n;
+}
+
+// Совпадение даёт в маске -1, маски копятся вычитанием в дорожках той же
+// ширины, что и T. Каждые 127 шагов дорожки сбрасываются в общий счётчик,
+// чтобы восьмибитные не переполнились.
+template <std::size_t Bytes, typename T>
+__attribute__((always_inline)) inline std::size_t count(const T *p,
+                                                        std::size_t n,
+                                                        const T &value) {
+  std::size_t i = 0, total = 0;
+  if constexpr (kUseVectors<Bytes, T>) {
+    using V = typename Vec<T, Bytes>::type;
+    using M = decltype(V{} == V{});
+    constexpr std::size_t L = Bytes / sizeof(T);
+    V splat{};
+    broadcast(splat, value);
+    while (i + L <= n) {
+      M acc{};
+      for (int step = 0; step < 127 && i + L <= n; ++step, i += L) {
+        acc -= load<Bytes>(p + i) == splat;
+      }
+      for (std::size_t lane = 0; lane < L; ++lane) {
+        total += static_cast<std::size_t>(acc[lane]);
+      }
+    }
+  }
+  for (; i < n; ++i) total += p[i] == value;
+  return total;
+}
+
+template <std::size_t Bytes, typename T>
+__attribute__((always_inline)) inline std::size_t mismatch(const T *a,
+                                                           const T *b,
+                                                           std::size_t n) {
+  std::size_t i = 0;
+  if constexpr (kUseVectors<Bytes, T>) {
+    using V = typename Vec<T, Bytes>::type;
+    using M = decltype(V{} == V{});
+    constexpr std::size_t L = Bytes / sizeof(T);
+    for (; i + 4 * L <= n; i += 4 * L) {
+      M mask = load<Bytes>(a + i) != load<Bytes>(b + i);
+      for (std::size_t k = 1; k < 4; ++k) {
+        mask |= load<Bytes>(a + i + k * L) != load<Bytes>(b + i + k * L);
+      }
+      if (any(mask)) break;
+    }
+  }
+  for (; i < n; ++i) {
+    if (!(a[i] == b[i])) return i;
+  }
+  return n;
+}
+
+// Два аккумулятора, чтобы соседние шаги не ждали друг друга. Сравнения
+// дорожек те же, что у скалярного цикла: x < lo и hi < x.
+template <std::size_t Bytes, typename T>
+__attribute__((always_inline)) inline std::pair<T, T> minmax(const T *p,
+                                                             std::size_t n) {
+  std::size_t i = 0;
+  T lo = p[0], hi = p[0];
+  if constexpr (kUseVectors<Bytes, T>) {
+    using V = typename Vec<T, Bytes>::type;
+    constexpr std::size_t L = Bytes / sizeof(T);
+    if (n >= 2 * L) {
+      V lo0 = load<Bytes>(p), lo1 = load<Bytes>(p + L);
+      V hi0 = lo0, hi1 = lo1;
+      for (i = 2 * L; i + 2 * L <= n; i += 2 * L) {
+        V x0 = load<Bytes>(p + i), x1 = load<Bytes>(p + i + L);
+        lo0 = x0 < lo0 ? x0 : lo0;
+        lo1 = x1 < lo1 ? x1 : lo1;
+        hi0 = hi0 < x0 ? x0 : hi0;
+        hi1 = hi1 < x1 ? x1 : hi1;
+      }
+      lo0 = lo1 < lo0 ? lo1 : lo0;
+      hi0 = hi0 < hi1 ? hi1 : hi0;
+      for (std::size_t lane = 0; lane < L; ++lane) {
+        if (lo0[lane] < lo) lo = lo0[lane];
+        if (hi < hi0[lane]) hi = hi0[lane];
+      }
+    }
+  }
+  for (; i < n; ++i) {
+    if (p[i] < lo) lo = p[i];
+    if (hi < p[i]) hi = p[i];
+  }
+  return {lo, hi};
+}
+
+// Вещественные складываются в четыре векторных аккумулятора (задержка
+// сложения - несколько тактов), целые расширяются до 64 бит.
+template <std::size_t Bytes, bool Dot, typename T>
+__attribute__((always_inline)) inline typename BulkSum<T>::type sum(
+    const T *a, const T *b, std::size_t n) {
+  using S = typename BulkSum<T>::type;
+  std::size_t i = 0;
+  S total{};
+  if constexpr (kUseVectors<Bytes, T> && std::is_floating_point<T>::value) {
+    using V = typename Vec<T, Bytes>::type;
+    constexpr std::size_t L = Bytes / sizeof(T);
+    V acc[4] = {};
+    for (; i + 4 * L <= n; i += 4 * L) {
+      for (std::size_t k = 0; k < 4; ++k) {
+        V x = load<Bytes>(a + i + k * L);
+        if constexpr (Dot) x *= load<Bytes>(b + i + k * L);
+        acc[k] += x;
+      }
+    }
+    V all = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    for (std::size_t lane = 0; lane < L; ++lane) total += all[lane];
+  } else if constexpr (kUseVectors<Bytes, T>) {
+    constexpr std::size_t L = Bytes / sizeof(T);
+    using W = typename Vec<S, L * sizeof(S)>::type;
+    W acc{};
+    for (; i + L <= n; i += L) {
+      W x = __builtin_convertvector(load<Bytes>(a + i), W);
+      if constexpr (Dot) x *= __builtin_convertvector(load<Bytes>(b + i), W);
+      acc += x;
+    }
+    for (std::size_t lane = 0; lane < L; ++lane) total += acc[lane];
+  }
+  for (; i < n; ++i) {
+    if constexpr (Dot) {
+      total += static_cast<S>(a[i]) * static_cast<S>(b[i]);
+    } else {
+      total += static_cast<S>(a[i]);
+    }
+  }
+  return total;
+}
+
+template <std::size_t Bytes, BitOp Op, typename T>
+__attribute__((always_inline)) inline void bitwise(T *dst, const T *src,
+                                                   std::size_t n) {
+  std::size_t i = 0;
+  if constexpr (kUseVectors<Bytes, T>) {
+    using V = typename Vec<T, Bytes>::type;
+    constexpr std::size_t L = Bytes / sizeof(T);
+    for (; i + L <= n; i += L) {
+      V x = load<Bytes>(dst + i), y = load<Bytes>(src + i);
+      if constexpr (Op == BitOp::kAnd) x &= y;
+      if constexpr (Op == BitOp::kOr) x |= y;
+      if constexpr (Op == BitOp::kXor) x ^= y;
+      if constexpr (Op == BitOp::kAndNot) x &= ~y;
+      store<Bytes>(dst + i) = x;
+    }
+  }
+  for (; i < n; ++i) {
+    if constexpr (Op == BitOp::kAnd) dst[i] &= src[i];
+    if constexpr (Op == BitOp::kOr) dst[i] |= src[i];
+    if constexpr (Op == BitOp::kXor) dst[i] ^= src[i];
+    if constexpr (Op == BitOp::kAndNot) dst[i] &= ~src[i];
+  }
+}
+
+// Векторного popcount в AVX2 нет, поэтому счёт идёт инструкцией popcnt по
+// словам (в обёртках run_256 и run_512 она доступна) в четыре независимых
+// счётчика. На ширине 0 и 128 бит popcnt не гарантирован, и
+// __builtin_popcountll там - программная последовательность.
+template <std::size_t Bytes, typename T>
+__attribute__((always_inline)) inline std::size_t popcount(const T *p,
+                                                           std::size_t n) {
+  std::size_t acc[4] = {};
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    for (std::size_t k = 0; k < 4; ++k) {
+      acc[k] += __builtin_popcountll(p[i + k]);
+    }
+  }
+  for (; i < n; ++i) acc[0] += __builtin_popcountll(p[i]);
+  return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+// Запуск ядра op(Width<Bytes>) с шириной по simd_level(). Обёртки для 256
+// и 512 бит собираются с AVX2 и AVX-512, поэтому вызываются, только если
+// процессор их поддерживает.
+#if defined(__x86_64__) || defined(__i386__)
+template <typename Op>
+__attribute__((target("avx2"))) auto run_256(const Op &op) {
+  return op(Width<32>());
+}
+
+template <typename Op>
+__attribute__((target("avx512f,avx512bw"))) auto run_512(const Op &op) {
+  return op(Width<64>());
+}
+#endif
+
+template <typename Op>
+auto run(const Op &op) {
+  switch (simd_level()) {
+#if defined(__x86_64__) || defined(__i386__)
+    case SimdLevel::k512:
+      return run_512(op);
+    case SimdLevel::k256:
+      return run_256(op);
+#endif
+    case SimdLevel::k128:
+      return op(Width<16>());
+    default:
+      return op(Width<0>());
+  }
+}
+
+inline std::atomic<SimdLevel> &level() {
+  static std::atomic<SimdLevel> current{simd_detect()};
+  return current;
+}
+
+}  // namespace bulk
+
+inline SimdLevel simd_detect() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+    return SimdLevel::k512;
+  }
+  if (__builtin_cpu_supports("avx2")) return SimdLevel::k256;
+  if (__builtin_cpu_supports("sse2")) return SimdLevel::k128;
+  return SimdLevel::kScalar;
+#else
+  // на других архитектурах 128-битные векторы GCC разворачивает в NEON и
+  // подобные наборы или в скалярный код
+  return SimdLevel::k128;
+#endif
+}
+
+inline SimdLevel simd_level() {
+  return bulk::level().load(std::memory_order_relaxed);
+}
+
+inline void set_simd_level(SimdLevel level) {
+  SimdLevel best = simd_detect();
+  if (static_cast<int>(level) > static_cast<int>(best)) level = best;
+  bulk::level().store(level, std::memory_order_relaxed);
+}
+
+template <typename T>
+void bulk_fill(T *first, std::size_t n, const T &value) {
+  bulk::run([&](auto width) __attribute__((always_inline)) {
+    bulk::fill<decltype(width)::value>(first, n, value);
+  });
+}
+
+template <typename T>
+void bulk_replace(T *first, std::size_t n, const T &old_value,
+                  const T &new_value) {
+  bulk::run([&](auto width) __attribute__((always_inline)) {
+    bulk::replace<decltype(width)::value>(first, n, old_value, new_value);
+  });
+}
+
+template <typename T>
+std::size_t bulk_find(const T *first, std::size_t n, const T &value) {
+  return bulk::run([&](auto width) __attribute__((always_inline)) {
+    return bulk::find<decltype(width)::value>(first, n, value);
+  });
+}
+
+template <typename T>
+std::size_t bulk_count(const T *first, std::size_t n, const T &value) {
+  return bulk::run([&](auto width) __attribute__((always_inline)) {
+    return bulk::count<decltype(width)::value>(first, n, value);
+  });
+}
+
+template <typename T>
+std::size_t bulk_mismatch(const T *a, const T *b, std::size_t n) {
+  return bulk::run([&](auto width) __attribute__((always_inline)) {
+    return bulk::mismatch<decltype(width)::value>(a, b, n);
+  });
+}
+
+template <typename T>
+bool bulk_equal(const T *a, const T *b, std::size_t n) {
+  return bulk_mismatch(a, b, n) == n;
+}
+
+// Первое несовпадение ищется векторно. Если на нём ни один элемент не
+// меньше другого (NaN), сравнение продолжается со следующего, как у
+// std::lexicographical_compare.
+template <typename T>
+int bulk_compare(const T *a, std::size_t na, const T *b, std::size_t nb) {
+  std::size_t n = na < nb ? na : nb;
+  for (std::size_t i = 0; i < n; ++i) {
+    i += bulk_mismatch(a + i, b + i, n - i);
+    if (i == n) break;
+    if (a[i] < b[i]) return -1;
+    if (b[i] < a[i]) return 1;
+  }
+  return na < nb ? -1 : (nb < na ? 1 : 0);
+}
+
+template <typename T>
+std::pair<T, T> bulk_minmax(const T *first, std::size_t n) {
+  if (n == 0) throw std::invalid_argument("empty range");
+  return bulk::run([&](auto width) __attribute__((always_inline)) {
+    return bulk::minmax<decltype(width)::value>(first, n);
+  });
+}
+
+template <typename T>
+T bulk_min(const T *first, std::size_t n) {
+  return bulk_minmax(first, n).first;
+}
+
+template <typename T>
+T bulk_max(const T *first, std::size_t n) {
+  return bulk_minmax(first, n).second;
+}
+
+template <typename T>
+typename BulkSum<T>::type bulk_sum(const T *first, std::size_t n) {
+  return bulk::run([&](auto width) __attribute__((always_inline)) {
+    return bulk::sum<decltype(width)::value, false>(first, first, n);
+  });
+}
+
+template <typename T>
+typename BulkSum<T>::type bulk_dot(const T *a, const T *b, std::size_t n) {
+  return bulk::run([&](auto width) __attribute__((always_inline)) {
+    return bulk::sum<decltype(width)::value, true>(a, b, n);
+  });
+}
+
+template <typename T>
+void bulk_bitwise(BitOp op, T *dst, const T *src, std::size_t n) {
+  static_assert(std::is_unsigned<T>::value, "bulk_bitwise needs unsigned T");
+  bulk::run([&](auto width) __attribute__((always_inline)) {
+    constexpr std::size_t kBytes = decltype(width)::value;
+    switch (op) {
+      case BitOp::kAnd:
+        bulk::bitwise<kBytes, BitOp::kAnd>(dst, src, n);
+        break;
+      case BitOp::kOr:
+        bulk::bitwise<kBytes, BitOp::kOr>(dst, src, n);
+        break;
+      case BitOp::kXor:
+        bulk::bitwise<kBytes, BitOp::kXor>(dst, src, n);
+        break;
+      case BitOp::kAndNot:
+        bulk::bitwise<kBytes, BitOp::kAndNot>(dst, src, n);
+        break;
+    }
+  });
+}
+
+template <typename T>
+std::size_t bulk_popcount(const T *first, std::size_t n) {
+  static_assert(std::is_unsigned<T>::value, "bulk_popcount needs unsigned T");
+  return bulk::run([&](auto width) __attribute__((always_inline)) {
+    return bulk::popcount<decltype(width)::value>(first, n);
+  });
+}
+
+template <typename Container>
+void bulk_fill(Container &c, const typename Container::value_type &value) {
+  bulk_fill(c.data(), c.size(), value);
+}
+
+template <typename Container>
+void bulk_replace(Container &c,
+                  const typename Container::value_type &old_value,
+                  const typename Container::value_type &new_value) {
+  bulk_replace(c.data(), c.size(), old_value, new_value);
+}
+
+template <typename Container>
+std::size_t bulk_find(const Container &c,
+                      const typename Container::value_type &value) {
+  return bulk_find(c.data(), c.size(), value);
+}
+
+template <typename Container>
+std::size_t bulk_count(const Container &c,
+                       const typename Container::value_type &value) {
+  return bulk_count(c.data(), c.size(), value);
+}
+
+template <typename Container>
+bool bulk_equal(const Container &a, const Container &b) {
+  return a.size() == b.size() && bulk_equal(a.data(), b.data(), a.size());
+}
+
+template <typename Container>
+int bulk_compare(const Container &a, const Container &b) {
+  return bulk_compare(a.data(), a.size(), b.data(), b.size());
+}
+
+template <typename Container>
+typename Container::value_type bulk_min(const Container &c) {
+  return bulk_min(c.data(), c.size());
+}
+
+template <typename Container>
+typename Container::value_type bulk_max(const Container &c) {
+  return bulk_max(c.data(), c.size());
+}
+
+template <typename Container>
+std::pair<typename Container::value_type, typename Container::value_type>
+bulk_minmax(const Container &c) {
+  return bulk_minmax(c.data(), c.size());
+}
+
+template <typename Container>
+typename BulkSum<typename Container::value_type>::type bulk_sum(
+    const Container &c) {
+  return bulk_sum(c.data(), c.size());
+}
+
+template <typename Container>
+typename BulkSum<typename Container::value_type>::type bulk_dot(
+    const Container &a, const Container &b) {
+  if (a.size() != b.size()) throw std::invalid_argument("size mismatch");
+  return bulk_dot(a.data(), b.data(), a.size());
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_BULK_OPS_H_
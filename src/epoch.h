@@ -0,0 +1,181 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_EPOCH_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_EPOCH_H_
+
+#include <atomic>     // для std::atomic
+#include <cstddef>    // для std::size_t
+#include <cstdint>    // для std::uint64_t
+#include <mutex>      // для std::mutex
+#include <stdexcept>  // для исключений
+#include <vector>     // для std::vector
+
+namespace s21 {
+// Освобождение памяти по эпохам для неблокирующих контейнеров. Поток, который
+// читает разделяемые узлы, держит EpochGuard: на это время его слот помечен
+// текущей глобальной эпохой. Узел, уже недостижимый из контейнера, отдаётся
+// в retire() с номером эпохи на момент удаления и освобождается, когда
+// глобальная эпоха уйдёт на два шага вперёд. Эпоха сдвигается, только когда
+// все активные потоки видели текущую, так что к этому моменту никто из
+// успевших прочитать узел его уже не держит.
+class EpochDomain {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type kMaxThreads = 256;
+  // после стольких retire() поток пробует сдвинуть эпоху и чистит свой список
+  static constexpr size_type kCollectEvery = 64;
+
+  static EpochDomain &global();
+
+  EpochDomain(const EpochDomain &) = delete;
+  EpochDomain &operator=(const EpochDomain &) = delete;
+  ~EpochDomain();
+
+  // вложенные pin/unpin одного потока допустимы
+  void pin();
+  void unpin();
+  void retire(void *ptr, void (*deleter)(void *));
+
+ private:
+  static constexpr std::uint64_t kIdle = 0;
+  static constexpr size_type kCacheLine = 64;
+
+  struct alignas(kCacheLine) Slot {
+    std::atomic<std::uint64_t> epoch_{kIdle};
+    std::atomic<bool> used_{false};
+  };
+
+  struct Retired {
+    void *ptr_;
+    void (*deleter_)(void *);
+    std::uint64_t epoch_;
+  };
+
+  // состояние потока: слот и ещё не освобождённые узлы; при завершении
+  // потока они переходят в общий список orphans_
+  struct Local {
+    EpochDomain *domain_{nullptr};
+    size_type slot_{kMaxThreads};
+    unsigned nesting_{0};
+    size_type since_collect_{0};
+    std::vector<Retired> retired_;
+    ~Local();
+  };
+
+  Slot slots_[kMaxThreads];
+  std::atomic<std::uint64_t> epoch_{1};
+  std::mutex orphans_mutex_;
+  std::vector<Retired> orphans_;
+
+  EpochDomain() {}
+
+  Local &local();
+  bool try_advance();
+  void collect(std::vector<Retired> *list);
+};
+
+// Держит текущий поток в эпохе, пока жив: узлы, прочитанные под ним, не
+// освобождаются. Копия тоже держит эпоху - так итераторы продлевают её.
+class EpochGuard {
+ public:
+  EpochGuard() { EpochDomain::global().pin(); }
+  EpochGuard(const EpochGuard &) { EpochDomain::global().pin(); }
+  EpochGuard &operator=(const EpochGuard &) { return *this; }
+  ~EpochGuard() { EpochDomain::global().unpin(); }
+};
+
+inline EpochDomain &EpochDomain::global() {
+  static EpochDomain domain;
+  return domain;
+}
+
+inline EpochDomain::~EpochDomain() {
+  for (Retired &item : orphans_) item.deleter_(item.ptr_);
+}
+
+inline EpochDomain::Local::~Local() {
+  if (domain_ == nullptr) return;
+  domain_->slots_[slot_].epoch_.store(kIdle, std::memory_order_release);
+  domain_->slots_[slot_].used_.store(false, std::memory_order_release);
+  std::lock_guard<std::mutex> lock(domain_->orphans_mutex_);
+  domain_->orphans_.insert(domain_->orphans_.end(), retired_.begin(),
+                           retired_.end());
+}
+
+inline EpochDomain::Local &EpochDomain::local() {
+  static thread_local Local state;
+  if (state.domain_ == nullptr) {
+    for (size_type i = 0; i < kMaxThreads; ++i) {
+      bool expected = false;
+      if (!slots_[i].used_.load(std::memory_order_relaxed) &&
+          slots_[i].used_.compare_exchange_strong(expected, true)) {
+        state.slot_ = i;
+        state.domain_ = this;
+        break;
+      }
+    }
+    if (state.domain_ == nullptr) {
+      throw std::length_error("too many threads for EpochDomain");
+    }
+  }
+  return state;
+}
+
+// Эпоха публикуется и перечитывается: если глобальная успела сдвинуться
+// между чтением и записью слота, поток входит в новую.
+inline void EpochDomain::pin() {
+  Local &state = local();
+  if (state.nesting_++ != 0) return;
+  Slot &slot = slots_[state.slot_];
+  std::uint64_t epoch = epoch_.load();
+  for (;;) {
+    slot.epoch_.store(epoch);
+    std::uint64_t now = epoch_.load();
+    if (now == epoch) break;
+    epoch = now;
+  }
+}
+
+inline void EpochDomain::unpin() {
+  Local &state = local();
+  if (--state.nesting_ == 0) {
+    slots_[state.slot_].epoch_.store(kIdle, std::memory_order_release);
+  }
+}
+
+inline void EpochDomain::retire(void *ptr, void (*deleter)(void *)) {
+  Local &state = local();
+  state.retired_.push_back({ptr, deleter, epoch_.load()});
+  if (++state.since_collect_ < kCollectEvery) return;
+  state.since_collect_ = 0;
+  try_advance();
+  collect(&state.retired_);
+  std::unique_lock<std::mutex> lock(orphans_mutex_, std::try_to_lock);
+  if (lock.owns_lock()) collect(&orphans_);
+}
+
+inline bool EpochDomain::try_advance() {
+  std::uint64_t epoch = epoch_.load();
+  for (Slot &slot : slots_) {
+    if (!slot.used_.load(std::memory_order_acquire)) continue;
+    std::uint64_t seen = slot.epoch_.load();
+    if (seen != kIdle && seen != epoch) return false;
+  }
+  return epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+inline void EpochDomain::collect(std::vector<Retired> *list) {
+  std::uint64_t epoch = epoch_.load();
+  size_type kept = 0;
+  for (Retired &item : *list) {
+    if (item.epoch_ + 2 <= epoch) {
+      item.deleter_(item.ptr_);
+    } else {
+      (*list)[kept++] = item;
+    }
+  }
+  list->resize(kept);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_EPOCH_H_
@@ -0,0 +1,143 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_EYTZINGER_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_EYTZINGER_H_
+
+#include <cstddef>  // для std::size_t
+#include <new>      // для std::align_val_t
+
+#include "memory_report.h"
+
+namespace s21 {
+// Раскладка Эйтцингера (порядок обхода в ширину) для static_set/static_map.
+// Массив нумеруется с 1, у узла k дети 2k и 2k + 1, а отсортированная
+// последовательность получается симметричным обходом. Первые уровни дерева
+// оказываются рядом в начале массива и остаются в кэше, а спуск не зависит
+// от исхода сравнений: k = 2k + (a[k] < key).
+
+// выравнивание массива: при нём потомки узла k через log2(B) уровней, где
+// B = 64 / sizeof(элемента), занимают ровно одну кэш-линию
+constexpr std::size_t kEytzingerAlign = 64;
+
+// индекс первого элемента в порядке сортировки (0 - пустой массив)
+inline std::size_t eytzinger_first(std::size_t n) {
+  std::size_t k = n ? 1 : 0;
+  while (k && 2 * k <= n) k *= 2;
+  return k;
+}
+
+// следующий в порядке сортировки; 0 - за последним
+inline std::size_t eytzinger_next(std::size_t k, std::size_t n) {
+  if (2 * k + 1 <= n) {
+    k = 2 * k + 1;
+    while (2 * k <= n) k *= 2;
+    return k;
+  }
+  // подняться, пока k - правый ребёнок, и ещё на уровень
+  return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+}
+
+// предыдущий в порядке сортировки; из 0 (конец) - последний элемент
+inline std::size_t eytzinger_prev(std::size_t k, std::size_t n) {
+  if (k == 0) {
+    k = n ? 1 : 0;
+    while (k && 2 * k + 1 <= n) k = 2 * k + 1;
+    return k;
+  }
+  if (2 * k <= n) {
+    k = 2 * k;
+    while (2 * k + 1 <= n) k = 2 * k + 1;
+    return k;
+  }
+  return k >> (__builtin_ctzll(static_cast<unsigned long long>(k)) + 1);
+}
+
+// Спуск без ветвлений: на каждом шаге подгружается кэш-линия с потомками
+// на log2(kStride) уровней ниже. В конце k - путь, где последний поворот
+// налево указывает на ответ: снимаем хвост поворотов направо и его.
+template <typename T, typename K, typename Compare>
+std::size_t eytzinger_lower_bound(const T *a, std::size_t n, const K &key,
+                                  const Compare &comp) {
+  constexpr std::size_t kStride =
+      sizeof(T) < kEytzingerAlign ? kEytzingerAlign / sizeof(T) : 1;
+  std::size_t k = 1;
+  while (k <= n) {
+    __builtin_prefetch(a + k * kStride);
+    k = 2 * k + comp(a[k], key);
+  }
+  return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+}
+
+template <typename T, typename K, typename Compare>
+std::size_t eytzinger_upper_bound(const T *a, std::size_t n, const K &key,
+                                  const Compare &comp) {
+  constexpr std::size_t kStride =
+      sizeof(T) < kEytzingerAlign ? kEytzingerAlign / sizeof(T) : 1;
+  std::size_t k = 1;
+  while (k <= n) {
+    __builtin_prefetch(a + k * kStride);
+    k = 2 * k + !comp(key, a[k]);
+  }
+  return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+}
+
+template <typename T>
+T *eytzinger_allocate(std::size_t n) {
+  return static_cast<T *>(::operator new((n + 1) * sizeof(T),
+                                         std::align_val_t(kEytzingerAlign)));
+}
+
+// Выделяет выровненный массив на n + 1 элемент (нулевой не используется и
+// не конструируется) и раскладывает в него отсортированные sorted[0..n).
+// sorted - указатель или итератор произвольного доступа; через
+// std::move_iterator элементы переносятся без копий.
+template <typename T, typename RandomIt>
+T *eytzinger_build(RandomIt sorted, std::size_t n) {
+  if (n == 0) return nullptr;
+  T *a = eytzinger_allocate<T>(n);
+  std::size_t k = eytzinger_first(n), i = 0;
+  try {
+    for (; i < n; ++i, k = eytzinger_next(k, n)) {
+      ::new (static_cast<void *>(a + k)) T(sorted[i]);
+    }
+  } catch (...) {
+    for (k = eytzinger_first(n); i--; k = eytzinger_next(k, n)) a[k].~T();
+    ::operator delete(a, std::align_val_t(kEytzingerAlign));
+    throw;
+  }
+  return a;
+}
+
+// копия уже разложенного массива, элемент в элемент
+template <typename T>
+T *eytzinger_copy(const T *other, std::size_t n) {
+  if (n == 0) return nullptr;
+  T *a = eytzinger_allocate<T>(n);
+  std::size_t k = 1;
+  try {
+    for (; k <= n; ++k) ::new (static_cast<void *>(a + k)) T(other[k]);
+  } catch (...) {
+    while (--k) a[k].~T();
+    ::operator delete(a, std::align_val_t(kEytzingerAlign));
+    throw;
+  }
+  return a;
+}
+
+// память массива из eytzinger_build: нулевая ячейка не занята
+template <typename T>
+MemoryReport eytzinger_report(std::size_t n) {
+  if (n == 0) return MemoryReport();
+  MemoryReport report = memory::array_report<T>(n, n + 1);
+  report.headers = memory::heap_overhead((n + 1) * sizeof(T));
+  return report;
+}
+
+template <typename T>
+void eytzinger_destroy(T *a, std::size_t n) {
+  if (a == nullptr) return;
+  for (std::size_t k = 1; k <= n; ++k) a[k].~T();
+  ::operator delete(a, std::align_val_t(kEytzingerAlign));
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_EYTZINGER_H_
@@ -0,0 +1,42 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_FLAT_SEARCH_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_FLAT_SEARCH_H_
+
+#include <cstddef>  // для std::size_t
+
+namespace s21 {
+// Бинарный поиск без ветвлений по отсортированному массиву для flat_map и
+// flat_set. Длина отрезка уменьшается на половину при любом исходе
+// сравнения, поэтому число итераций зависит только от n, а выбор половины
+// компилятор превращает в cmov вместо плохо предсказуемого перехода.
+
+// индекс первого элемента, не меньшего key
+template <typename T, typename K, typename Compare>
+std::size_t branchless_lower_bound(const T *first, std::size_t n, const K &key,
+                                   const Compare &comp) {
+  if (n == 0) return 0;
+  const T *base = first;
+  while (n > 1) {
+    std::size_t half = n / 2;
+    base = comp(base[half], key) ? base + half : base;
+    n -= half;
+  }
+  return static_cast<std::size_t>(base - first) + comp(*base, key);
+}
+
+// индекс первого элемента, большего key
+template <typename T, typename K, typename Compare>
+std::size_t branchless_upper_bound(const T *first, std::size_t n, const K &key,
+                                   const Compare &comp) {
+  if (n == 0) return 0;
+  const T *base = first;
+  while (n > 1) {
+    std::size_t half = n / 2;
+    base = comp(key, base[half]) ? base : base + half;
+    n -= half;
+  }
+  return static_cast<std::size_t>(base - first) + !comp(key, *base);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_FLAT_SEARCH_H_
@@ -0,0 +1,102 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_INSTRUMENT_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_INSTRUMENT_H_
+
+#include <atomic>   // для std::atomic
+#include <cstddef>  // для std::size_t
+
+namespace s21 {
+// Счётчики операций контейнеров. Собираются, только если вся программа
+// собрана с -DS21_INSTRUMENT (макрос должен быть одинаков во всех единицах
+// трансляции). Без него S21_RECORD не раскрывается ни во что, и контейнеры
+// компилируются в тот же код, что и без счётчиков.
+//
+// stack своей памяти не выделяет - её счётчики идут от его Container
+// (по умолчанию kVector); array не выделяет память вовсе.
+enum class Tracked { kVector, kList, kQueue, kMap, kSet, kMultiset, kCount };
+
+enum class Counter {
+  kAllocations,     // выделений блоков и узлов
+  kFrees,           // освобождений
+  kBytesAllocated,  // байт выделено
+  kReallocations,   // переездов массива в больший или меньший блок
+  kRelocatedBytes,  // байт перенесено при переездах
+  kRotations,       // поворотов RotateL / RotateR
+  kLookups,         // спусков по дереву: поиск, вставка, удаление
+  kNodeVisits,      // узлов пройдено при спусках
+  kComparisons,     // сравнений ключей при спусках
+  kDeleteCaseOne,   // случаи Case_to_delete_* при удалении
+  kDeleteCaseTwo,
+  kDeleteCaseThree,
+  kDeleteCaseFour,
+  kCount
+};
+
+// Приёмник счётчиков. record может вызываться из разных потоков, если
+// контейнеры используются из разных потоков.
+class InstrumentSink {
+ public:
+  virtual ~InstrumentSink() = default;
+  virtual void record(Tracked container, Counter counter,
+                      std::size_t amount) = 0;
+};
+
+// Готовый приёмник: суммирует всё в таблицу атомарных счётчиков.
+class CountingSink : public InstrumentSink {
+ public:
+  // определён в классе: иначе record стал бы ключевой функцией, и таблица
+  // виртуальных функций попадала бы в каждую единицу трансляции
+  void record(Tracked container, Counter counter,
+              std::size_t amount) override {
+    table_[static_cast<std::size_t>(container)]
+          [static_cast<std::size_t>(counter)]
+              .fetch_add(amount, std::memory_order_relaxed);
+  }
+  std::size_t get(Tracked container, Counter counter) const;
+  void reset();
+
+ private:
+  static constexpr std::size_t kContainers =
+      static_cast<std::size_t>(Tracked::kCount);
+  static constexpr std::size_t kCounters =
+      static_cast<std::size_t>(Counter::kCount);
+
+  std::atomic<std::size_t> table_[kContainers][kCounters] = {};
+};
+
+namespace instrument {
+// текущий приёмник; nullptr - счётчики отбрасываются
+inline std::atomic<InstrumentSink *> current_sink{nullptr};
+
+inline void set_sink(InstrumentSink *sink) {
+  current_sink.store(sink, std::memory_order_release);
+}
+
+inline void record(Tracked container, Counter counter, std::size_t amount) {
+  InstrumentSink *sink = current_sink.load(std::memory_order_acquire);
+  if (sink != nullptr) sink->record(container, counter, amount);
+}
+}  // namespace instrument
+
+inline std::size_t CountingSink::get(Tracked container,
+                                     Counter counter) const {
+  return table_[static_cast<std::size_t>(container)]
+               [static_cast<std::size_t>(counter)]
+                   .load(std::memory_order_relaxed);
+}
+
+inline void CountingSink::reset() {
+  for (auto &row : table_) {
+    for (auto &cell : row) cell.store(0, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace s21
+
+#ifdef S21_INSTRUMENT
+#define S21_RECORD(container, counter, amount) \
+  ::s21::instrument::record(container, counter, amount)
+#else
+#define S21_RECORD(container, counter, amount) ((void)0)
+#endif
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_INSTRUMENT_H_
@@ -0,0 +1,199 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_BTREE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_BTREE_H_
+
+#include <cstddef>      // для std::ptrdiff_t
+#include <iterator>     // для std::bidirectional_iterator_tag
+#include <type_traits>  // для std::remove_const
+#include <utility>      // для std::pair
+
+namespace s21 {
+// Двунаправленный итератор по B-дереву: пара (узел, номер ключа в узле).
+// Конец - node_ == nullptr, поэтому итератор помнит корень, чтобы из конца
+// можно было шагнуть назад. Для btree_map T - тип значения (const T у
+// константного итератора), и итератор разыменовывается в пару ссылок
+// (ключ, значение) из параллельных массивов узла; T = void - для множеств.
+template <typename Node, typename T>
+class BTreeIterator {
+ public:
+  using key_type = typename Node::key_type;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = std::pair<key_type, typename std::remove_const<T>::type>;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::pair<const key_type &, T &>;
+
+  // как у FlatMapIterator: временная пара ссылок для it->first/it->second
+  struct pointer {
+    reference ref_;
+    const reference *operator->() const { return &ref_; }
+  };
+
+  BTreeIterator() : root_(nullptr), node_(nullptr), pos_(0) {}
+  BTreeIterator(Node *root, Node *node, unsigned pos)
+      : root_(root), node_(node), pos_(pos) {}
+  template <typename U>
+  BTreeIterator(const BTreeIterator<Node, U> &other)
+      : root_(other.root_), node_(other.node_), pos_(other.pos_) {}
+
+  reference operator*() const {
+    return reference(*node_->key(pos_), *node_->value(pos_));
+  }
+  pointer operator->() const { return pointer{**this}; }
+
+  BTreeIterator &operator++();
+  BTreeIterator operator++(int);
+  BTreeIterator &operator--();
+  BTreeIterator operator--(int);
+
+  bool operator==(const BTreeIterator &other) const;
+  bool operator!=(const BTreeIterator &other) const;
+
+  Node *root_;
+  Node *node_;
+  unsigned pos_;
+};
+
+template <typename Node>
+class BTreeIterator<Node, void> {
+ public:
+  using key_type = typename Node::key_type;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = key_type;
+  using difference_type = std::ptrdiff_t;
+  using reference = const key_type &;
+  using pointer = const key_type *;
+
+  BTreeIterator() : root_(nullptr), node_(nullptr), pos_(0) {}
+  BTreeIterator(Node *root, Node *node, unsigned pos)
+      : root_(root), node_(node), pos_(pos) {}
+
+  reference operator*() const { return *node_->key(pos_); }
+  pointer operator->() const { return node_->key(pos_); }
+
+  BTreeIterator &operator++();
+  BTreeIterator operator++(int);
+  BTreeIterator &operator--();
+  BTreeIterator operator--(int);
+
+  bool operator==(const BTreeIterator &other) const;
+  bool operator!=(const BTreeIterator &other) const;
+
+  Node *root_;
+  Node *node_;
+  unsigned pos_;
+};
+
+// Переходы общие для обоих итераторов. Следующий за ключом pos внутреннего
+// узла - самый левый в правом от него поддереве; в листе - соседний, а
+// после последнего надо подниматься, пока узел был последним ребёнком.
+template <typename Node>
+void btree_increment(Node *&node, unsigned &pos) {
+  if (!node->leaf_) {
+    node = node->child(pos + 1);
+    while (!node->leaf_) node = node->child(0);
+    pos = 0;
+    return;
+  }
+  ++pos;
+  while (pos == node->count_) {
+    if (node->parent_ == nullptr) {
+      node = nullptr;
+      pos = 0;
+      return;
+    }
+    pos = node->position_;
+    node = node->parent_;
+  }
+}
+
+template <typename Node>
+void btree_decrement(Node *root, Node *&node, unsigned &pos) {
+  if (node == nullptr || !node->leaf_) {
+    node = node ? node->child(pos) : root;
+    while (!node->leaf_) node = node->child(node->count_);
+    pos = node->count_ - 1;
+    return;
+  }
+  if (pos > 0) {
+    --pos;
+    return;
+  }
+  while (node->parent_ && node->position_ == 0) node = node->parent_;
+  pos = node->position_ - 1;
+  node = node->parent_;
+}
+
+template <typename Node, typename T>
+BTreeIterator<Node, T> &BTreeIterator<Node, T>::operator++() {
+  btree_increment(node_, pos_);
+  return *this;
+}
+
+template <typename Node, typename T>
+BTreeIterator<Node, T> BTreeIterator<Node, T>::operator++(int) {
+  BTreeIterator ret = *this;
+  ++*this;
+  return ret;
+}
+
+template <typename Node, typename T>
+BTreeIterator<Node, T> &BTreeIterator<Node, T>::operator--() {
+  btree_decrement(root_, node_, pos_);
+  return *this;
+}
+
+template <typename Node, typename T>
+BTreeIterator<Node, T> BTreeIterator<Node, T>::operator--(int) {
+  BTreeIterator ret = *this;
+  --*this;
+  return ret;
+}
+
+template <typename Node, typename T>
+bool BTreeIterator<Node, T>::operator==(const BTreeIterator &other) const {
+  return node_ == other.node_ && pos_ == other.pos_;
+}
+
+template <typename Node, typename T>
+bool BTreeIterator<Node, T>::operator!=(const BTreeIterator &other) const {
+  return !(*this == other);
+}
+
+template <typename Node>
+BTreeIterator<Node, void> &BTreeIterator<Node, void>::operator++() {
+  btree_increment(node_, pos_);
+  return *this;
+}
+
+template <typename Node>
+BTreeIterator<Node, void> BTreeIterator<Node, void>::operator++(int) {
+  BTreeIterator ret = *this;
+  ++*this;
+  return ret;
+}
+
+template <typename Node>
+BTreeIterator<Node, void> &BTreeIterator<Node, void>::operator--() {
+  btree_decrement(root_, node_, pos_);
+  return *this;
+}
+
+template <typename Node>
+BTreeIterator<Node, void> BTreeIterator<Node, void>::operator--(int) {
+  BTreeIterator ret = *this;
+  --*this;
+  return ret;
+}
+
+template <typename Node>
+bool BTreeIterator<Node, void>::operator==(const BTreeIterator &other) const {
+  return node_ == other.node_ && pos_ == other.pos_;
+}
+
+template <typename Node>
+bool BTreeIterator<Node, void>::operator!=(const BTreeIterator &other) const {
+  return !(*this == other);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_BTREE_H_
@@ -0,0 +1,162 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_CIRCULAR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_CIRCULAR_H_
+
+#include <cstddef>   // для std::ptrdiff_t, std::size_t
+#include <iterator>  // для std::random_access_iterator_tag
+
+namespace s21 {
+// Итератор произвольного доступа по circular_buffer: контейнер и номер
+// элемента от начала буфера. Переход через конец памяти к её началу делает
+// operator[] контейнера, поэтому арифметика итератора - обычная, по номеру.
+// Owner - circular_buffer или const circular_buffer, T - тип элемента с той
+// же константностью.
+template <typename Owner, typename T>
+class CircularBufferIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename Owner::value_type;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using pointer = T *;
+
+  CircularBufferIterator() : owner_(nullptr), index_(0) {}
+  CircularBufferIterator(Owner *owner, std::size_t index)
+      : owner_(owner), index_(index) {}
+  template <typename O, typename U>
+  CircularBufferIterator(const CircularBufferIterator<O, U> &other)
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+  pointer operator->() const { return &(*owner_)[index_]; }
+  reference operator[](difference_type n) const;
+
+  CircularBufferIterator &operator++();
+  CircularBufferIterator operator++(int);
+  CircularBufferIterator &operator--();
+  CircularBufferIterator operator--(int);
+  CircularBufferIterator &operator+=(difference_type n);
+  CircularBufferIterator &operator-=(difference_type n);
+  CircularBufferIterator operator+(difference_type n) const;
+  CircularBufferIterator operator-(difference_type n) const;
+  difference_type operator-(const CircularBufferIterator &other) const;
+
+  bool operator==(const CircularBufferIterator &other) const;
+  bool operator!=(const CircularBufferIterator &other) const;
+  bool operator<(const CircularBufferIterator &other) const;
+  bool operator>(const CircularBufferIterator &other) const;
+  bool operator<=(const CircularBufferIterator &other) const;
+  bool operator>=(const CircularBufferIterator &other) const;
+
+  Owner *owner_;
+  std::size_t index_;
+};
+
+template <typename Owner, typename T>
+typename CircularBufferIterator<Owner, T>::reference
+CircularBufferIterator<Owner, T>::operator[](difference_type n) const {
+  return (*owner_)[index_ + n];
+}
+
+template <typename Owner, typename T>
+CircularBufferIterator<Owner, T>
+    &CircularBufferIterator<Owner, T>::operator++() {
+  ++index_;
+  return *this;
+}
+
+template <typename Owner, typename T>
+CircularBufferIterator<Owner, T> CircularBufferIterator<Owner, T>::operator++(
+    int) {
+  CircularBufferIterator ret = *this;
+  ++index_;
+  return ret;
+}
+
+template <typename Owner, typename T>
+CircularBufferIterator<Owner, T>
+    &CircularBufferIterator<Owner, T>::operator--() {
+  --index_;
+  return *this;
+}
+
+template <typename Owner, typename T>
+CircularBufferIterator<Owner, T> CircularBufferIterator<Owner, T>::operator--(
+    int) {
+  CircularBufferIterator ret = *this;
+  --index_;
+  return ret;
+}
+
+template <typename Owner, typename T>
+CircularBufferIterator<Owner, T> &CircularBufferIterator<Owner, T>::operator+=(
+    difference_type n) {
+  index_ += n;
+  return *this;
+}
+
+template <typename Owner, typename T>
+CircularBufferIterator<Owner, T> &CircularBufferIterator<Owner, T>::operator-=(
+    difference_type n) {
+  index_ -= n;
+  return *this;
+}
+
+template <typename Owner, typename T>
+CircularBufferIterator<Owner, T> CircularBufferIterator<Owner, T>::operator+(
+    difference_type n) const {
+  return CircularBufferIterator(owner_, index_ + n);
+}
+
+template <typename Owner, typename T>
+CircularBufferIterator<Owner, T> CircularBufferIterator<Owner, T>::operator-(
+    difference_type n) const {
+  return CircularBufferIterator(owner_, index_ - n);
+}
+
+template <typename Owner, typename T>
+typename CircularBufferIterator<Owner, T>::difference_type
+CircularBufferIterator<Owner, T>::operator-(
+    const CircularBufferIterator &other) const {
+  return static_cast<difference_type>(index_) -
+         static_cast<difference_type>(other.index_);
+}
+
+template <typename Owner, typename T>
+bool CircularBufferIterator<Owner, T>::operator==(
+    const CircularBufferIterator &other) const {
+  return index_ == other.index_;
+}
+
+template <typename Owner, typename T>
+bool CircularBufferIterator<Owner, T>::operator!=(
+    const CircularBufferIterator &other) const {
+  return index_ != other.index_;
+}
+
+template <typename Owner, typename T>
+bool CircularBufferIterator<Owner, T>::operator<(
+    const CircularBufferIterator &other) const {
+  return index_ < other.index_;
+}
+
+template <typename Owner, typename T>
+bool CircularBufferIterator<Owner, T>::operator>(
+    const CircularBufferIterator &other) const {
+  return index_ > other.index_;
+}
+
+template <typename Owner, typename T>
+bool CircularBufferIterator<Owner, T>::operator<=(
+    const CircularBufferIterator &other) const {
+  return index_ <= other.index_;
+}
+
+template <typename Owner, typename T>
+bool CircularBufferIterator<Owner, T>::operator>=(
+    const CircularBufferIterator &other) const {
+  return index_ >= other.index_;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_CIRCULAR_H_
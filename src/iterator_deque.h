@@ -0,0 +1,167 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_DEQUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_DEQUE_H_
+
+#include <cstddef>      // для std::size_t, std::ptrdiff_t
+#include <iterator>     // для std::random_access_iterator_tag
+#include <type_traits>  // для std::remove_const
+
+namespace s21 {
+// Итератор произвольного доступа по деку: хранит карту блоков и абсолютную
+// позицию элемента, блок и смещение в нём вычисляются сдвигом и маской.
+template <typename T, std::size_t Shift>
+class DequeIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename std::remove_const<T>::type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+  using size_type = std::size_t;
+
+  DequeIterator() : map_(nullptr), pos_(0) {}
+  DequeIterator(T *const *map, size_type pos) : map_(map), pos_(pos) {}
+  template <typename U>
+  DequeIterator(const DequeIterator<U, Shift> &other)
+      : map_(other.map_), pos_(other.pos_) {}
+
+  reference operator*() const;
+  pointer operator->() const;
+  reference operator[](difference_type n) const;
+
+  DequeIterator &operator++();
+  DequeIterator operator++(int);
+  DequeIterator &operator--();
+  DequeIterator operator--(int);
+  DequeIterator &operator+=(difference_type n);
+  DequeIterator &operator-=(difference_type n);
+  DequeIterator operator+(difference_type n) const;
+  DequeIterator operator-(difference_type n) const;
+  difference_type operator-(const DequeIterator &other) const;
+
+  bool operator==(const DequeIterator &other) const;
+  bool operator!=(const DequeIterator &other) const;
+  bool operator<(const DequeIterator &other) const;
+  bool operator>(const DequeIterator &other) const;
+  bool operator<=(const DequeIterator &other) const;
+  bool operator>=(const DequeIterator &other) const;
+
+  T *const *map_;
+  size_type pos_;
+};
+
+template <typename T, std::size_t Shift>
+typename DequeIterator<T, Shift>::reference DequeIterator<T, Shift>::operator*()
+    const {
+  return map_[pos_ >> Shift][pos_ & ((size_type(1) << Shift) - 1)];
+}
+
+template <typename T, std::size_t Shift>
+typename DequeIterator<T, Shift>::pointer DequeIterator<T, Shift>::operator->()
+    const {
+  return &**this;
+}
+
+template <typename T, std::size_t Shift>
+typename DequeIterator<T, Shift>::reference DequeIterator<T, Shift>::operator[](
+    difference_type n) const {
+  return *(*this + n);
+}
+
+template <typename T, std::size_t Shift>
+DequeIterator<T, Shift> &DequeIterator<T, Shift>::operator++() {
+  ++pos_;
+  return *this;
+}
+
+template <typename T, std::size_t Shift>
+DequeIterator<T, Shift> DequeIterator<T, Shift>::operator++(int) {
+  DequeIterator ret = *this;
+  ++pos_;
+  return ret;
+}
+
+template <typename T, std::size_t Shift>
+DequeIterator<T, Shift> &DequeIterator<T, Shift>::operator--() {
+  --pos_;
+  return *this;
+}
+
+template <typename T, std::size_t Shift>
+DequeIterator<T, Shift> DequeIterator<T, Shift>::operator--(int) {
+  DequeIterator ret = *this;
+  --pos_;
+  return ret;
+}
+
+template <typename T, std::size_t Shift>
+DequeIterator<T, Shift> &DequeIterator<T, Shift>::operator+=(
+    difference_type n) {
+  pos_ += n;
+  return *this;
+}
+
+template <typename T, std::size_t Shift>
+DequeIterator<T, Shift> &DequeIterator<T, Shift>::operator-=(
+    difference_type n) {
+  pos_ -= n;
+  return *this;
+}
+
+template <typename T, std::size_t Shift>
+DequeIterator<T, Shift> DequeIterator<T, Shift>::operator+(
+    difference_type n) const {
+  return DequeIterator(map_, pos_ + n);
+}
+
+template <typename T, std::size_t Shift>
+DequeIterator<T, Shift> DequeIterator<T, Shift>::operator-(
+    difference_type n) const {
+  return DequeIterator(map_, pos_ - n);
+}
+
+template <typename T, std::size_t Shift>
+typename DequeIterator<T, Shift>::difference_type
+DequeIterator<T, Shift>::operator-(const DequeIterator &other) const {
+  return static_cast<difference_type>(pos_ - other.pos_);
+}
+
+template <typename T, std::size_t Shift>
+bool DequeIterator<T, Shift>::operator==(const DequeIterator &other) const {
+  return pos_ == other.pos_;
+}
+
+template <typename T, std::size_t Shift>
+bool DequeIterator<T, Shift>::operator!=(const DequeIterator &other) const {
+  return pos_ != other.pos_;
+}
+
+template <typename T, std::size_t Shift>
+bool DequeIterator<T, Shift>::operator<(const DequeIterator &other) const {
+  return pos_ < other.pos_;
+}
+
+template <typename T, std::size_t Shift>
+bool DequeIterator<T, Shift>::operator>(const DequeIterator &other) const {
+  return pos_ > other.pos_;
+}
+
+template <typename T, std::size_t Shift>
+bool DequeIterator<T, Shift>::operator<=(const DequeIterator &other) const {
+  return pos_ <= other.pos_;
+}
+
+template <typename T, std::size_t Shift>
+bool DequeIterator<T, Shift>::operator>=(const DequeIterator &other) const {
+  return pos_ >= other.pos_;
+}
+
+template <typename T, std::size_t Shift>
+DequeIterator<T, Shift> operator+(
+    typename DequeIterator<T, Shift>::difference_type n,
+    const DequeIterator<T, Shift> &it) {
+  return it + n;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_DEQUE_H_
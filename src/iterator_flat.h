@@ -0,0 +1,171 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_FLAT_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_FLAT_H_
+
+#include <cstddef>      // для std::ptrdiff_t
+#include <iterator>     // для std::random_access_iterator_tag
+#include <type_traits>  // для std::remove_const
+#include <utility>      // для std::pair
+
+namespace s21 {
+// Итератор произвольного доступа по flat_map: ключи и значения лежат в
+// разных массивах, поэтому итератор держит по указателю на каждый и
+// разыменовывается в пару ссылок (ключ, значение), а не в ссылку на пару.
+template <typename Key, typename T>
+class FlatMapIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::pair<Key, typename std::remove_const<T>::type>;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::pair<const Key &, T &>;
+
+  // operator-> возвращает временную пару ссылок, обёрнутую так, чтобы
+  // it->first и it->second работали как у std::map
+  struct pointer {
+    reference ref_;
+    const reference *operator->() const { return &ref_; }
+  };
+
+  FlatMapIterator() : key_(nullptr), value_(nullptr) {}
+  FlatMapIterator(const Key *key, T *value) : key_(key), value_(value) {}
+  template <typename U>
+  FlatMapIterator(const FlatMapIterator<Key, U> &other)
+      : key_(other.key_), value_(other.value_) {}
+
+  reference operator*() const;
+  pointer operator->() const;
+  reference operator[](difference_type n) const;
+
+  FlatMapIterator &operator++();
+  FlatMapIterator operator++(int);
+  FlatMapIterator &operator--();
+  FlatMapIterator operator--(int);
+  FlatMapIterator &operator+=(difference_type n);
+  FlatMapIterator &operator-=(difference_type n);
+  FlatMapIterator operator+(difference_type n) const;
+  FlatMapIterator operator-(difference_type n) const;
+  difference_type operator-(const FlatMapIterator &other) const;
+
+  bool operator==(const FlatMapIterator &other) const;
+  bool operator!=(const FlatMapIterator &other) const;
+  bool operator<(const FlatMapIterator &other) const;
+  bool operator>(const FlatMapIterator &other) const;
+  bool operator<=(const FlatMapIterator &other) const;
+  bool operator>=(const FlatMapIterator &other) const;
+
+  const Key *key_;
+  T *value_;
+};
+
+template <typename Key, typename T>
+typename FlatMapIterator<Key, T>::reference FlatMapIterator<Key, T>::operator*()
+    const {
+  return reference(*key_, *value_);
+}
+
+template <typename Key, typename T>
+typename FlatMapIterator<Key, T>::pointer FlatMapIterator<Key, T>::operator->()
+    const {
+  return pointer{**this};
+}
+
+template <typename Key, typename T>
+typename FlatMapIterator<Key, T>::reference FlatMapIterator<Key, T>::operator[](
+    difference_type n) const {
+  return reference(key_[n], value_[n]);
+}
+
+template <typename Key, typename T>
+FlatMapIterator<Key, T> &FlatMapIterator<Key, T>::operator++() {
+  ++key_;
+  ++value_;
+  return *this;
+}
+
+template <typename Key, typename T>
+FlatMapIterator<Key, T> FlatMapIterator<Key, T>::operator++(int) {
+  FlatMapIterator ret = *this;
+  ++*this;
+  return ret;
+}
+
+template <typename Key, typename T>
+FlatMapIterator<Key, T> &FlatMapIterator<Key, T>::operator--() {
+  --key_;
+  --value_;
+  return *this;
+}
+
+template <typename Key, typename T>
+FlatMapIterator<Key, T> FlatMapIterator<Key, T>::operator--(int) {
+  FlatMapIterator ret = *this;
+  --*this;
+  return ret;
+}
+
+template <typename Key, typename T>
+FlatMapIterator<Key, T> &FlatMapIterator<Key, T>::operator+=(
+    difference_type n) {
+  key_ += n;
+  value_ += n;
+  return *this;
+}
+
+template <typename Key, typename T>
+FlatMapIterator<Key, T> &FlatMapIterator<Key, T>::operator-=(
+    difference_type n) {
+  key_ -= n;
+  value_ -= n;
+  return *this;
+}
+
+template <typename Key, typename T>
+FlatMapIterator<Key, T> FlatMapIterator<Key, T>::operator+(
+    difference_type n) const {
+  return FlatMapIterator(key_ + n, value_ + n);
+}
+
+template <typename Key, typename T>
+FlatMapIterator<Key, T> FlatMapIterator<Key, T>::operator-(
+    difference_type n) const {
+  return FlatMapIterator(key_ - n, value_ - n);
+}
+
+template <typename Key, typename T>
+typename FlatMapIterator<Key, T>::difference_type
+FlatMapIterator<Key, T>::operator-(const FlatMapIterator &other) const {
+  return key_ - other.key_;
+}
+
+template <typename Key, typename T>
+bool FlatMapIterator<Key, T>::operator==(const FlatMapIterator &other) const {
+  return key_ == other.key_;
+}
+
+template <typename Key, typename T>
+bool FlatMapIterator<Key, T>::operator!=(const FlatMapIterator &other) const {
+  return key_ != other.key_;
+}
+
+template <typename Key, typename T>
+bool FlatMapIterator<Key, T>::operator<(const FlatMapIterator &other) const {
+  return key_ < other.key_;
+}
+
+template <typename Key, typename T>
+bool FlatMapIterator<Key, T>::operator>(const FlatMapIterator &other) const {
+  return key_ > other.key_;
+}
+
+template <typename Key, typename T>
+bool FlatMapIterator<Key, T>::operator<=(const FlatMapIterator &other) const {
+  return key_ <= other.key_;
+}
+
+template <typename Key, typename T>
+bool FlatMapIterator<Key, T>::operator>=(const FlatMapIterator &other) const {
+  return key_ >= other.key_;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_FLAT_H_
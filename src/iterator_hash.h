@@ -0,0 +1,92 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_HASH_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_HASH_H_
+
+#include <cstddef>      // для std::ptrdiff_t
+#include <cstdint>      // для std::int8_t
+#include <iterator>     // для std::forward_iterator_tag
+#include <type_traits>  // для std::remove_const
+
+namespace s21 {
+// Прямой итератор по хеш-таблице: идёт параллельно по управляющим байтам и
+// слотам, пропуская пустые и удалённые (управляющий байт < 0).
+template <typename Slot>
+class HashIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename std::remove_const<Slot>::type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Slot *;
+  using reference = Slot &;
+
+  HashIterator() : ctrl_(nullptr), end_(nullptr), slot_(nullptr) {}
+  HashIterator(const std::int8_t *ctrl, const std::int8_t *end, Slot *slot)
+      : ctrl_(ctrl), end_(end), slot_(slot) {
+    skip_empty();
+  }
+  template <typename U>
+  HashIterator(const HashIterator<U> &other)
+      : ctrl_(other.ctrl_), end_(other.end_), slot_(other.slot_) {}
+
+  reference operator*() const;
+  pointer operator->() const;
+
+  HashIterator &operator++();
+  HashIterator operator++(int);
+
+  bool operator==(const HashIterator &other) const;
+  bool operator!=(const HashIterator &other) const;
+
+  const std::int8_t *ctrl_;
+  const std::int8_t *end_;
+  Slot *slot_;
+
+ private:
+  void skip_empty();
+};
+
+template <typename Slot>
+void HashIterator<Slot>::skip_empty() {
+  while (ctrl_ != end_ && *ctrl_ < 0) {
+    ++ctrl_;
+    ++slot_;
+  }
+}
+
+template <typename Slot>
+typename HashIterator<Slot>::reference HashIterator<Slot>::operator*() const {
+  return *slot_;
+}
+
+template <typename Slot>
+typename HashIterator<Slot>::pointer HashIterator<Slot>::operator->() const {
+  return slot_;
+}
+
+template <typename Slot>
+HashIterator<Slot> &HashIterator<Slot>::operator++() {
+  ++ctrl_;
+  ++slot_;
+  skip_empty();
+  return *this;
+}
+
+template <typename Slot>
+HashIterator<Slot> HashIterator<Slot>::operator++(int) {
+  HashIterator ret = *this;
+  ++*this;
+  return ret;
+}
+
+template <typename Slot>
+bool HashIterator<Slot>::operator==(const HashIterator &other) const {
+  return ctrl_ == other.ctrl_;
+}
+
+template <typename Slot>
+bool HashIterator<Slot>::operator!=(const HashIterator &other) const {
+  return ctrl_ != other.ctrl_;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_HASH_H_
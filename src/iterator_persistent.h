@@ -0,0 +1,101 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_PERSISTENT_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_PERSISTENT_H_
+
+#include <cstddef>   // для std::ptrdiff_t
+#include <iterator>  // для std::forward_iterator_tag
+
+#include "node_persistent.h"
+
+namespace s21 {
+// Прямой итератор по версии persistent_map/persistent_set. Ссылок на
+// родителя в узлах нет (узел делят несколько версий), поэтому итератор
+// хранит путь: стек узлов, в левое поддерево которых мы спустились, и на
+// вершине - текущий. Пустой стек - конец: end() только обнуляет depth_, а
+// копирование переносит лишь занятую часть стека. Итератор действителен,
+// пока жива версия, из которой он получен; элементы через него не меняются.
+template <typename Value>
+class PersistentIterator {
+ public:
+  using Node = PersistentNode<Value>;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = Value;
+  using difference_type = std::ptrdiff_t;
+  using reference = const Value &;
+  using pointer = const Value *;
+
+  // высота AVL-дерева не больше 1.44 * log2(n + 2), для 64-битного
+  // размера - меньше 96
+  static constexpr int kMaxHeight = 96;
+
+  PersistentIterator() {}
+  PersistentIterator(const PersistentIterator &other);
+  PersistentIterator &operator=(const PersistentIterator &other);
+
+  reference operator*() const { return stack_[depth_ - 1]->value_; }
+  pointer operator->() const { return &stack_[depth_ - 1]->value_; }
+
+  PersistentIterator &operator++();
+  PersistentIterator operator++(int);
+
+  bool operator==(const PersistentIterator &other) const;
+  bool operator!=(const PersistentIterator &other) const;
+
+  // спуск по левому краю поддерева node с запоминанием пути
+  void push_left(const Node *node);
+  void push(const Node *node) { stack_[depth_++] = node; }
+
+ private:
+  // действительны только первые depth_ ячеек
+  const Node *stack_[kMaxHeight];
+  int depth_{0};
+};
+
+template <typename Value>
+PersistentIterator<Value>::PersistentIterator(const PersistentIterator &other)
+    : depth_(other.depth_) {
+  for (int i = 0; i < depth_; ++i) stack_[i] = other.stack_[i];
+}
+
+template <typename Value>
+PersistentIterator<Value> &PersistentIterator<Value>::operator=(
+    const PersistentIterator &other) {
+  depth_ = other.depth_;
+  for (int i = 0; i < depth_; ++i) stack_[i] = other.stack_[i];
+  return *this;
+}
+
+template <typename Value>
+PersistentIterator<Value> &PersistentIterator<Value>::operator++() {
+  const Node *node = stack_[--depth_];
+  push_left(node->right_.get());
+  return *this;
+}
+
+template <typename Value>
+PersistentIterator<Value> PersistentIterator<Value>::operator++(int) {
+  PersistentIterator ret = *this;
+  ++*this;
+  return ret;
+}
+
+template <typename Value>
+bool PersistentIterator<Value>::operator==(
+    const PersistentIterator &other) const {
+  if (depth_ == 0 || other.depth_ == 0) return depth_ == other.depth_;
+  return stack_[depth_ - 1] == other.stack_[other.depth_ - 1];
+}
+
+template <typename Value>
+bool PersistentIterator<Value>::operator!=(
+    const PersistentIterator &other) const {
+  return !(*this == other);
+}
+
+template <typename Value>
+void PersistentIterator<Value>::push_left(const Node *node) {
+  for (; node; node = node->left_.get()) push(node);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_PERSISTENT_H_
@@ -0,0 +1,82 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_SKIPLIST_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_SKIPLIST_H_
+
+#include <cstddef>   // для std::ptrdiff_t
+#include <iterator>  // для std::forward_iterator_tag
+#include <utility>   // для std::pair
+
+#include "epoch.h"
+#include "node_skiplist.h"
+
+namespace s21 {
+// Прямой итератор по нижнему уровню concurrent_map. Слабо согласованный:
+// пропускает удалённые узлы и может увидеть или не увидеть элементы,
+// вставленные во время обхода, но каждый элемент - не больше одного раза и
+// по порядку ключей. Итератор держит EpochGuard, поэтому узел под ним не
+// освобождается; его нельзя передавать в другой поток, а долго живущий
+// итератор задерживает освобождение памяти во всём контейнере.
+template <typename Key, typename T>
+class SkipListIterator {
+ public:
+  using Node = SkipListNode<Key, T>;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::pair<Key, T>;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::pair<const Key &, const T &>;
+
+  // как у FlatMapIterator: временная пара ссылок для it->first/it->second
+  struct pointer {
+    reference ref_;
+    const reference *operator->() const { return &ref_; }
+  };
+
+  SkipListIterator() : node_(nullptr) {}
+  explicit SkipListIterator(Node *node) : node_(node) {}
+
+  reference operator*() const { return reference(node_->key_, node_->value_); }
+  pointer operator->() const { return pointer{**this}; }
+
+  SkipListIterator &operator++();
+  SkipListIterator operator++(int);
+
+  bool operator==(const SkipListIterator &other) const;
+  bool operator!=(const SkipListIterator &other) const;
+
+  Node *node_;
+
+ private:
+  EpochGuard guard_;
+};
+
+template <typename Key, typename T>
+SkipListIterator<Key, T> &SkipListIterator<Key, T>::operator++() {
+  Node *node = skip_pointer<Node>(node_->next()[0].load());
+  while (node && skip_marked(node->next()[0].load())) {
+    node = skip_pointer<Node>(node->next()[0].load());
+  }
+  node_ = node;
+  return *this;
+}
+
+template <typename Key, typename T>
+SkipListIterator<Key, T> SkipListIterator<Key, T>::operator++(int) {
+  SkipListIterator ret = *this;
+  ++*this;
+  return ret;
+}
+
+template <typename Key, typename T>
+bool SkipListIterator<Key, T>::operator==(
+    const SkipListIterator &other) const {
+  return node_ == other.node_;
+}
+
+template <typename Key, typename T>
+bool SkipListIterator<Key, T>::operator!=(
+    const SkipListIterator &other) const {
+  return node_ != other.node_;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_SKIPLIST_H_
@@ -0,0 +1,155 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_SOA_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_SOA_H_
+
+#include <cstddef>   // для std::ptrdiff_t, std::size_t
+#include <iterator>  // для std::random_access_iterator_tag
+
+namespace s21 {
+// Итератор произвольного доступа по soa_vector: контейнер и номер записи.
+// Поля записи лежат в разных столбцах, поэтому итератор разыменовывается
+// в кортеж ссылок на поля (Ref), а не в ссылку на кортеж - как
+// FlatMapIterator с его парой ссылок.
+template <typename Owner, typename Ref>
+class SoaIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename Owner::value_type;
+  using difference_type = std::ptrdiff_t;
+  using reference = Ref;
+
+  // operator-> возвращает временный кортеж ссылок
+  struct pointer {
+    reference ref_;
+    const reference *operator->() const { return &ref_; }
+  };
+
+  SoaIterator() : owner_(nullptr), index_(0) {}
+  SoaIterator(Owner *owner, std::size_t index)
+      : owner_(owner), index_(index) {}
+  template <typename O, typename R>
+  SoaIterator(const SoaIterator<O, R> &other)
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+  pointer operator->() const { return pointer{(*owner_)[index_]}; }
+  reference operator[](difference_type n) const;
+
+  SoaIterator &operator++();
+  SoaIterator operator++(int);
+  SoaIterator &operator--();
+  SoaIterator operator--(int);
+  SoaIterator &operator+=(difference_type n);
+  SoaIterator &operator-=(difference_type n);
+  SoaIterator operator+(difference_type n) const;
+  SoaIterator operator-(difference_type n) const;
+  difference_type operator-(const SoaIterator &other) const;
+
+  bool operator==(const SoaIterator &other) const;
+  bool operator!=(const SoaIterator &other) const;
+  bool operator<(const SoaIterator &other) const;
+  bool operator>(const SoaIterator &other) const;
+  bool operator<=(const SoaIterator &other) const;
+  bool operator>=(const SoaIterator &other) const;
+
+  Owner *owner_;
+  std::size_t index_;
+};
+
+template <typename Owner, typename Ref>
+typename SoaIterator<Owner, Ref>::reference
+SoaIterator<Owner, Ref>::operator[](difference_type n) const {
+  return (*owner_)[index_ + n];
+}
+
+template <typename Owner, typename Ref>
+SoaIterator<Owner, Ref> &SoaIterator<Owner, Ref>::operator++() {
+  ++index_;
+  return *this;
+}
+
+template <typename Owner, typename Ref>
+SoaIterator<Owner, Ref> SoaIterator<Owner, Ref>::operator++(int) {
+  SoaIterator ret = *this;
+  ++index_;
+  return ret;
+}
+
+template <typename Owner, typename Ref>
+SoaIterator<Owner, Ref> &SoaIterator<Owner, Ref>::operator--() {
+  --index_;
+  return *this;
+}
+
+template <typename Owner, typename Ref>
+SoaIterator<Owner, Ref> SoaIterator<Owner, Ref>::operator--(int) {
+  SoaIterator ret = *this;
+  --index_;
+  return ret;
+}
+
+template <typename Owner, typename Ref>
+SoaIterator<Owner, Ref> &SoaIterator<Owner, Ref>::operator+=(
+    difference_type n) {
+  index_ += n;
+  return *this;
+}
+
+template <typename Owner, typename Ref>
+SoaIterator<Owner, Ref> &SoaIterator<Owner, Ref>::operator-=(
+    difference_type n) {
+  index_ -= n;
+  return *this;
+}
+
+template <typename Owner, typename Ref>
+SoaIterator<Owner, Ref> SoaIterator<Owner, Ref>::operator+(
+    difference_type n) const {
+  return SoaIterator(owner_, index_ + n);
+}
+
+template <typename Owner, typename Ref>
+SoaIterator<Owner, Ref> SoaIterator<Owner, Ref>::operator-(
+    difference_type n) const {
+  return SoaIterator(owner_, index_ - n);
+}
+
+template <typename Owner, typename Ref>
+typename SoaIterator<Owner, Ref>::difference_type
+SoaIterator<Owner, Ref>::operator-(const SoaIterator &other) const {
+  return static_cast<difference_type>(index_) -
+         static_cast<difference_type>(other.index_);
+}
+
+template <typename Owner, typename Ref>
+bool SoaIterator<Owner, Ref>::operator==(const SoaIterator &other) const {
+  return index_ == other.index_;
+}
+
+template <typename Owner, typename Ref>
+bool SoaIterator<Owner, Ref>::operator!=(const SoaIterator &other) const {
+  return index_ != other.index_;
+}
+
+template <typename Owner, typename Ref>
+bool SoaIterator<Owner, Ref>::operator<(const SoaIterator &other) const {
+  return index_ < other.index_;
+}
+
+template <typename Owner, typename Ref>
+bool SoaIterator<Owner, Ref>::operator>(const SoaIterator &other) const {
+  return index_ > other.index_;
+}
+
+template <typename Owner, typename Ref>
+bool SoaIterator<Owner, Ref>::operator<=(const SoaIterator &other) const {
+  return index_ <= other.index_;
+}
+
+template <typename Owner, typename Ref>
+bool SoaIterator<Owner, Ref>::operator>=(const SoaIterator &other) const {
+  return index_ >= other.index_;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_SOA_H_
@@ -0,0 +1,160 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_STABLE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_STABLE_H_
+
+#include <cstddef>   // для std::ptrdiff_t, std::size_t
+#include <iterator>  // для std::random_access_iterator_tag
+
+namespace s21 {
+// Итератор произвольного доступа по stable_vector: контейнер и номер
+// элемента. Каталог кусков при росте переезжает, поэтому указатель на него
+// итератор не хранит, и после push_back итераторы остаются действительными.
+// Owner - stable_vector или const stable_vector, T - тип элемента с той же
+// константностью.
+template <typename Owner, typename T>
+class StableVectorIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename Owner::value_type;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using pointer = T *;
+
+  StableVectorIterator() : owner_(nullptr), index_(0) {}
+  StableVectorIterator(Owner *owner, std::size_t index)
+      : owner_(owner), index_(index) {}
+  template <typename O, typename U>
+  StableVectorIterator(const StableVectorIterator<O, U> &other)
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+  pointer operator->() const { return &(*owner_)[index_]; }
+  reference operator[](difference_type n) const;
+
+  StableVectorIterator &operator++();
+  StableVectorIterator operator++(int);
+  StableVectorIterator &operator--();
+  StableVectorIterator operator--(int);
+  StableVectorIterator &operator+=(difference_type n);
+  StableVectorIterator &operator-=(difference_type n);
+  StableVectorIterator operator+(difference_type n) const;
+  StableVectorIterator operator-(difference_type n) const;
+  difference_type operator-(const StableVectorIterator &other) const;
+
+  bool operator==(const StableVectorIterator &other) const;
+  bool operator!=(const StableVectorIterator &other) const;
+  bool operator<(const StableVectorIterator &other) const;
+  bool operator>(const StableVectorIterator &other) const;
+  bool operator<=(const StableVectorIterator &other) const;
+  bool operator>=(const StableVectorIterator &other) const;
+
+  Owner *owner_;
+  std::size_t index_;
+};
+
+template <typename Owner, typename T>
+typename StableVectorIterator<Owner, T>::reference
+StableVectorIterator<Owner, T>::operator[](difference_type n) const {
+  return (*owner_)[index_ + n];
+}
+
+template <typename Owner, typename T>
+StableVectorIterator<Owner, T> &StableVectorIterator<Owner, T>::operator++() {
+  ++index_;
+  return *this;
+}
+
+template <typename Owner, typename T>
+StableVectorIterator<Owner, T> StableVectorIterator<Owner, T>::operator++(
+    int) {
+  StableVectorIterator ret = *this;
+  ++index_;
+  return ret;
+}
+
+template <typename Owner, typename T>
+StableVectorIterator<Owner, T> &StableVectorIterator<Owner, T>::operator--() {
+  --index_;
+  return *this;
+}
+
+template <typename Owner, typename T>
+StableVectorIterator<Owner, T> StableVectorIterator<Owner, T>::operator--(
+    int) {
+  StableVectorIterator ret = *this;
+  --index_;
+  return ret;
+}
+
+template <typename Owner, typename T>
+StableVectorIterator<Owner, T> &StableVectorIterator<Owner, T>::operator+=(
+    difference_type n) {
+  index_ += n;
+  return *this;
+}
+
+template <typename Owner, typename T>
+StableVectorIterator<Owner, T> &StableVectorIterator<Owner, T>::operator-=(
+    difference_type n) {
+  index_ -= n;
+  return *this;
+}
+
+template <typename Owner, typename T>
+StableVectorIterator<Owner, T> StableVectorIterator<Owner, T>::operator+(
+    difference_type n) const {
+  return StableVectorIterator(owner_, index_ + n);
+}
+
+template <typename Owner, typename T>
+StableVectorIterator<Owner, T> StableVectorIterator<Owner, T>::operator-(
+    difference_type n) const {
+  return StableVectorIterator(owner_, index_ - n);
+}
+
+template <typename Owner, typename T>
+typename StableVectorIterator<Owner, T>::difference_type
+StableVectorIterator<Owner, T>::operator-(
+    const StableVectorIterator &other) const {
+  return static_cast<difference_type>(index_) -
+         static_cast<difference_type>(other.index_);
+}
+
+template <typename Owner, typename T>
+bool StableVectorIterator<Owner, T>::operator==(
+    const StableVectorIterator &other) const {
+  return index_ == other.index_;
+}
+
+template <typename Owner, typename T>
+bool StableVectorIterator<Owner, T>::operator!=(
+    const StableVectorIterator &other) const {
+  return index_ != other.index_;
+}
+
+template <typename Owner, typename T>
+bool StableVectorIterator<Owner, T>::operator<(
+    const StableVectorIterator &other) const {
+  return index_ < other.index_;
+}
+
+template <typename Owner, typename T>
+bool StableVectorIterator<Owner, T>::operator>(
+    const StableVectorIterator &other) const {
+  return index_ > other.index_;
+}
+
+template <typename Owner, typename T>
+bool StableVectorIterator<Owner, T>::operator<=(
+    const StableVectorIterator &other) const {
+  return index_ <= other.index_;
+}
+
+template <typename Owner, typename T>
+bool StableVectorIterator<Owner, T>::operator>=(
+    const StableVectorIterator &other) const {
+  return index_ >= other.index_;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_STABLE_H_
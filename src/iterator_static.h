@@ -0,0 +1,157 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_STATIC_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_STATIC_H_
+
+#include <cstddef>   // для std::size_t, std::ptrdiff_t
+#include <iterator>  // для std::bidirectional_iterator_tag
+#include <utility>   // для std::pair
+
+#include "eytzinger.h"
+
+namespace s21 {
+// Двунаправленный итератор по массиву в раскладке Эйтцингера: обходит его
+// в порядке сортировки (симметричный обход), индекс 0 - конец. Mapped =
+// void для static_set, иначе итератор разыменовывается в пару ссылок
+// (ключ, значение) из параллельных массивов static_map.
+template <typename Key, typename Mapped>
+class StaticIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = std::pair<Key, Mapped>;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::pair<const Key &, const Mapped &>;
+  using size_type = std::size_t;
+
+  struct pointer {
+    reference ref_;
+    const reference *operator->() const { return &ref_; }
+  };
+
+  StaticIterator() : keys_(nullptr), values_(nullptr), n_(0), k_(0) {}
+  StaticIterator(const Key *keys, const Mapped *values, size_type n,
+                 size_type k)
+      : keys_(keys), values_(values), n_(n), k_(k) {}
+
+  reference operator*() const { return reference(keys_[k_], values_[k_]); }
+  pointer operator->() const { return pointer{**this}; }
+
+  StaticIterator &operator++();
+  StaticIterator operator++(int);
+  StaticIterator &operator--();
+  StaticIterator operator--(int);
+
+  bool operator==(const StaticIterator &other) const;
+  bool operator!=(const StaticIterator &other) const;
+
+  const Key *keys_;
+  const Mapped *values_;
+  size_type n_;
+  size_type k_;
+};
+
+template <typename Key>
+class StaticIterator<Key, void> {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = Key;
+  using difference_type = std::ptrdiff_t;
+  using reference = const Key &;
+  using pointer = const Key *;
+  using size_type = std::size_t;
+
+  StaticIterator() : keys_(nullptr), n_(0), k_(0) {}
+  StaticIterator(const Key *keys, size_type n, size_type k)
+      : keys_(keys), n_(n), k_(k) {}
+
+  reference operator*() const { return keys_[k_]; }
+  pointer operator->() const { return keys_ + k_; }
+
+  StaticIterator &operator++();
+  StaticIterator operator++(int);
+  StaticIterator &operator--();
+  StaticIterator operator--(int);
+
+  bool operator==(const StaticIterator &other) const;
+  bool operator!=(const StaticIterator &other) const;
+
+  const Key *keys_;
+  size_type n_;
+  size_type k_;
+};
+
+template <typename Key, typename Mapped>
+StaticIterator<Key, Mapped> &StaticIterator<Key, Mapped>::operator++() {
+  k_ = eytzinger_next(k_, n_);
+  return *this;
+}
+
+template <typename Key, typename Mapped>
+StaticIterator<Key, Mapped> StaticIterator<Key, Mapped>::operator++(int) {
+  StaticIterator ret = *this;
+  ++*this;
+  return ret;
+}
+
+template <typename Key, typename Mapped>
+StaticIterator<Key, Mapped> &StaticIterator<Key, Mapped>::operator--() {
+  k_ = eytzinger_prev(k_, n_);
+  return *this;
+}
+
+template <typename Key, typename Mapped>
+StaticIterator<Key, Mapped> StaticIterator<Key, Mapped>::operator--(int) {
+  StaticIterator ret = *this;
+  --*this;
+  return ret;
+}
+
+template <typename Key, typename Mapped>
+bool StaticIterator<Key, Mapped>::operator==(
+    const StaticIterator &other) const {
+  return k_ == other.k_;
+}
+
+template <typename Key, typename Mapped>
+bool StaticIterator<Key, Mapped>::operator!=(
+    const StaticIterator &other) const {
+  return k_ != other.k_;
+}
+
+template <typename Key>
+StaticIterator<Key, void> &StaticIterator<Key, void>::operator++() {
+  k_ = eytzinger_next(k_, n_);
+  return *this;
+}
+
+template <typename Key>
+StaticIterator<Key, void> StaticIterator<Key, void>::operator++(int) {
+  StaticIterator ret = *this;
+  ++*this;
+  return ret;
+}
+
+template <typename Key>
+StaticIterator<Key, void> &StaticIterator<Key, void>::operator--() {
+  k_ = eytzinger_prev(k_, n_);
+  return *this;
+}
+
+template <typename Key>
+StaticIterator<Key, void> StaticIterator<Key, void>::operator--(int) {
+  StaticIterator ret = *this;
+  --*this;
+  return ret;
+}
+
+template <typename Key>
+bool StaticIterator<Key, void>::operator==(const StaticIterator &other) const {
+  return k_ == other.k_;
+}
+
+template <typename Key>
+bool StaticIterator<Key, void>::operator!=(const StaticIterator &other) const {
+  return k_ != other.k_;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ITERATOR_STATIC_H_
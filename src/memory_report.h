@@ -0,0 +1,100 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_MEMORY_REPORT_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_MEMORY_REPORT_H_
+
+#include <cstddef>      // для std::size_t
+#include <cstdint>      // для SIZE_MAX, UINT64_MAX
+#include <cstdlib>      // для __GLIBC__
+#include <type_traits>  // для std::is_trivially_destructible
+#include <utility>      // для std::pair
+
+namespace s21 {
+// Сколько памяти занимает контейнер, по статьям, в байтах. Сумма всех
+// статей - memory_usage() контейнера.
+struct MemoryReport {
+  std::size_t payload{0};   // сами элементы: ключи и значения
+  std::size_t pointers{0};  // указатели и индексы, связывающие узлы
+  std::size_t control{0};   // служебные поля: цвет, счётчики, флаги
+  std::size_t padding{0};   // выравнивание внутри узлов и элементов
+  std::size_t slack{0};     // выделено под элементы, но не занято ими
+  std::size_t headers{0};   // заголовки блоков распределителя (оценка)
+  std::size_t object{0};    // сам объект контейнера, кроме учтённого выше
+
+  std::size_t total() const;
+  MemoryReport &operator+=(const MemoryReport &other);
+};
+
+inline std::size_t MemoryReport::total() const {
+  return payload + pointers + control + padding + slack + headers + object;
+}
+
+inline MemoryReport &MemoryReport::operator+=(const MemoryReport &other) {
+  payload += other.payload;
+  pointers += other.pointers;
+  control += other.control;
+  padding += other.padding;
+  slack += other.slack;
+  headers += other.headers;
+  object += other.object;
+  return *this;
+}
+
+namespace memory {
+// полезные байты типа: у std::pair - сумма полей без выравнивания между ними
+template <typename T>
+struct payload_size {
+  static constexpr std::size_t value = sizeof(T);
+};
+
+template <typename A, typename B>
+struct payload_size<std::pair<A, B>> {
+  static constexpr std::size_t value =
+      payload_size<A>::value + payload_size<B>::value;
+};
+
+// Служебная часть блока, выделенного operator new на bytes байт. Известна
+// для glibc malloc на 64-битных системах: 8 байт размера перед блоком,
+// блок округляется вверх до 16 и занимает не меньше 32 байт. Для других
+// распределителей и для std::pmr-ресурсов (арена заголовков не хранит)
+// оценки нет, и возвращается 0.
+inline std::size_t heap_overhead(std::size_t bytes) {
+#if defined(__GLIBC__) && SIZE_MAX == UINT64_MAX
+  std::size_t chunk = (bytes + 8 + 15) & ~std::size_t{15};
+  if (chunk < 32) chunk = 32;
+  return chunk - bytes;
+#else
+  (void)bytes;
+  return 0;
+#endif
+}
+
+// new T[n] для типа с нетривиальным деструктором хранит перед массивом
+// число элементов (Itanium C++ ABI)
+template <typename T>
+constexpr std::size_t array_cookie() {
+  if (std::is_trivially_destructible<T>::value) return 0;
+  return alignof(T) > sizeof(std::size_t) ? alignof(T) : sizeof(std::size_t);
+}
+
+// заголовки массива из new T[capacity]; без массива - 0
+template <typename T>
+std::size_t array_overhead(std::size_t capacity) {
+  if (capacity == 0) return 0;
+  std::size_t cookie = array_cookie<T>();
+  return cookie + heap_overhead(capacity * sizeof(T) + cookie);
+}
+
+// size элементов в массиве на capacity ячеек; заголовки и объект
+// заполняет контейнер
+template <typename T>
+MemoryReport array_report(std::size_t size, std::size_t capacity) {
+  MemoryReport report;
+  report.payload = size * payload_size<T>::value;
+  report.padding = size * (sizeof(T) - payload_size<T>::value);
+  report.slack = (capacity - size) * sizeof(T);
+  return report;
+}
+}  // namespace memory
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_MEMORY_REPORT_H_
@@ -0,0 +1,166 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_MEMORY_SOURCE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_MEMORY_SOURCE_H_
+
+#include <cstddef>          // для std::size_t
+#include <cstdint>          // для std::uintptr_t
+#include <memory_resource>  // для std::pmr::memory_resource
+#include <new>              // для placement new
+#include <type_traits>      // для std::is_trivially_destructible
+#include <utility>          // для std::forward
+
+#include "instrument.h"
+
+namespace s21 {
+// Откуда контейнер берёт память под узлы и массивы - параметр шаблона
+// Source у vector, list и дерева map/set/multiset. Контейнер наследует
+// Source, поэтому пустой HeapSource (по умолчанию) не добавляет к объекту
+// ни байта: это те же new/delete, что были в контейнерах раньше.
+// ResourceSource берёт память у std::pmr::memory_resource (обычно
+// s21::arena); им пользуются только контейнеры из s21::pmr.
+struct HeapSource {
+  // у блоков из кучи есть заголовки распределителя (см. memory_report)
+  static constexpr bool kFromHeap = true;
+
+  bool skip_destroy() const { return false; }
+  bool same_source(const HeapSource &) const { return true; }
+
+  template <typename T, typename... Args>
+  T *create(Args &&...args) const {
+    return new T(std::forward<Args>(args)...);
+  }
+  template <typename T>
+  void destroy(T *ptr) const {
+    delete ptr;
+  }
+  // как new T[n] и delete[]: элементы инициализируются по умолчанию
+  template <typename T>
+  T *create_array(std::size_t n) const {
+    return new T[n];
+  }
+  template <typename T>
+  void destroy_array(T *ptr, std::size_t) const {
+    delete[] ptr;
+  }
+};
+
+// Ресурс и флаг skip_destroy в одном слове: memory_resource - полиморфный
+// объект, он выровнен минимум по указателю, и младший бит адреса свободен.
+// skip_destroy разрешает деструктору контейнера не обходить узлы: их память
+// арена вернёт разом в reset(), а деструкторы элементов ничего не делают.
+class ResourceSource {
+ public:
+  static constexpr bool kFromHeap = false;
+
+  ResourceSource() : ResourceSource(std::pmr::get_default_resource(), false) {}
+  ResourceSource(std::pmr::memory_resource *resource, bool skip_destroy)
+      : bits_(reinterpret_cast<std::uintptr_t>(resource) |
+              (skip_destroy ? kSkipBit : 0U)) {}
+
+  std::pmr::memory_resource *resource() const {
+    return reinterpret_cast<std::pmr::memory_resource *>(bits_ & ~kSkipBit);
+  }
+  bool skip_destroy() const { return bits_ & kSkipBit; }
+  // память одного источника можно передавать между контейнерами
+  bool same_source(const ResourceSource &other) const {
+    return resource()->is_equal(*other.resource());
+  }
+
+  template <typename T, typename... Args>
+  T *create(Args &&...args) const;
+  template <typename T>
+  void destroy(T *ptr) const;
+  template <typename T>
+  T *create_array(std::size_t n) const;
+  template <typename T>
+  void destroy_array(T *ptr, std::size_t n) const;
+
+ private:
+  static constexpr std::uintptr_t kSkipBit = 1U;
+
+  std::uintptr_t bits_;
+};
+
+template <typename T, typename... Args>
+T *ResourceSource::create(Args &&...args) const {
+  void *memory = resource()->allocate(sizeof(T), alignof(T));
+  try {
+    return ::new (memory) T(std::forward<Args>(args)...);
+  } catch (...) {
+    resource()->deallocate(memory, sizeof(T), alignof(T));
+    throw;
+  }
+}
+
+template <typename T>
+void ResourceSource::destroy(T *ptr) const {
+  if (ptr != nullptr) {
+    ptr->~T();
+    resource()->deallocate(ptr, sizeof(T), alignof(T));
+  }
+}
+
+template <typename T>
+T *ResourceSource::create_array(std::size_t n) const {
+  T *ptr = static_cast<T *>(resource()->allocate(n * sizeof(T), alignof(T)));
+  std::size_t done = 0;
+  try {
+    for (; done < n; ++done) ::new (ptr + done) T;
+  } catch (...) {
+    while (done != 0) ptr[--done].~T();
+    resource()->deallocate(ptr, n * sizeof(T), alignof(T));
+    throw;
+  }
+  return ptr;
+}
+
+template <typename T>
+void ResourceSource::destroy_array(T *ptr, std::size_t n) const {
+  if (ptr != nullptr) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+      for (std::size_t i = 0; i < n; ++i) ptr[i].~T();
+    }
+    resource()->deallocate(ptr, n * sizeof(T), alignof(T));
+  }
+}
+
+// Source контейнера Kind: с S21_INSTRUMENT считает выделения и
+// освобождения, без него - тот же Source
+#ifdef S21_INSTRUMENT
+template <Tracked Kind, typename Source>
+struct TrackedSource : Source {
+  TrackedSource() = default;
+  TrackedSource(const Source &memory) : Source(memory) {}
+
+  template <typename T, typename... Args>
+  T *create(Args &&...args) const {
+    T *ptr = Source::template create<T>(std::forward<Args>(args)...);
+    S21_RECORD(Kind, Counter::kAllocations, 1);
+    S21_RECORD(Kind, Counter::kBytesAllocated, sizeof(T));
+    return ptr;
+  }
+  template <typename T>
+  void destroy(T *ptr) const {
+    if (ptr != nullptr) S21_RECORD(Kind, Counter::kFrees, 1);
+    Source::destroy(ptr);
+  }
+  template <typename T>
+  T *create_array(std::size_t n) const {
+    T *ptr = Source::template create_array<T>(n);
+    S21_RECORD(Kind, Counter::kAllocations, 1);
+    S21_RECORD(Kind, Counter::kBytesAllocated, n * sizeof(T));
+    return ptr;
+  }
+  template <typename T>
+  void destroy_array(T *ptr, std::size_t n) const {
+    if (ptr != nullptr) S21_RECORD(Kind, Counter::kFrees, 1);
+    Source::destroy_array(ptr, n);
+  }
+};
+#else
+template <Tracked Kind, typename Source>
+using TrackedSource = Source;
+#endif
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_MEMORY_SOURCE_H_
@@ -0,0 +1,66 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_NODE_BTREE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_NODE_BTREE_H_
+
+#include <cstddef>  // для std::size_t
+
+namespace s21 {
+// значение-заглушка для btree_set/btree_multiset, у которых нет значений
+struct BTreeNoValue {};
+
+template <typename Key, typename Mapped, std::size_t N>
+struct BTreeInternalNode;
+
+// Узел B-дерева: до N ключей подряд в одном массиве (поиск по ним -
+// линейный просмотр) и параллельный массив значений. Место рассчитано на
+// N + 1 элемент, чтобы вставка могла сначала переполнить узел и только
+// потом разделить его. Память под элементы сырая: конструируются только
+// первые count_.
+template <typename Key, typename Mapped, std::size_t N>
+struct BTreeNode {
+  using key_type = Key;
+  using mapped_type = Mapped;
+
+  BTreeNode *parent_{nullptr};
+  unsigned position_{0};  // номер среди детей родителя
+  unsigned count_{0};
+  bool leaf_{true};
+  alignas(Key) unsigned char keys_[(N + 1) * sizeof(Key)];
+  alignas(Mapped) unsigned char values_[(N + 1) * sizeof(Mapped)];
+
+  Key *key(std::size_t i) { return reinterpret_cast<Key *>(keys_) + i; }
+  const Key *key(std::size_t i) const {
+    return reinterpret_cast<const Key *>(keys_) + i;
+  }
+  Mapped *value(std::size_t i) {
+    return reinterpret_cast<Mapped *>(values_) + i;
+  }
+  const Mapped *value(std::size_t i) const {
+    return reinterpret_cast<const Mapped *>(values_) + i;
+  }
+  // только для внутренних узлов (leaf_ == false)
+  BTreeNode *&child(std::size_t i);
+  BTreeNode *child(std::size_t i) const;
+};
+
+// внутренний узел: к листу добавлены N + 2 указателя на детей
+template <typename Key, typename Mapped, std::size_t N>
+struct BTreeInternalNode : BTreeNode<Key, Mapped, N> {
+  BTreeInternalNode() { this->leaf_ = false; }
+  BTreeNode<Key, Mapped, N> *children_[N + 2]{};
+};
+
+template <typename Key, typename Mapped, std::size_t N>
+BTreeNode<Key, Mapped, N> *&BTreeNode<Key, Mapped, N>::child(std::size_t i) {
+  return static_cast<BTreeInternalNode<Key, Mapped, N> *>(this)->children_[i];
+}
+
+template <typename Key, typename Mapped, std::size_t N>
+BTreeNode<Key, Mapped, N> *BTreeNode<Key, Mapped, N>::child(
+    std::size_t i) const {
+  return static_cast<const BTreeInternalNode<Key, Mapped, N> *>(this)
+      ->children_[i];
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_NODE_BTREE_H_
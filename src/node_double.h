@@ -9,7 +9,7 @@ class node_double {
   node_double *next_;
   node_double *prev_;
 
-  node_double() : value_(0), next_(nullptr), prev_(nullptr) {}
+  node_double() : value_(), next_(nullptr), prev_(nullptr) {}
   explicit node_double(T val) : value_(val), next_(nullptr), prev_(nullptr) {}
 };
 }  // namespace s21
@@ -0,0 +1,32 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_NODE_PERSISTENT_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_NODE_PERSISTENT_H_
+
+#include <memory>  // для std::shared_ptr
+
+namespace s21 {
+// Неизменяемый узел AVL-дерева для persistent_map/persistent_set. После
+// создания узел не меняется, поэтому его можно делить между сколькими
+// угодно версиями дерева; счётчик ссылок shared_ptr атомарный, и версии
+// можно отдавать в другие потоки.
+template <typename Value>
+struct PersistentNode {
+  using NodePtr = std::shared_ptr<const PersistentNode>;
+
+  Value value_;
+  NodePtr left_;
+  NodePtr right_;
+  int height_;
+
+  PersistentNode(const Value &value, NodePtr left, NodePtr right)
+      : value_(value),
+        left_(std::move(left)),
+        right_(std::move(right)),
+        height_(1 + (height(left_) > height(right_) ? height(left_)
+                                                    : height(right_))) {}
+
+  static int height(const NodePtr &node) { return node ? node->height_ : 0; }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_NODE_PERSISTENT_H_
@@ -0,0 +1,68 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_NODE_SKIPLIST_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_NODE_SKIPLIST_H_
+
+#include <atomic>   // для std::atomic
+#include <cstddef>  // для std::size_t
+#include <cstdint>  // для std::uintptr_t
+#include <new>      // для placement new
+
+namespace s21 {
+// Ссылка на следующий узел в списке одного уровня. Младший бит - метка
+// "узел-владелец ссылки удалён на этом уровне": помеченная ссылка больше не
+// меняется, а сам узел вырезают из списка CAS-ом по ссылке предшественника.
+using SkipLink = std::atomic<std::uintptr_t>;
+
+// Узел списка с пропусками: ключ, значение и height_ ссылок, которые лежат
+// сразу за узлом в той же аллокации. owners_ - сколько операций ещё
+// работают с узлом (вставка, пока связывает верхние уровни, и сам факт
+// присутствия в списке); последняя из них вырезает узел и отдаёт его в
+// EpochDomain.
+template <typename Key, typename T>
+struct alignas(SkipLink) SkipListNode {
+  Key key_;
+  T value_;
+  int height_;
+  std::atomic<int> owners_{2};
+
+  SkipListNode(const Key &key, const T &value, int height)
+      : key_(key), value_(value), height_(height) {}
+
+  SkipLink *next() { return reinterpret_cast<SkipLink *>(this + 1); }
+
+  static SkipListNode *create(const Key &key, const T &value, int height) {
+    void *memory =
+        ::operator new(sizeof(SkipListNode) + height * sizeof(SkipLink));
+    SkipListNode *node;
+    try {
+      node = ::new (memory) SkipListNode(key, value, height);
+    } catch (...) {
+      ::operator delete(memory);
+      throw;
+    }
+    for (int i = 0; i < height; ++i) ::new (node->next() + i) SkipLink(0);
+    return node;
+  }
+
+  // подходит как deleter для EpochDomain::retire
+  static void destroy(void *ptr) {
+    SkipListNode *node = static_cast<SkipListNode *>(ptr);
+    node->~SkipListNode();
+    ::operator delete(ptr);
+  }
+};
+
+inline bool skip_marked(std::uintptr_t link) { return link & 1U; }
+
+template <typename Node>
+Node *skip_pointer(std::uintptr_t link) {
+  return reinterpret_cast<Node *>(link & ~static_cast<std::uintptr_t>(1));
+}
+
+template <typename Node>
+std::uintptr_t skip_link(Node *node) {
+  return reinterpret_cast<std::uintptr_t>(node);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_NODE_SKIPLIST_H_
@@ -0,0 +1,350 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_ARENA_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_ARENA_H_
+
+#include <cstddef>           // для std::size_t, std::max_align_t
+#include <cstdint>           // для std::uintptr_t
+#include <initializer_list>  // для std::initializer_list
+#include <memory_resource>   // для std::pmr::memory_resource
+#include <stdexcept>         // для исключений
+#include <type_traits>       // для std::is_trivially_destructible
+#include <utility>           // для std::move
+
+#include "memory_source.h"
+#include "s21_list.h"
+#include "s21_map.h"
+#include "s21_multiset.h"
+#include "s21_set.h"
+#include "s21_stack.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Монотонный источник памяти: выделение - сдвиг указателя внутри текущего
+// блока, освобождение отдельных кусков ничего не делает. reset() разом
+// возвращает всё выделенное, оставляя блоки арене для следующего цикла
+// (например, следующего запроса), release() отдаёт блоки upstream. Блоки
+// растут вдвое, начиная с block_size. Арена не потокобезопасна.
+class arena : public std::pmr::memory_resource {
+ public:
+  using size_type = std::size_t;
+
+  explicit arena(size_type block_size = 64 * 1024,
+                 std::pmr::memory_resource *upstream =
+                     std::pmr::new_delete_resource());
+  arena(const arena &) = delete;
+  arena &operator=(const arena &) = delete;
+  ~arena() override;
+
+  void reset();
+  void release();
+
+  // байт выдано с последнего reset() и байт во всех блоках
+  size_type used() const;
+  size_type reserved() const;
+
+ protected:
+  void *do_allocate(size_type bytes, size_type alignment) override;
+  void do_deallocate(void *ptr, size_type bytes, size_type alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override;
+
+ private:
+  static constexpr size_type kMaxBlock = size_type{1} << 26;
+
+  // заголовок в начале каждого блока
+  struct Block {
+    Block *next_;
+    size_type size_;
+  };
+
+  // текущий блок - первый в used_blocks_
+  Block *used_blocks_{nullptr};
+  Block *free_blocks_{nullptr};
+  char *cursor_{nullptr};
+  char *end_{nullptr};
+  size_type first_block_;
+  size_type block_size_;
+  size_type used_{0U};
+  size_type reserved_{0U};
+  std::pmr::memory_resource *upstream_;
+
+  void *bump(size_type bytes, size_type alignment);
+  void next_block(size_type bytes, size_type alignment);
+  void free_list(Block *list);
+};
+
+inline arena::arena(size_type block_size, std::pmr::memory_resource *upstream)
+    : first_block_(block_size < 256 ? 256 : block_size),
+      block_size_(first_block_),
+      upstream_(upstream) {}
+
+inline arena::~arena() { release(); }
+
+inline void arena::reset() {
+  while (used_blocks_) {
+    Block *next = used_blocks_->next_;
+    used_blocks_->next_ = free_blocks_;
+    free_blocks_ = used_blocks_;
+    used_blocks_ = next;
+  }
+  cursor_ = end_ = nullptr;
+  used_ = 0;
+}
+
+inline void arena::release() {
+  free_list(used_blocks_);
+  free_list(free_blocks_);
+  used_blocks_ = free_blocks_ = nullptr;
+  cursor_ = end_ = nullptr;
+  used_ = reserved_ = 0;
+  block_size_ = first_block_;
+}
+
+inline arena::size_type arena::used() const { return used_; }
+
+inline arena::size_type arena::reserved() const { return reserved_; }
+
+inline void *arena::do_allocate(size_type bytes, size_type alignment) {
+  if (bytes == 0) bytes = 1;
+  void *ptr = bump(bytes, alignment);
+  if (ptr == nullptr) {
+    next_block(bytes, alignment);
+    ptr = bump(bytes, alignment);
+  }
+  used_ += bytes;
+  return ptr;
+}
+
+inline void arena::do_deallocate(void *, size_type, size_type) {}
+
+inline bool arena::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+// nullptr, если в текущем блоке не хватает места
+inline void *arena::bump(size_type bytes, size_type alignment) {
+  std::uintptr_t start = reinterpret_cast<std::uintptr_t>(cursor_);
+  start = (start + alignment - 1) & ~(std::uintptr_t{alignment} - 1);
+  std::uintptr_t end = reinterpret_cast<std::uintptr_t>(end_);
+  if (cursor_ == nullptr || start > end || end - start < bytes) return nullptr;
+  cursor_ = reinterpret_cast<char *>(start + bytes);
+  return reinterpret_cast<void *>(start);
+}
+
+// сначала подходящий блок из оставшихся после reset(), иначе новый
+inline void arena::next_block(size_type bytes, size_type alignment) {
+  size_type need = sizeof(Block) + bytes + alignment;
+  Block **link = &free_blocks_;
+  while (*link && (*link)->size_ < need) link = &(*link)->next_;
+  Block *block = *link;
+  if (block) {
+    *link = block->next_;
+  } else {
+    size_type size = block_size_ < need ? need : block_size_;
+    block = static_cast<Block *>(
+        upstream_->allocate(size, alignof(std::max_align_t)));
+    block->size_ = size;
+    reserved_ += size;
+    if (block_size_ < kMaxBlock) block_size_ *= 2;
+  }
+  block->next_ = used_blocks_;
+  used_blocks_ = block;
+  cursor_ = reinterpret_cast<char *>(block + 1);
+  end_ = reinterpret_cast<char *>(block) + block->size_;
+}
+
+inline void arena::free_list(Block *list) {
+  while (list) {
+    Block *next = list->next_;
+    upstream_->deallocate(list, list->size_, alignof(std::max_align_t));
+    list = next;
+  }
+}
+
+// Контейнеры, память которых берётся из std::pmr::memory_resource, обычно
+// из s21::arena. Это те же s21::vector, list, map, set и multiset (и stack
+// поверх pmr::vector), только ресурс задаётся в конструкторе. Копия берёт
+// ресурс оригинала, перемещение и swap переносят ресурс вместе с
+// элементами. list::merge и list::splice перецепляют узлы, поэтому между
+// списками с разными ресурсами бросают std::invalid_argument; pmr-список с
+// обычным не смешать - это разные типы. merge у map, set и multiset
+// копирует элементы и работает с любыми ресурсами.
+namespace pmr {
+
+// kSkip: деструктор контейнера не обходит элементы - для арены, которая
+// потом будет сброшена целиком. Разрешён только с s21::arena и только для
+// тривиально разрушаемых элементов, иначе std::invalid_argument.
+enum class DestroyMode { kDestroy, kSkip };
+
+template <typename... Elements>
+ResourceSource make_source(std::pmr::memory_resource *resource,
+                           DestroyMode mode) {
+  if (resource == nullptr) throw std::invalid_argument("null memory resource");
+  if (mode == DestroyMode::kSkip) {
+    if (dynamic_cast<arena *>(resource) == nullptr) {
+      throw std::invalid_argument("skip destroy needs an s21::arena");
+    }
+    if (!(std::is_trivially_destructible<Elements>::value && ...)) {
+      throw std::invalid_argument(
+          "skip destroy needs trivially destructible elements");
+    }
+  }
+  return ResourceSource(resource, mode == DestroyMode::kSkip);
+}
+
+template <typename T>
+class vector : public s21::vector<T, ResourceSource> {
+ public:
+  using value_type = T;
+
+  explicit vector(std::pmr::memory_resource *resource,
+                  DestroyMode mode = DestroyMode::kDestroy)
+      : s21::vector<T, ResourceSource>(make_source<T>(resource, mode)) {}
+  vector(std::initializer_list<value_type> const &items,
+         std::pmr::memory_resource *resource,
+         DestroyMode mode = DestroyMode::kDestroy)
+      : vector(resource, mode) {
+    this->reserve(items.size());
+    for (auto &item : items) this->push_back(item);
+  }
+  vector(const vector &v) : s21::vector<T, ResourceSource>(v.memory()) {
+    this->reserve(v.size());
+    for (std::size_t i = 0; i < v.size(); ++i) this->push_back(v[i]);
+  }
+  vector(vector &&v) = default;
+  vector &operator=(vector &&v) = default;
+
+  std::pmr::memory_resource *resource() const {
+    return this->memory().resource();
+  }
+};
+
+template <typename T>
+class list : public s21::list<T, ResourceSource> {
+ public:
+  using value_type = T;
+
+  explicit list(std::pmr::memory_resource *resource,
+                DestroyMode mode = DestroyMode::kDestroy)
+      : s21::list<T, ResourceSource>(make_source<T>(resource, mode)) {}
+  list(std::initializer_list<value_type> const &items,
+       std::pmr::memory_resource *resource,
+       DestroyMode mode = DestroyMode::kDestroy)
+      : list(resource, mode) {
+    for (auto &item : items) this->push_back(item);
+  }
+  list(const list &l) : s21::list<T, ResourceSource>(l, l.memory()) {}
+  list(list &&l) = default;
+  list &operator=(list &&l) = default;
+
+  std::pmr::memory_resource *resource() const {
+    return this->memory().resource();
+  }
+};
+
+template <typename Key, typename T>
+class map : public s21::map<Key, T, ResourceSource> {
+ public:
+  using value_type = typename s21::map<Key, T, ResourceSource>::value_type;
+
+  explicit map(std::pmr::memory_resource *resource,
+               DestroyMode mode = DestroyMode::kDestroy)
+      : s21::map<Key, T, ResourceSource>(make_source<Key, T>(resource, mode)) {}
+  map(std::initializer_list<value_type> const &items,
+      std::pmr::memory_resource *resource,
+      DestroyMode mode = DestroyMode::kDestroy)
+      : map(resource, mode) {
+    for (auto &item : items) this->insert(item);
+  }
+  map(const map &m) : s21::map<Key, T, ResourceSource>(m.memory()) {
+    for (auto it = m.begin(); it != m.end(); ++it) {
+      this->insert(it.ptr_->_key, it.ptr_->_value);
+    }
+  }
+  map(map &&m) : s21::map<Key, T, ResourceSource>(m.memory()) { this->swap(m); }
+  map &operator=(map &&m) {
+    if (this != &m) {
+      map tmp(std::move(m));
+      this->swap(tmp);
+    }
+    return *this;
+  }
+
+  std::pmr::memory_resource *resource() const {
+    return this->memory().resource();
+  }
+};
+
+template <typename Key>
+class set : public s21::set<Key, ResourceSource> {
+ public:
+  using value_type = Key;
+
+  explicit set(std::pmr::memory_resource *resource,
+               DestroyMode mode = DestroyMode::kDestroy)
+      : s21::set<Key, ResourceSource>(make_source<Key>(resource, mode)) {}
+  set(std::initializer_list<value_type> const &items,
+      std::pmr::memory_resource *resource,
+      DestroyMode mode = DestroyMode::kDestroy)
+      : set(resource, mode) {
+    for (auto &item : items) this->insert(item);
+  }
+  set(const set &s) : s21::set<Key, ResourceSource>(s.memory()) {
+    for (auto it = s.begin(); it != s.end(); ++it) this->insert(*it);
+  }
+  set(set &&s) : s21::set<Key, ResourceSource>(s.memory()) { this->swap(s); }
+  set &operator=(set &&s) {
+    if (this != &s) {
+      set tmp(std::move(s));
+      this->swap(tmp);
+    }
+    return *this;
+  }
+
+  std::pmr::memory_resource *resource() const {
+    return this->memory().resource();
+  }
+};
+
+template <typename Key>
+class multiset : public s21::multiset<Key, ResourceSource> {
+ public:
+  using value_type = Key;
+
+  explicit multiset(std::pmr::memory_resource *resource,
+                    DestroyMode mode = DestroyMode::kDestroy)
+      : s21::multiset<Key, ResourceSource>(make_source<Key>(resource, mode)) {}
+  multiset(std::initializer_list<value_type> const &items,
+           std::pmr::memory_resource *resource,
+           DestroyMode mode = DestroyMode::kDestroy)
+      : multiset(resource, mode) {
+    for (auto &item : items) this->insert(item);
+  }
+  multiset(const multiset &ms)
+      : s21::multiset<Key, ResourceSource>(ms.memory()) {
+    for (auto it = ms.begin(); it != ms.end(); ++it) this->insert(*it);
+  }
+  multiset(multiset &&ms) : s21::multiset<Key, ResourceSource>(ms.memory()) {
+    this->swap(ms);
+  }
+  multiset &operator=(multiset &&ms) {
+    if (this != &ms) {
+      multiset tmp(std::move(ms));
+      this->swap(tmp);
+    }
+    return *this;
+  }
+
+  std::pmr::memory_resource *resource() const {
+    return this->memory().resource();
+  }
+};
+
+// стек поверх pmr::vector: s21::pmr::stack<int> s{pmr::vector<int>(&arena)}
+template <typename T>
+using stack = s21::stack<T, vector<T>>;
+
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_ARENA_H_
@@ -3,8 +3,16 @@
 
 #include <cstddef>           // для std::size_t
 #include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::move
+
+#include "bulk_ops.h"
+#include "memory_report.h"
 
 namespace s21 {
+// Элементы лежат внутри объекта, без выделения памяти. Копирование,
+// перемещение и деструктор - по умолчанию, поэтому array тривиально
+// копируется, если тривиально копируется T, и годится для constexpr.
 template <typename T, std::size_t n>
 class array {
  public:
@@ -15,169 +23,238 @@ class array {
   using const_iterator = const value_type *;
   using size_type = std::size_t;
 
-  array();
-  explicit array(std::initializer_list<value_type> const &items);
-  array(const array &a);
-  array(array &&a);
-  ~array();
-  array operator=(array &&a);
-
-  reference at(size_type pos);
-  reference operator[](size_type pos);
-  const_reference front();
-  const_reference back();
-  iterator data();
-
-  iterator begin();
-  iterator end();
-
-  bool empty();
-  size_type size();
-  size_type max_size();
-
-  void swap(array &other);
-  void fill(const_reference value);
+  // как у std::array: элементы без инициализатора не обнуляются
+  array() = default;
+  constexpr explicit array(std::initializer_list<value_type> const &items);
+  array(const array &a) = default;
+  array(array &&a) = default;
+  ~array() = default;
+  array &operator=(const array &a) = default;
+  array &operator=(array &&a) = default;
+
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos);
+  constexpr const_reference operator[](size_type pos) const;
+  constexpr const_reference front() const;
+  constexpr const_reference back() const;
+  constexpr iterator data();
+  constexpr const_iterator data() const;
+
+  constexpr iterator begin();
+  constexpr iterator end();
+  constexpr const_iterator begin() const;
+  constexpr const_iterator end() const;
+
+  constexpr bool empty() const;
+  constexpr size_type size() const;
+  constexpr size_type max_size() const;
+  // элементы лежат в самом объекте, кучи нет
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  constexpr void swap(array &other);
+  constexpr void fill(const_reference value);
 
  private:
-  size_type size_{0U};
-  value_type *data_{nullptr};
-
-  void remove();
-  void copy(const array &a);
-  void move(array &a);
+  // массив нулевой длины в C++ запрещён, поэтому при n == 0 место под один
+  // элемент есть, но size() и end() его не видят
+  value_type data_[n == 0 ? 1 : n];
 };
 
-template <typename value_type, std::size_t n>
-array<value_type, n>::array() : size_(n) {
-  if (n != 0) data_ = new value_type[n];
-}
+// с такой длины fill и сравнения идут через bulk_ops; короче и при
+// вычислении на этапе компиляции - обычный цикл
+template <typename T, std::size_t n>
+constexpr bool kArrayBulk = n >= 64 && bulk::kVectorizable<T>;
 
 template <typename value_type, std::size_t n>
-array<value_type, n>::array(std::initializer_list<value_type> const &items)
-    : array() {
+constexpr array<value_type, n>::array(
+    std::initializer_list<value_type> const &items)
+    : data_{} {
   if (items.size() > n) {
     throw std::invalid_argument("error: too many initializers");
   }
 
-  int i{0};
-  for (auto item : items) {
+  size_type i{0};
+  for (auto &item : items) {
     data_[i] = item;
     ++i;
   }
 }
 
 template <typename value_type, std::size_t n>
-array<value_type, n>::array(const array &a) : array() {
-  copy(a);
+constexpr typename array<value_type, n>::iterator
+array<value_type, n>::begin() {
+  return data_;
 }
 
 template <typename value_type, std::size_t n>
-array<value_type, n>::array(array &&a) {
-  move(a);
+constexpr typename array<value_type, n>::iterator array<value_type, n>::end() {
+  return data_ + n;
 }
 
 template <typename value_type, std::size_t n>
-array<value_type, n>::~array() {
-  remove();
+constexpr typename array<value_type, n>::const_iterator
+array<value_type, n>::begin() const {
+  return data_;
 }
 
 template <typename value_type, std::size_t n>
-array<value_type, n> array<value_type, n>::operator=(array &&a) {
-  if (a != this) {
-    move(a);
-  }
-  return *this;
+constexpr typename array<value_type, n>::const_iterator
+array<value_type, n>::end() const {
+  return data_ + n;
 }
 
 template <typename value_type, std::size_t n>
-typename array<value_type, n>::iterator array<value_type, n>::begin() {
-  return &data_[0];
+constexpr typename array<value_type, n>::reference array<value_type, n>::at(
+    size_type pos) {
+  if (!(pos < n)) throw std::out_of_range("Out of range");
+  return data_[pos];
 }
 
 template <typename value_type, std::size_t n>
-typename array<value_type, n>::iterator array<value_type, n>::end() {
-  return &data_[n];
+constexpr typename array<value_type, n>::const_reference
+array<value_type, n>::at(size_type pos) const {
+  if (!(pos < n)) throw std::out_of_range("Out of range");
+  return data_[pos];
 }
 
 template <typename value_type, std::size_t n>
-typename array<value_type, n>::reference array<value_type, n>::at(
-    size_type pos) {
-  if (!(pos < n)) throw std::out_of_range("Out of range");
+constexpr typename array<value_type, n>::reference
+array<value_type, n>::operator[](size_type pos) {
   return data_[pos];
 }
 
 template <typename value_type, std::size_t n>
-typename array<value_type, n>::reference array<value_type, n>::operator[](
-    size_type pos) {
+constexpr typename array<value_type, n>::const_reference
+array<value_type, n>::operator[](size_type pos) const {
   return data_[pos];
 }
 
 template <typename value_type, std::size_t n>
-typename array<value_type, n>::const_reference array<value_type, n>::front() {
+constexpr typename array<value_type, n>::const_reference
+array<value_type, n>::front() const {
   return data_[0];
 }
 
 template <typename value_type, std::size_t n>
-typename array<value_type, n>::const_reference array<value_type, n>::back() {
+constexpr typename array<value_type, n>::const_reference
+array<value_type, n>::back() const {
   return data_[n - 1];
 }
 
 template <typename value_type, std::size_t n>
-typename array<value_type, n>::iterator array<value_type, n>::data() {
+constexpr typename array<value_type, n>::iterator array<value_type, n>::data() {
   return data_;
 }
 
 template <typename value_type, std::size_t n>
-bool array<value_type, n>::empty() {
-  return begin() == end();
+constexpr typename array<value_type, n>::const_iterator
+array<value_type, n>::data() const {
+  return data_;
 }
 
 template <typename value_type, std::size_t n>
-typename array<value_type, n>::size_type array<value_type, n>::size() {
+constexpr bool array<value_type, n>::empty() const {
+  return n == 0;
+}
+
+template <typename value_type, std::size_t n>
+constexpr typename array<value_type, n>::size_type array<value_type, n>::size()
+    const {
   return n;
 }
 
 template <typename value_type, std::size_t n>
-typename array<value_type, n>::size_type array<value_type, n>::max_size() {
+constexpr typename array<value_type, n>::size_type
+array<value_type, n>::max_size() const {
   return n;
 }
 
 template <typename value_type, std::size_t n>
-void array<value_type, n>::swap(array &other) {
-  if (this != &other) {
-    std::swap(other.size_, size_);
-    std::swap(other.data_, data_);
+typename array<value_type, n>::size_type array<value_type, n>::memory_usage()
+    const {
+  return memory_report().total();
+}
+
+// при n == 0 место под один элемент не занято - это slack
+template <typename value_type, std::size_t n>
+MemoryReport array<value_type, n>::memory_report() const {
+  MemoryReport report =
+      memory::array_report<value_type>(n, sizeof(data_) / sizeof(value_type));
+  report.object = sizeof(*this) - sizeof(data_);
+  return report;
+}
+
+// std::swap станет constexpr только в C++20, поэтому обмен по элементам
+template <typename value_type, std::size_t n>
+constexpr void array<value_type, n>::swap(array &other) {
+  for (size_type i = 0; i < n; ++i) {
+    value_type tmp = std::move(data_[i]);
+    data_[i] = std::move(other.data_[i]);
+    other.data_[i] = std::move(tmp);
   }
 }
 
 template <typename value_type, std::size_t n>
-void array<value_type, n>::fill(const_reference value) {
+constexpr void array<value_type, n>::fill(const_reference value) {
+  if (kArrayBulk<value_type, n> && !__builtin_is_constant_evaluated()) {
+    bulk_fill(data_, n, value);
+    return;
+  }
   for (size_type i = 0; i < n; ++i) {
     data_[i] = value;
   }
 }
 
 template <typename value_type, std::size_t n>
-void array<value_type, n>::remove() {
-  if (data_ != nullptr) {
-    delete[] data_;
-    data_ = nullptr;
-    size_ = 0U;
+constexpr bool operator==(const array<value_type, n> &lhs,
+                          const array<value_type, n> &rhs) {
+  if (kArrayBulk<value_type, n> && !__builtin_is_constant_evaluated()) {
+    return bulk_equal(lhs.data(), rhs.data(), n);
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!(lhs[i] == rhs[i])) return false;
   }
+  return true;
 }
 
 template <typename value_type, std::size_t n>
-void array<value_type, n>::copy(const array &a) {
-  if (this != &a) {
-    std::copy(a.data_, a.data_ + n, data_);
+constexpr bool operator!=(const array<value_type, n> &lhs,
+                          const array<value_type, n> &rhs) {
+  return !(lhs == rhs);
+}
+
+// лексикографическое сравнение, как у std::array
+template <typename value_type, std::size_t n>
+constexpr bool operator<(const array<value_type, n> &lhs,
+                         const array<value_type, n> &rhs) {
+  if (kArrayBulk<value_type, n> && !__builtin_is_constant_evaluated()) {
+    return bulk_compare(lhs.data(), n, rhs.data(), n) < 0;
   }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (lhs[i] < rhs[i]) return true;
+    if (rhs[i] < lhs[i]) return false;
+  }
+  return false;
+}
+
+template <typename value_type, std::size_t n>
+constexpr bool operator>(const array<value_type, n> &lhs,
+                         const array<value_type, n> &rhs) {
+  return rhs < lhs;
+}
+
+template <typename value_type, std::size_t n>
+constexpr bool operator<=(const array<value_type, n> &lhs,
+                          const array<value_type, n> &rhs) {
+  return !(rhs < lhs);
 }
 
 template <typename value_type, std::size_t n>
-void array<value_type, n>::move(array &a) {
-  remove();
-  std::swap(size_, a.size_);
-  std::swap(data_, a.data_);
+constexpr bool operator>=(const array<value_type, n> &lhs,
+                          const array<value_type, n> &rhs) {
+  return !(lhs < rhs);
 }
 
 }  // namespace s21
@@ -0,0 +1,267 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_BTREE_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_BTREE_MAP_H_
+
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::pair
+
+#include "BTree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Упорядоченное отображение на B-дереве с интерфейсом s21::map и границами
+// поиска. Ключи в узле лежат одним массивом, значения - параллельным,
+// поэтому итератор разыменовывается в пару ссылок (ключ, значение).
+// Любая вставка или удаление делает итераторы недействительными.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class btree_map : BTree<Key, T, Compare, false> {
+  using Base = BTree<Key, T, Compare, false>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = std::pair<const key_type &, mapped_type &>;
+  using const_reference = std::pair<const key_type &, const mapped_type &>;
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::const_iterator;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  btree_map() {}
+  explicit btree_map(std::initializer_list<value_type> const &items);
+  btree_map(const btree_map &m) : Base(m) {}
+  btree_map(btree_map &&m) : Base(std::move(m)) {}
+  ~btree_map() {}
+  btree_map &operator=(const btree_map &m);
+  btree_map &operator=(btree_map &&m);
+
+  mapped_type &at(const key_type &key);
+  const mapped_type &at(const key_type &key) const;
+  mapped_type &operator[](const key_type &key);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  using Base::empty;
+  using Base::max_size;
+  using Base::memory_report;
+  using Base::memory_usage;
+  using Base::size;
+
+  using Base::clear;
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(btree_map &other);
+  void merge(btree_map &other);
+
+  bool contains(const key_type &key) const;
+  size_type count(const key_type &key) const;
+  iterator find(const key_type &key);
+  const_iterator find(const key_type &key) const;
+  iterator lower_bound(const key_type &key);
+  const_iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key);
+  const_iterator upper_bound(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+};
+
+template <typename Key, typename T, typename Compare>
+btree_map<Key, T, Compare>::btree_map(
+    std::initializer_list<value_type> const &items) {
+  for (auto &item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Compare>
+btree_map<Key, T, Compare> &btree_map<Key, T, Compare>::operator=(
+    const btree_map &m) {
+  Base::operator=(m);
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+btree_map<Key, T, Compare> &btree_map<Key, T, Compare>::operator=(
+    btree_map &&m) {
+  Base::operator=(std::move(m));
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+T &btree_map<Key, T, Compare>::at(const key_type &key) {
+  iterator it = find(key);
+  if (it == end()) throw std::out_of_range("Out of range");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare>
+const T &btree_map<Key, T, Compare>::at(const key_type &key) const {
+  const_iterator it = find(key);
+  if (it == end()) throw std::out_of_range("Out of range");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare>
+T &btree_map<Key, T, Compare>::operator[](const key_type &key) {
+  return this->emplace_key(key).first->second;
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::iterator
+btree_map<Key, T, Compare>::begin() {
+  return Base::begin();
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::iterator
+btree_map<Key, T, Compare>::end() {
+  return Base::end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::const_iterator
+btree_map<Key, T, Compare>::begin() const {
+  return Base::begin();
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::const_iterator
+btree_map<Key, T, Compare>::end() const {
+  return Base::end();
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename btree_map<Key, T, Compare>::iterator, bool>
+btree_map<Key, T, Compare>::insert(const value_type &value) {
+  return this->emplace_key(value.first, value.second);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename btree_map<Key, T, Compare>::iterator, bool>
+btree_map<Key, T, Compare>::insert(const key_type &key,
+                                   const mapped_type &obj) {
+  return this->emplace_key(key, obj);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename btree_map<Key, T, Compare>::iterator, bool>
+btree_map<Key, T, Compare>::insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+  auto result = this->emplace_key(key, obj);
+  if (!result.second) result.first->second = obj;
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+void btree_map<Key, T, Compare>::erase(iterator pos) {
+  this->erase_at(pos);
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::size_type
+btree_map<Key, T, Compare>::erase(const key_type &key) {
+  iterator it = find(key);
+  if (it == end()) return 0;
+  this->erase_at(it);
+  return 1;
+}
+
+template <typename Key, typename T, typename Compare>
+void btree_map<Key, T, Compare>::swap(btree_map &other) {
+  Base::swap(other);
+}
+
+// элементы с ключами, которые уже есть в этом отображении, остаются в other
+template <typename Key, typename T, typename Compare>
+void btree_map<Key, T, Compare>::merge(btree_map &other) {
+  if (this == &other) return;
+  btree_map rest;
+  for (auto it = other.begin(); it != other.end(); ++it) {
+    if (!this->emplace_key(it->first, it->second).second) {
+      rest.emplace_key(it->first, it->second);
+    }
+  }
+  other.swap(rest);
+}
+
+template <typename Key, typename T, typename Compare>
+bool btree_map<Key, T, Compare>::contains(const key_type &key) const {
+  return Base::find(key) != Base::end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::size_type
+btree_map<Key, T, Compare>::count(const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::iterator btree_map<Key, T, Compare>::find(
+    const key_type &key) {
+  return Base::find(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::const_iterator
+btree_map<Key, T, Compare>::find(const key_type &key) const {
+  return Base::find(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::iterator
+btree_map<Key, T, Compare>::lower_bound(const key_type &key) {
+  return Base::lower_bound(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::const_iterator
+btree_map<Key, T, Compare>::lower_bound(const key_type &key) const {
+  return Base::lower_bound(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::iterator
+btree_map<Key, T, Compare>::upper_bound(const key_type &key) {
+  return Base::upper_bound(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename btree_map<Key, T, Compare>::const_iterator
+btree_map<Key, T, Compare>::upper_bound(const key_type &key) const {
+  return Base::upper_bound(key);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename btree_map<Key, T, Compare>::iterator,
+          typename btree_map<Key, T, Compare>::iterator>
+btree_map<Key, T, Compare>::equal_range(const key_type &key) {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+// вставка сдвигает элементы между узлами, поэтому итераторы в результате
+// находятся заново после всех вставок
+template <typename Key, typename T, typename Compare>
+template <class... Args>
+vector<std::pair<typename btree_map<Key, T, Compare>::iterator, bool>>
+btree_map<Key, T, Compare>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) result.push_back(insert(val));
+  auto it = arg.begin();
+  for (auto &item : result) item.first = find((it++)->first);
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_BTREE_MAP_H_
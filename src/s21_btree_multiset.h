@@ -0,0 +1,152 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_BTREE_MULTISET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_BTREE_MULTISET_H_
+
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <utility>           // для std::pair
+
+#include "BTree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Мультимножество на B-дереве с интерфейсом s21::multiset. Равные элементы
+// идут в порядке вставки. Любая вставка или удаление делает итераторы
+// недействительными.
+template <typename Key, typename Compare = std::less<Key>>
+class btree_multiset : BTree<Key, BTreeNoValue, Compare, true> {
+  using Base = BTree<Key, BTreeNoValue, Compare, true>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::iterator;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  btree_multiset() {}
+  explicit btree_multiset(std::initializer_list<value_type> const &items);
+  btree_multiset(const btree_multiset &ms) : Base(ms) {}
+  btree_multiset(btree_multiset &&ms) : Base(std::move(ms)) {}
+  ~btree_multiset() {}
+  btree_multiset &operator=(const btree_multiset &ms);
+  btree_multiset &operator=(btree_multiset &&ms);
+
+  using Base::begin;
+  using Base::end;
+
+  using Base::empty;
+  using Base::max_size;
+  using Base::memory_report;
+  using Base::memory_usage;
+  using Base::size;
+
+  using Base::clear;
+  iterator insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(btree_multiset &other);
+  void merge(btree_multiset &other);
+
+  using Base::count;
+  using Base::find;
+  using Base::lower_bound;
+  using Base::upper_bound;
+  bool contains(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+};
+
+template <typename Key, typename Compare>
+btree_multiset<Key, Compare>::btree_multiset(
+    std::initializer_list<value_type> const &items) {
+  for (auto &item : items) insert(item);
+}
+
+template <typename Key, typename Compare>
+btree_multiset<Key, Compare> &btree_multiset<Key, Compare>::operator=(
+    const btree_multiset &ms) {
+  Base::operator=(ms);
+  return *this;
+}
+
+template <typename Key, typename Compare>
+btree_multiset<Key, Compare> &btree_multiset<Key, Compare>::operator=(
+    btree_multiset &&ms) {
+  Base::operator=(std::move(ms));
+  return *this;
+}
+
+template <typename Key, typename Compare>
+typename btree_multiset<Key, Compare>::iterator
+btree_multiset<Key, Compare>::insert(const value_type &value) {
+  return this->emplace_key(value).first;
+}
+
+template <typename Key, typename Compare>
+void btree_multiset<Key, Compare>::erase(iterator pos) {
+  this->erase_at(pos);
+}
+
+// удаляет все равные key, возвращает их число
+template <typename Key, typename Compare>
+typename btree_multiset<Key, Compare>::size_type
+btree_multiset<Key, Compare>::erase(const key_type &key) {
+  size_type result = 0;
+  for (iterator it = find(key); it != end(); it = find(key)) {
+    this->erase_at(it);
+    ++result;
+  }
+  return result;
+}
+
+template <typename Key, typename Compare>
+void btree_multiset<Key, Compare>::swap(btree_multiset &other) {
+  Base::swap(other);
+}
+
+// в мультимножество переходят все элементы other
+template <typename Key, typename Compare>
+void btree_multiset<Key, Compare>::merge(btree_multiset &other) {
+  if (this == &other) return;
+  for (auto it = other.begin(); it != other.end(); ++it) {
+    this->emplace_key(*it);
+  }
+  other.clear();
+}
+
+template <typename Key, typename Compare>
+bool btree_multiset<Key, Compare>::contains(const key_type &key) const {
+  return find(key) != end();
+}
+
+template <typename Key, typename Compare>
+std::pair<typename btree_multiset<Key, Compare>::iterator,
+          typename btree_multiset<Key, Compare>::iterator>
+btree_multiset<Key, Compare>::equal_range(const key_type &key) const {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+// вставка сдвигает элементы между узлами, поэтому итераторы в результате
+// находятся заново после всех вставок; для равных элементов это первый из
+// них
+template <typename Key, typename Compare>
+template <class... Args>
+vector<std::pair<typename btree_multiset<Key, Compare>::iterator, bool>>
+btree_multiset<Key, Compare>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) result.push_back({insert(val), true});
+  auto it = arg.begin();
+  for (auto &item : result) item.first = find(*it++);
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_BTREE_MULTISET_H_
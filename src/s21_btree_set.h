@@ -0,0 +1,153 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_BTREE_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_BTREE_SET_H_
+
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <utility>           // для std::pair
+
+#include "BTree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Упорядоченное множество на B-дереве с интерфейсом s21::set и границами
+// поиска. Любая вставка или удаление делает итераторы недействительными.
+template <typename Key, typename Compare = std::less<Key>>
+class btree_set : BTree<Key, BTreeNoValue, Compare, false> {
+  using Base = BTree<Key, BTreeNoValue, Compare, false>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::iterator;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  btree_set() {}
+  explicit btree_set(std::initializer_list<value_type> const &items);
+  btree_set(const btree_set &s) : Base(s) {}
+  btree_set(btree_set &&s) : Base(std::move(s)) {}
+  ~btree_set() {}
+  btree_set &operator=(const btree_set &s);
+  btree_set &operator=(btree_set &&s);
+
+  using Base::begin;
+  using Base::end;
+
+  using Base::empty;
+  using Base::max_size;
+  using Base::memory_report;
+  using Base::memory_usage;
+  using Base::size;
+
+  using Base::clear;
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(btree_set &other);
+  void merge(btree_set &other);
+
+  using Base::find;
+  using Base::lower_bound;
+  using Base::upper_bound;
+  bool contains(const key_type &key) const;
+  size_type count(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+};
+
+template <typename Key, typename Compare>
+btree_set<Key, Compare>::btree_set(
+    std::initializer_list<value_type> const &items) {
+  for (auto &item : items) insert(item);
+}
+
+template <typename Key, typename Compare>
+btree_set<Key, Compare> &btree_set<Key, Compare>::operator=(
+    const btree_set &s) {
+  Base::operator=(s);
+  return *this;
+}
+
+template <typename Key, typename Compare>
+btree_set<Key, Compare> &btree_set<Key, Compare>::operator=(btree_set &&s) {
+  Base::operator=(std::move(s));
+  return *this;
+}
+
+template <typename Key, typename Compare>
+std::pair<typename btree_set<Key, Compare>::iterator, bool>
+btree_set<Key, Compare>::insert(const value_type &value) {
+  return this->emplace_key(value);
+}
+
+template <typename Key, typename Compare>
+void btree_set<Key, Compare>::erase(iterator pos) {
+  this->erase_at(pos);
+}
+
+template <typename Key, typename Compare>
+typename btree_set<Key, Compare>::size_type btree_set<Key, Compare>::erase(
+    const key_type &key) {
+  iterator it = find(key);
+  if (it == end()) return 0;
+  this->erase_at(it);
+  return 1;
+}
+
+template <typename Key, typename Compare>
+void btree_set<Key, Compare>::swap(btree_set &other) {
+  Base::swap(other);
+}
+
+// элементы, которые уже есть в этом множестве, остаются в other
+template <typename Key, typename Compare>
+void btree_set<Key, Compare>::merge(btree_set &other) {
+  if (this == &other) return;
+  btree_set rest;
+  for (auto it = other.begin(); it != other.end(); ++it) {
+    if (!this->emplace_key(*it).second) rest.emplace_key(*it);
+  }
+  other.swap(rest);
+}
+
+template <typename Key, typename Compare>
+bool btree_set<Key, Compare>::contains(const key_type &key) const {
+  return find(key) != end();
+}
+
+template <typename Key, typename Compare>
+typename btree_set<Key, Compare>::size_type btree_set<Key, Compare>::count(
+    const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare>
+std::pair<typename btree_set<Key, Compare>::iterator,
+          typename btree_set<Key, Compare>::iterator>
+btree_set<Key, Compare>::equal_range(const key_type &key) const {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+// вставка сдвигает элементы между узлами, поэтому итераторы в результате
+// находятся заново после всех вставок
+template <typename Key, typename Compare>
+template <class... Args>
+vector<std::pair<typename btree_set<Key, Compare>::iterator, bool>>
+btree_set<Key, Compare>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) result.push_back(insert(val));
+  auto it = arg.begin();
+  for (auto &item : result) item.first = find(*it++);
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_BTREE_SET_H_
@@ -0,0 +1,417 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CIRCULAR_BUFFER_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CIRCULAR_BUFFER_H_
+
+#include <algorithm>         // для std::rotate
+#include <cstddef>           // для std::size_t
+#include <cstdint>           // для SIZE_MAX
+#include <initializer_list>  // для std::initializer_list
+#include <new>               // для placement new, std::align_val_t
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::move, std::swap
+
+#include "iterator_circular.h"
+#include "memory_report.h"
+#include "span.h"
+
+namespace s21 {
+// что делать с новым элементом в полном буфере: kOverwrite вытесняет самый
+// старый с противоположного конца, kReject не вставляет новый
+enum class CircularPolicy { kOverwrite, kReject };
+
+// Кольцевой буфер фиксированной ёмкости в одном непрерывном блоке памяти,
+// выделенном в конструкторе; вставки и удаления с обоих концов памяти не
+// выделяют. Элементы занимают ячейки с head_ по кругу, поэтому лежат одним
+// или двумя участками: array_one() и array_two() отдают их без копирования,
+// а linearize() сдвигает элементы так, чтобы участок был один.
+template <typename T>
+class circular_buffer {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = CircularBufferIterator<circular_buffer, value_type>;
+  using const_iterator =
+      CircularBufferIterator<const circular_buffer, const value_type>;
+  using size_type = std::size_t;
+
+  circular_buffer() {}
+  explicit circular_buffer(size_type capacity,
+                           CircularPolicy policy = CircularPolicy::kOverwrite);
+  explicit circular_buffer(std::initializer_list<value_type> const &items);
+  circular_buffer(const circular_buffer &other);
+  circular_buffer(circular_buffer &&other);
+  ~circular_buffer();
+  circular_buffer &operator=(const circular_buffer &other);
+  circular_buffer &operator=(circular_buffer &&other);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // участки с элементами по порядку; второй пуст, если первый - все
+  span<value_type> array_one();
+  span<value_type> array_two();
+  span<const value_type> array_one() const;
+  span<const value_type> array_two() const;
+  // переставляет элементы в начало памяти и возвращает их одним участком
+  span<value_type> linearize();
+
+  bool empty() const;
+  bool full() const;
+  size_type size() const;
+  size_type capacity() const;
+  size_type max_size() const;
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+  CircularPolicy policy() const;
+  void set_policy(CircularPolicy policy);
+
+  // false - буфер полон и политика kReject, элемент не вставлен
+  bool push_back(const_reference value);
+  bool push_back(value_type &&value);
+  bool push_front(const_reference value);
+  bool push_front(value_type &&value);
+  void pop_back();
+  void pop_front();
+  void clear();
+  void swap(circular_buffer &other);
+
+ private:
+  value_type *data_{nullptr};
+  size_type capacity_{0U};
+  size_type head_{0U};
+  size_type size_{0U};
+  CircularPolicy policy_{CircularPolicy::kOverwrite};
+
+  size_type wrap(size_type index) const;
+  template <typename U>
+  bool add_back(U &&value);
+  template <typename U>
+  bool add_front(U &&value);
+  void release();
+};
+
+template <typename value_type>
+circular_buffer<value_type>::circular_buffer(size_type capacity,
+                                             CircularPolicy policy)
+    : capacity_(capacity), policy_(policy) {
+  if (capacity > max_size()) {
+    throw std::length_error("Cannot create buffer larger than max_size()");
+  }
+  if (capacity != 0) {
+    data_ = static_cast<value_type *>(
+        ::operator new(capacity * sizeof(value_type),
+                       std::align_val_t(alignof(value_type))));
+  }
+}
+
+template <typename value_type>
+circular_buffer<value_type>::circular_buffer(
+    std::initializer_list<value_type> const &items)
+    : circular_buffer(items.size()) {
+  for (auto &item : items) push_back(item);
+}
+
+template <typename value_type>
+circular_buffer<value_type>::circular_buffer(const circular_buffer &other)
+    : circular_buffer(other.capacity_, other.policy_) {
+  for (size_type i = 0; i < other.size_; ++i) push_back(other[i]);
+}
+
+template <typename value_type>
+circular_buffer<value_type>::circular_buffer(circular_buffer &&other) {
+  swap(other);
+}
+
+template <typename value_type>
+circular_buffer<value_type>::~circular_buffer() {
+  release();
+}
+
+template <typename value_type>
+circular_buffer<value_type> &circular_buffer<value_type>::operator=(
+    const circular_buffer &other) {
+  if (this != &other) {
+    circular_buffer tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename value_type>
+circular_buffer<value_type> &circular_buffer<value_type>::operator=(
+    circular_buffer &&other) {
+  if (this != &other) {
+    circular_buffer tmp(std::move(other));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::reference circular_buffer<value_type>::at(
+    size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Out of range");
+  return data_[wrap(head_ + pos)];
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::const_reference
+circular_buffer<value_type>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Out of range");
+  return data_[wrap(head_ + pos)];
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::reference
+circular_buffer<value_type>::operator[](size_type pos) {
+  return data_[wrap(head_ + pos)];
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::const_reference
+circular_buffer<value_type>::operator[](size_type pos) const {
+  return data_[wrap(head_ + pos)];
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::const_reference
+circular_buffer<value_type>::front() const {
+  return data_[head_];
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::const_reference
+circular_buffer<value_type>::back() const {
+  return data_[wrap(head_ + size_ - 1)];
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::iterator
+circular_buffer<value_type>::begin() {
+  return iterator(this, 0);
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::iterator
+circular_buffer<value_type>::end() {
+  return iterator(this, size_);
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::const_iterator
+circular_buffer<value_type>::begin() const {
+  return const_iterator(this, 0);
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::const_iterator
+circular_buffer<value_type>::end() const {
+  return const_iterator(this, size_);
+}
+
+template <typename value_type>
+span<value_type> circular_buffer<value_type>::array_one() {
+  size_type len = capacity_ - head_ < size_ ? capacity_ - head_ : size_;
+  return span<value_type>(data_ + head_, len);
+}
+
+template <typename value_type>
+span<value_type> circular_buffer<value_type>::array_two() {
+  size_type len = capacity_ - head_ < size_ ? size_ - (capacity_ - head_) : 0;
+  return span<value_type>(data_, len);
+}
+
+template <typename value_type>
+span<const value_type> circular_buffer<value_type>::array_one() const {
+  return const_cast<circular_buffer *>(this)->array_one();
+}
+
+template <typename value_type>
+span<const value_type> circular_buffer<value_type>::array_two() const {
+  return const_cast<circular_buffer *>(this)->array_two();
+}
+
+// Полный буфер поворачивается на месте: все ячейки заняты. В неполном
+// между участками есть несконструированные ячейки, поэтому элементы
+// переносятся в новый блок памяти.
+template <typename value_type>
+span<value_type> circular_buffer<value_type>::linearize() {
+  if (head_ + size_ > capacity_) {
+    if (size_ == capacity_) {
+      std::rotate(data_, data_ + head_, data_ + capacity_);
+    } else {
+      circular_buffer tmp(capacity_, policy_);
+      for (size_type i = 0; i < size_; ++i) {
+        tmp.push_back(std::move((*this)[i]));
+      }
+      swap(tmp);
+    }
+    head_ = 0;
+  }
+  return array_one();
+}
+
+template <typename value_type>
+bool circular_buffer<value_type>::empty() const {
+  return size_ == 0;
+}
+
+template <typename value_type>
+bool circular_buffer<value_type>::full() const {
+  return size_ == capacity_;
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::size_type
+circular_buffer<value_type>::size() const {
+  return size_;
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::size_type
+circular_buffer<value_type>::capacity() const {
+  return capacity_;
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::size_type
+circular_buffer<value_type>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type>
+MemoryReport circular_buffer<value_type>::memory_report() const {
+  MemoryReport report = memory::array_report<value_type>(size_, capacity_);
+  if (capacity_) {
+    report.headers = memory::heap_overhead(capacity_ * sizeof(value_type));
+  }
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename value_type>
+typename circular_buffer<value_type>::size_type
+circular_buffer<value_type>::max_size() const {
+  return SIZE_MAX / sizeof(value_type) / 2;
+}
+
+template <typename value_type>
+CircularPolicy circular_buffer<value_type>::policy() const {
+  return policy_;
+}
+
+template <typename value_type>
+void circular_buffer<value_type>::set_policy(CircularPolicy policy) {
+  policy_ = policy;
+}
+
+template <typename value_type>
+bool circular_buffer<value_type>::push_back(const_reference value) {
+  return add_back(value);
+}
+
+template <typename value_type>
+bool circular_buffer<value_type>::push_back(value_type &&value) {
+  return add_back(std::move(value));
+}
+
+template <typename value_type>
+bool circular_buffer<value_type>::push_front(const_reference value) {
+  return add_front(value);
+}
+
+template <typename value_type>
+bool circular_buffer<value_type>::push_front(value_type &&value) {
+  return add_front(std::move(value));
+}
+
+template <typename value_type>
+void circular_buffer<value_type>::pop_back() {
+  if (size_ != 0) {
+    data_[wrap(head_ + size_ - 1)].~value_type();
+    --size_;
+  }
+}
+
+template <typename value_type>
+void circular_buffer<value_type>::pop_front() {
+  if (size_ != 0) {
+    data_[head_].~value_type();
+    head_ = wrap(head_ + 1);
+    --size_;
+  }
+}
+
+template <typename value_type>
+void circular_buffer<value_type>::clear() {
+  while (size_) pop_back();
+  head_ = 0;
+}
+
+template <typename value_type>
+void circular_buffer<value_type>::swap(circular_buffer &other) {
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+  std::swap(policy_, other.policy_);
+}
+
+// head_ + pos < 2 * capacity_, поэтому вместо деления - одно вычитание
+template <typename value_type>
+typename circular_buffer<value_type>::size_type
+circular_buffer<value_type>::wrap(size_type index) const {
+  return index >= capacity_ ? index - capacity_ : index;
+}
+
+// в полном буфере при kOverwrite новый элемент занимает ячейку самого
+// старого, и начало сдвигается на одну
+template <typename value_type>
+template <typename U>
+bool circular_buffer<value_type>::add_back(U &&value) {
+  if (size_ == capacity_) {
+    if (policy_ == CircularPolicy::kReject || capacity_ == 0) return false;
+    data_[head_] = std::forward<U>(value);
+    head_ = wrap(head_ + 1);
+    return true;
+  }
+  ::new (data_ + wrap(head_ + size_)) value_type(std::forward<U>(value));
+  ++size_;
+  return true;
+}
+
+template <typename value_type>
+template <typename U>
+bool circular_buffer<value_type>::add_front(U &&value) {
+  size_type slot = head_ == 0 ? capacity_ - 1 : head_ - 1;
+  if (size_ == capacity_) {
+    if (policy_ == CircularPolicy::kReject || capacity_ == 0) return false;
+    data_[slot] = std::forward<U>(value);
+    head_ = slot;
+    return true;
+  }
+  ::new (data_ + slot) value_type(std::forward<U>(value));
+  head_ = slot;
+  ++size_;
+  return true;
+}
+
+template <typename value_type>
+void circular_buffer<value_type>::release() {
+  clear();
+  ::operator delete(data_, std::align_val_t(alignof(value_type)));
+  data_ = nullptr;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CIRCULAR_BUFFER_H_
@@ -0,0 +1,435 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONCURRENT_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONCURRENT_MAP_H_
+
+#include <atomic>            // для std::atomic
+#include <cstddef>           // для std::size_t
+#include <cstdint>           // для std::uint64_t, std::uintptr_t, SIZE_MAX
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::pair
+
+#include "epoch.h"
+#include "iterator_skiplist.h"
+#include "memory_report.h"
+#include "node_skiplist.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Упорядоченное отображение для многих потоков на неблокирующем списке с
+// пропусками (Herlihy, Shavit, "The Art of Multiprocessor Programming", 14.4).
+// find/contains/lower_bound только читают ссылки - без CAS и повторов;
+// insert/erase - CAS по ссылкам, блокировок нет. Удаление: сначала метятся
+// ссылки узла сверху вниз, метка на нижнем уровне - момент удаления, затем
+// узел вырезается со всех уровней и уходит в EpochDomain. Все методы можно
+// вызывать одновременно из разных потоков, кроме конструкторов и
+// деструктора. Значения после вставки не меняются, поэтому at() возвращает
+// копию, а итераторы константные.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class concurrent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = std::pair<const key_type &, const mapped_type &>;
+  using const_reference = reference;
+  using iterator = SkipListIterator<key_type, mapped_type>;
+  using const_iterator = iterator;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  static constexpr int kMaxLevel = 32;
+
+  concurrent_map();
+  explicit concurrent_map(std::initializer_list<value_type> const &items);
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+  ~concurrent_map();
+
+  mapped_type at(const key_type &key) const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  // size() - число элементов на момент чтения счётчика
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // Обход нижнего уровня: точен, только пока никто не пишет в map.
+  // Удалённые узлы, которые ждут освобождения в EpochDomain, не входят.
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+
+  bool contains(const key_type &key) const;
+  iterator find(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+
+ private:
+  using Node = SkipListNode<key_type, mapped_type>;
+
+  // голова - только массив ссылок всех уровней, без ключа
+  mutable SkipLink head_[kMaxLevel];
+  std::atomic<size_type> size_{0};
+  Compare comp_{};
+
+  static int random_level();
+  bool find_position(const key_type &key, SkipLink **preds,
+                     Node **succs) const;
+  bool try_find_position(const key_type &key, SkipLink **preds, Node **succs,
+                         bool *found) const;
+  template <typename Less>
+  Node *first_not_less(Less less) const;
+  void link_upper_levels(Node *node, SkipLink **preds, Node **succs);
+  size_type erase_node(Node *node);
+  void release(Node *node);
+};
+
+template <typename Key, typename T, typename Compare>
+concurrent_map<Key, T, Compare>::concurrent_map() {
+  for (SkipLink &link : head_) link.store(0, std::memory_order_relaxed);
+}
+
+template <typename Key, typename T, typename Compare>
+concurrent_map<Key, T, Compare>::concurrent_map(
+    std::initializer_list<value_type> const &items)
+    : concurrent_map() {
+  for (auto &item : items) insert(item);
+}
+
+// к этому моменту других потоков у контейнера нет: узлы, которые ещё в
+// списке, освобождаются сразу, а удалённые раньше освободит EpochDomain
+template <typename Key, typename T, typename Compare>
+concurrent_map<Key, T, Compare>::~concurrent_map() {
+  Node *node = skip_pointer<Node>(head_[0].load());
+  while (node) {
+    Node *next = skip_pointer<Node>(node->next()[0].load());
+    Node::destroy(node);
+    node = next;
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+T concurrent_map<Key, T, Compare>::at(const key_type &key) const {
+  iterator it = find(key);
+  if (it == end()) throw std::out_of_range("Out of range");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::iterator
+concurrent_map<Key, T, Compare>::begin() const {
+  EpochGuard guard;
+  return iterator(first_not_less([](const key_type &) { return false; }));
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::iterator
+concurrent_map<Key, T, Compare>::end() const {
+  return iterator();
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::empty() const {
+  return size() == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::size_type
+concurrent_map<Key, T, Compare>::size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::size_type
+concurrent_map<Key, T, Compare>::max_size() const {
+  return SIZE_MAX / (sizeof(Node) + 2 * sizeof(SkipLink));
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::size_type
+concurrent_map<Key, T, Compare>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename Key, typename T, typename Compare>
+MemoryReport concurrent_map<Key, T, Compare>::memory_report() const {
+  EpochGuard guard;
+  MemoryReport report;
+  Node *node = skip_pointer<Node>(head_[0].load(std::memory_order_acquire));
+  while (node) {
+    std::size_t links = node->height_ * sizeof(SkipLink);
+    std::size_t payload = memory::payload_size<key_type>::value +
+                          memory::payload_size<mapped_type>::value;
+    std::size_t control = sizeof(node->height_) + sizeof(node->owners_);
+    report.payload += payload;
+    report.pointers += links;
+    report.control += control;
+    report.padding += sizeof(Node) - payload - control;
+    report.headers += memory::heap_overhead(sizeof(Node) + links);
+    node = skip_pointer<Node>(
+        node->next()[0].load(std::memory_order_acquire));
+  }
+  report.object = sizeof(*this);
+  return report;
+}
+
+// удаление по одному: элементы, вставленные во время clear(), могут остаться
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::clear() {
+  for (iterator it = begin(); it != end(); it = begin()) erase(it);
+}
+
+// Нижний уровень связывается первым - это и есть момент вставки. Узел
+// создаётся один раз, при повторах меняются только его ссылки.
+template <typename Key, typename T, typename Compare>
+std::pair<typename concurrent_map<Key, T, Compare>::iterator, bool>
+concurrent_map<Key, T, Compare>::insert(const value_type &value) {
+  EpochGuard guard;
+  SkipLink *preds[kMaxLevel];
+  Node *succs[kMaxLevel];
+  Node *node = nullptr;
+  for (;;) {
+    if (find_position(value.first, preds, succs)) {
+      if (node) {
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        Node::destroy(node);
+      }
+      return {iterator(succs[0]), false};
+    }
+    if (node == nullptr) {
+      node = Node::create(value.first, value.second, random_level());
+      // счётчик растёт до того, как узел станет виден: иначе erase мог бы
+      // уменьшить его раньше, и size() на миг ушёл бы через ноль
+      size_.fetch_add(1, std::memory_order_relaxed);
+    }
+    for (int level = 0; level < node->height_; ++level) {
+      node->next()[level].store(skip_link(succs[level]),
+                                std::memory_order_relaxed);
+    }
+    std::uintptr_t expected = skip_link(succs[0]);
+    if (preds[0][0].compare_exchange_strong(expected, skip_link(node))) break;
+  }
+  link_upper_levels(node, preds, succs);
+  iterator it(node);
+  release(node);
+  return {it, true};
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename concurrent_map<Key, T, Compare>::iterator, bool>
+concurrent_map<Key, T, Compare>::insert(const key_type &key,
+                                        const mapped_type &obj) {
+  return insert(value_type(key, obj));
+}
+
+// удаляется именно узел под итератором: если его уже удалили, а ключ
+// вставили заново, новый элемент остаётся
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::erase(iterator pos) {
+  if (pos != end()) erase_node(pos.node_);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::size_type
+concurrent_map<Key, T, Compare>::erase(const key_type &key) {
+  EpochGuard guard;
+  SkipLink *preds[kMaxLevel];
+  Node *succs[kMaxLevel];
+  if (!find_position(key, preds, succs)) return 0;
+  return erase_node(succs[0]);
+}
+
+// Ссылки метятся сверху вниз; кто пометил нижнюю, тот и удалил элемент.
+// Вызывающий держит эпоху, поэтому узел ещё не освобождён.
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::size_type
+concurrent_map<Key, T, Compare>::erase_node(Node *node) {
+  for (int level = node->height_ - 1; level >= 1; --level) {
+    std::uintptr_t link = node->next()[level].load();
+    while (!skip_marked(link) &&
+           !node->next()[level].compare_exchange_weak(link, link | 1U)) {
+    }
+  }
+  std::uintptr_t link = node->next()[0].load();
+  for (;;) {
+    if (skip_marked(link)) return 0;
+    if (node->next()[0].compare_exchange_weak(link, link | 1U)) break;
+  }
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  release(node);
+  return 1;
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::contains(const key_type &key) const {
+  return find(key) != end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::iterator
+concurrent_map<Key, T, Compare>::find(const key_type &key) const {
+  EpochGuard guard;
+  Node *node =
+      first_not_less([&](const key_type &k) { return comp_(k, key); });
+  if (node && comp_(key, node->key_)) node = nullptr;
+  return iterator(node);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::iterator
+concurrent_map<Key, T, Compare>::lower_bound(const key_type &key) const {
+  EpochGuard guard;
+  return iterator(
+      first_not_less([&](const key_type &k) { return comp_(k, key); }));
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::iterator
+concurrent_map<Key, T, Compare>::upper_bound(const key_type &key) const {
+  EpochGuard guard;
+  return iterator(
+      first_not_less([&](const key_type &k) { return !comp_(key, k); }));
+}
+
+// итераторы ещё не устарели: узлы, на которые они указывают, не
+// освобождаются, пока итераторы держат эпоху
+template <typename Key, typename T, typename Compare>
+template <class... Args>
+vector<std::pair<typename concurrent_map<Key, T, Compare>::iterator, bool>>
+concurrent_map<Key, T, Compare>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) result.push_back(insert(val));
+  return result;
+}
+
+// высота с распределением P(h) = 2^-h, свой генератор у каждого потока
+template <typename Key, typename T, typename Compare>
+int concurrent_map<Key, T, Compare>::random_level() {
+  static std::atomic<std::uint64_t> seeds{0x9E3779B97F4A7C15ULL};
+  thread_local std::uint64_t state =
+      seeds.fetch_add(0x9E3779B97F4A7C15ULL, std::memory_order_relaxed);
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return 1 + __builtin_ctzll(state | (1ULL << (kMaxLevel - 1)));
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::find_position(const key_type &key,
+                                                    SkipLink **preds,
+                                                    Node **succs) const {
+  bool found = false;
+  while (!try_find_position(key, preds, succs, &found)) {
+  }
+  return found;
+}
+
+// Спуск с вырезанием: помеченный узел на пути снимается CAS-ом по ссылке
+// предшественника; если предшественник изменился, поиск начинается заново.
+// preds[i] - ссылки узла, после которого стоит искомый на уровне i,
+// succs[i] - первый узел с ключом не меньше key.
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::try_find_position(const key_type &key,
+                                                        SkipLink **preds,
+                                                        Node **succs,
+                                                        bool *found) const {
+  SkipLink *pred = head_;
+  for (int level = kMaxLevel - 1; level >= 0; --level) {
+    Node *curr = skip_pointer<Node>(pred[level].load());
+    while (curr) {
+      std::uintptr_t succ = curr->next()[level].load();
+      if (skip_marked(succ)) {
+        std::uintptr_t expected = skip_link(curr);
+        std::uintptr_t unmarked = skip_link(skip_pointer<Node>(succ));
+        if (!pred[level].compare_exchange_strong(expected, unmarked)) {
+          return false;
+        }
+        curr = skip_pointer<Node>(succ);
+        continue;
+      }
+      if (!comp_(curr->key_, key)) break;
+      pred = curr->next();
+      curr = skip_pointer<Node>(succ);
+    }
+    preds[level] = pred;
+    succs[level] = curr;
+  }
+  *found = succs[0] && !comp_(key, succs[0]->key_);
+  return true;
+}
+
+// Поиск без записи: помеченные узлы просто пропускаются. Возвращает первый
+// неудалённый узел нижнего уровня, для которого less(ключ) ложно.
+template <typename Key, typename T, typename Compare>
+template <typename Less>
+typename concurrent_map<Key, T, Compare>::Node *
+concurrent_map<Key, T, Compare>::first_not_less(Less less) const {
+  const SkipLink *pred = head_;
+  Node *curr = nullptr;
+  for (int level = kMaxLevel - 1; level >= 0; --level) {
+    curr = skip_pointer<Node>(pred[level].load(std::memory_order_acquire));
+    while (curr) {
+      std::uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+      if (!skip_marked(succ)) {
+        if (!less(curr->key_)) break;
+        pred = curr->next();
+      }
+      curr = skip_pointer<Node>(succ);
+    }
+  }
+  return curr;
+}
+
+// Верхние уровни связываются по одному. Перед каждой попыткой своя ссылка
+// узла переставляется CAS-ом: если она уже помечена, узел удаляют, и
+// связывать дальше нельзя - иначе его можно вернуть в список после того,
+// как удаляющий поток его вырезал.
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::link_upper_levels(Node *node,
+                                                        SkipLink **preds,
+                                                        Node **succs) {
+  for (int level = 1; level < node->height_; ++level) {
+    for (;;) {
+      std::uintptr_t own = node->next()[level].load();
+      if (skip_marked(own)) return;
+      if (skip_pointer<Node>(own) != succs[level] &&
+          !node->next()[level].compare_exchange_strong(
+              own, skip_link(succs[level]))) {
+        continue;
+      }
+      std::uintptr_t expected = skip_link(succs[level]);
+      if (preds[level][level].compare_exchange_strong(expected,
+                                                      skip_link(node))) {
+        break;
+      }
+      find_position(node->key_, preds, succs);
+      if (skip_marked(node->next()[0].load())) return;
+    }
+  }
+}
+
+// последняя из двух операций (связывание и удаление) вырезает узел со всех
+// уровней повторным поиском и отдаёт его на освобождение
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::release(Node *node) {
+  if (node->owners_.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+  SkipLink *preds[kMaxLevel];
+  Node *succs[kMaxLevel];
+  find_position(node->key_, preds, succs);
+  EpochDomain::global().retire(node, &Node::destroy);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONCURRENT_MAP_H_
@@ -1,7 +1,31 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
 
+#include "s21_arena.h"
 #include "s21_array.h"
+#include "s21_btree_map.h"
+#include "s21_btree_multiset.h"
+#include "s21_btree_set.h"
+#include "s21_circular_buffer.h"
+#include "s21_concurrent_map.h"
+#include "s21_deque.h"
+#include "s21_dynamic_bitset.h"
+#include "s21_flat_map.h"
+#include "s21_flat_set.h"
+#include "s21_mpmc_queue.h"
 #include "s21_multiset.h"
+#include "s21_persistent_map.h"
+#include "s21_persistent_set.h"
+#include "s21_priority_queue.h"
+#include "s21_small_vector.h"
+#include "s21_soa_vector.h"
+#include "s21_spsc_queue.h"
+#include "s21_stable_vector.h"
+#include "s21_static_map.h"
+#include "s21_static_set.h"
+#include "s21_thread_pool.h"
+#include "s21_unordered_map.h"
+#include "s21_unordered_set.h"
+#include "s21_ws_deque.h"
 
 #endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
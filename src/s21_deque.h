@@ -0,0 +1,329 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_DEQUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_DEQUE_H_
+
+#include <cstddef>           // для std::size_t
+#include <cstdint>           // для SIZE_MAX
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::swap
+
+#include "iterator_deque.h"
+#include "memory_report.h"
+
+namespace s21 {
+// Двусторонняя очередь из блоков фиксированного размера (степень двойки)
+// и карты указателей на них. Элемент с номером i лежит в позиции
+// start_ + i: блок map_[pos >> kShift], смещение pos & kMask. При росте
+// перераспределяется только карта, сами элементы не переносятся, поэтому
+// ссылки на них остаются действительными.
+template <typename T>
+class deque {
+ private:
+  static constexpr std::size_t block_shift() {
+    std::size_t shift = 4;
+    while ((std::size_t(1) << (shift + 1)) * sizeof(T) <= 4096U) ++shift;
+    return shift;
+  }
+
+ public:
+  static constexpr std::size_t kShift = block_shift();
+  static constexpr std::size_t kBlockSize = std::size_t(1) << kShift;
+  static constexpr std::size_t kMask = kBlockSize - 1;
+
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = DequeIterator<value_type, kShift>;
+  using const_iterator = DequeIterator<const value_type, kShift>;
+  using size_type = std::size_t;
+
+  deque() {}
+  explicit deque(size_type n);
+  explicit deque(std::initializer_list<value_type> const &items);
+  deque(const deque &d);
+  deque(deque &&d);
+  ~deque();
+  deque &operator=(deque &&d);
+
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // выделенные блоки целиком (свободные ячейки в них - slack) и карта
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void clear();
+  void push_back(const_reference value);
+  void pop_back();
+  void push_front(const_reference value);
+  void pop_front();
+  void swap(deque &other);
+
+  template <class... Args>
+  void emplace_back(Args &&...args);
+  template <class... Args>
+  void emplace_front(Args &&...args);
+
+ private:
+  value_type **map_{nullptr};
+  size_type map_size_{0U};
+  size_type start_{0U};
+  size_type size_{0U};
+
+  reference slot(size_type pos) const;
+  void reallocate_map(size_type blocks_to_add, bool at_front);
+  void remove();
+};
+
+template <typename value_type>
+deque<value_type>::deque(size_type n) : deque() {
+  for (size_type i = 0; i < n; ++i) push_back(value_type());
+}
+
+template <typename value_type>
+deque<value_type>::deque(std::initializer_list<value_type> const &items)
+    : deque() {
+  for (auto &item : items) push_back(item);
+}
+
+template <typename value_type>
+deque<value_type>::deque(const deque &d) : deque() {
+  for (size_type i = 0; i < d.size_; ++i) push_back(d[i]);
+}
+
+template <typename value_type>
+deque<value_type>::deque(deque &&d) : deque() {
+  swap(d);
+}
+
+template <typename value_type>
+deque<value_type>::~deque() {
+  remove();
+}
+
+template <typename value_type>
+deque<value_type> &deque<value_type>::operator=(deque &&d) {
+  if (this != &d) {
+    remove();
+    swap(d);
+  }
+  return *this;
+}
+
+template <typename value_type>
+typename deque<value_type>::reference deque<value_type>::slot(
+    size_type pos) const {
+  return map_[pos >> kShift][pos & kMask];
+}
+
+// Перестраивает карту так, чтобы живые блоки оказались посередине и с
+// нужной стороны было не меньше blocks_to_add свободных ячеек. Карта растёт
+// вдвое, только если живые блоки занимают больше её половины; блоки вне
+// живого диапазона освобождаются.
+template <typename value_type>
+void deque<value_type>::reallocate_map(size_type blocks_to_add,
+                                       bool at_front) {
+  size_type first_block = start_ >> kShift;
+  size_type last_block = size_ ? (start_ + size_ - 1) >> kShift : first_block;
+  size_type live = last_block - first_block + 1;
+  size_type needed = live + blocks_to_add;
+
+  size_type map_size = map_size_;
+  if (needed * 2 > map_size) {
+    map_size = (map_size_ * 2 > needed * 2) ? map_size_ * 2 : needed * 2;
+    if (map_size < 8) map_size = 8;
+  }
+  value_type **map = new value_type *[map_size]();
+  size_type new_first = (map_size - needed) / 2 + (at_front ? blocks_to_add : 0);
+
+  for (size_type i = 0; i < map_size_; ++i) {
+    if (i >= first_block && i <= last_block) {
+      map[new_first + i - first_block] = map_[i];
+    } else {
+      delete[] map_[i];
+    }
+  }
+  delete[] map_;
+  map_ = map;
+  map_size_ = map_size;
+  start_ = (new_first << kShift) + (start_ & kMask);
+}
+
+template <typename value_type>
+void deque<value_type>::remove() {
+  for (size_type i = 0; i < map_size_; ++i) delete[] map_[i];
+  delete[] map_;
+  map_ = nullptr;
+  map_size_ = start_ = size_ = 0;
+}
+
+template <typename value_type>
+typename deque<value_type>::reference deque<value_type>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Out of range");
+  return slot(start_ + pos);
+}
+
+template <typename value_type>
+typename deque<value_type>::reference deque<value_type>::operator[](
+    size_type pos) {
+  return slot(start_ + pos);
+}
+
+template <typename value_type>
+typename deque<value_type>::const_reference deque<value_type>::operator[](
+    size_type pos) const {
+  return slot(start_ + pos);
+}
+
+template <typename value_type>
+typename deque<value_type>::const_reference deque<value_type>::front() const {
+  if (empty()) throw std::invalid_argument("the deque is empty");
+  return slot(start_);
+}
+
+template <typename value_type>
+typename deque<value_type>::const_reference deque<value_type>::back() const {
+  if (empty()) throw std::invalid_argument("the deque is empty");
+  return slot(start_ + size_ - 1);
+}
+
+template <typename value_type>
+typename deque<value_type>::iterator deque<value_type>::begin() {
+  return iterator(map_, start_);
+}
+
+template <typename value_type>
+typename deque<value_type>::iterator deque<value_type>::end() {
+  return iterator(map_, start_ + size_);
+}
+
+template <typename value_type>
+typename deque<value_type>::const_iterator deque<value_type>::begin() const {
+  return const_iterator(map_, start_);
+}
+
+template <typename value_type>
+typename deque<value_type>::const_iterator deque<value_type>::end() const {
+  return const_iterator(map_, start_ + size_);
+}
+
+template <typename value_type>
+bool deque<value_type>::empty() const {
+  return size_ == 0;
+}
+
+template <typename value_type>
+typename deque<value_type>::size_type deque<value_type>::size() const {
+  return size_;
+}
+
+template <typename value_type>
+typename deque<value_type>::size_type deque<value_type>::max_size() const {
+  return SIZE_MAX / (sizeof(value_type) * 2);
+}
+
+template <typename value_type>
+typename deque<value_type>::size_type deque<value_type>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type>
+MemoryReport deque<value_type>::memory_report() const {
+  size_type blocks = 0;
+  for (size_type i = 0; i < map_size_; ++i) {
+    if (map_[i]) ++blocks;
+  }
+  MemoryReport report =
+      memory::array_report<value_type>(size_, blocks * kBlockSize);
+  report.headers = blocks * memory::array_overhead<value_type>(kBlockSize);
+  report.pointers = map_size_ * sizeof(value_type *);
+  if (map_size_) {
+    report.headers += memory::heap_overhead(map_size_ * sizeof(value_type *));
+  }
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename value_type>
+void deque<value_type>::clear() {
+  remove();
+}
+
+template <typename value_type>
+void deque<value_type>::push_back(const_reference value) {
+  if (((start_ + size_) >> kShift) >= map_size_) reallocate_map(1, false);
+  value_type *&block = map_[(start_ + size_) >> kShift];
+  if (!block) block = new value_type[kBlockSize];
+  block[(start_ + size_) & kMask] = value;
+  ++size_;
+}
+
+template <typename value_type>
+void deque<value_type>::push_front(const_reference value) {
+  if (start_ == 0) reallocate_map(1, true);
+  value_type *&block = map_[(start_ - 1) >> kShift];
+  if (!block) block = new value_type[kBlockSize];
+  block[(start_ - 1) & kMask] = value;
+  --start_;
+  ++size_;
+}
+
+template <typename value_type>
+void deque<value_type>::pop_back() {
+  if (empty()) throw std::invalid_argument("the deque is empty");
+  slot(start_ + size_ - 1) = value_type();
+  --size_;
+}
+
+template <typename value_type>
+void deque<value_type>::pop_front() {
+  if (empty()) throw std::invalid_argument("the deque is empty");
+  slot(start_) = value_type();
+  ++start_;
+  --size_;
+}
+
+template <typename value_type>
+void deque<value_type>::swap(deque &other) {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+}
+
+template <class value_type>
+template <class... Args>
+void deque<value_type>::emplace_back(Args &&...args) {
+  if ((sizeof...(args)) == 0) {
+    value_type _empty = {};
+    push_back(_empty);
+  }
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) push_back(val);
+}
+
+template <class value_type>
+template <class... Args>
+void deque<value_type>::emplace_front(Args &&...args) {
+  if ((sizeof...(args)) == 0) {
+    value_type _empty = {};
+    push_front(_empty);
+  }
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) push_front(val);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_DEQUE_H_
@@ -0,0 +1,425 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_DYNAMIC_BITSET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_DYNAMIC_BITSET_H_
+
+#include <cstddef>    // для std::size_t
+#include <cstdint>    // для std::uint64_t
+#include <stdexcept>  // для исключений
+#include <utility>    // для std::move, std::swap
+
+#include "bulk_ops.h"
+#include "memory_report.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Битовый набор переменной длины: по биту на элемент в 64-битных словах,
+// а не по байту, как s21::vector<bool>. Бит pos лежит в слове pos / 64 на
+// месте pos % 64. Биты последнего слова за size() всегда нулевые, поэтому
+// count, сравнение и поиск работают по целым словам. Массовые set, reset
+// и flip идут по словам, count - через popcnt, поиск - через tzcnt, а
+// &=, |=, ^= и -= (and-not) - векторами из bulk_ops.
+class dynamic_bitset {
+ public:
+  using block_type = std::uint64_t;
+  using size_type = std::size_t;
+
+  static constexpr size_type kBlockBits = 64;
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // ссылка на один бит для неконстантного operator[]
+  class reference {
+   public:
+    reference &operator=(bool value) {
+      *word_ = value ? (*word_ | mask_) : (*word_ & ~mask_);
+      return *this;
+    }
+    reference &operator=(const reference &other) {
+      return *this = static_cast<bool>(other);
+    }
+    operator bool() const { return (*word_ & mask_) != 0; }
+    bool operator~() const { return (*word_ & mask_) == 0; }
+    reference &flip() {
+      *word_ ^= mask_;
+      return *this;
+    }
+
+   private:
+    friend class dynamic_bitset;
+    reference(block_type *word, block_type mask) : word_(word), mask_(mask) {}
+
+    block_type *word_;
+    block_type mask_;
+  };
+
+  dynamic_bitset() {}
+  explicit dynamic_bitset(size_type n, bool value = false);
+  dynamic_bitset(const dynamic_bitset &other);
+  dynamic_bitset(dynamic_bitset &&other);
+  ~dynamic_bitset() {}
+  dynamic_bitset &operator=(const dynamic_bitset &other);
+  dynamic_bitset &operator=(dynamic_bitset &&other);
+
+  bool test(size_type pos) const;
+  bool operator[](size_type pos) const;
+  reference operator[](size_type pos);
+  block_type *data();
+  const block_type *data() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type num_blocks() const;
+  // слова целиком - payload, неиспользуемая ёмкость слов - slack
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+  void resize(size_type n, bool value = false);
+  void push_back(bool value);
+  void clear();
+  void swap(dynamic_bitset &other);
+
+  // все биты, один бит или len битов с позиции pos
+  dynamic_bitset &set();
+  dynamic_bitset &set(size_type pos, bool value = true);
+  dynamic_bitset &set(size_type pos, size_type len, bool value);
+  dynamic_bitset &reset();
+  dynamic_bitset &reset(size_type pos);
+  dynamic_bitset &reset(size_type pos, size_type len);
+  dynamic_bitset &flip();
+  dynamic_bitset &flip(size_type pos);
+  dynamic_bitset &flip(size_type pos, size_type len);
+
+  size_type count() const;
+  bool all() const;
+  bool any() const;
+  bool none() const;
+
+  // позиция первого единичного бита (после pos), npos - если такого нет
+  size_type find_first() const;
+  size_type find_next(size_type pos) const;
+
+  // наборы должны быть одной длины, иначе std::invalid_argument
+  dynamic_bitset &operator&=(const dynamic_bitset &other);
+  dynamic_bitset &operator|=(const dynamic_bitset &other);
+  dynamic_bitset &operator^=(const dynamic_bitset &other);
+  // and-not: *this & ~other
+  dynamic_bitset &operator-=(const dynamic_bitset &other);
+  dynamic_bitset operator~() const;
+
+ private:
+  vector<block_type> words_;
+  size_type size_{0U};
+
+  static size_type blocks_for(size_type bits);
+  void check(size_type pos, size_type len = 1) const;
+  void trim();
+  void fill_range(size_type pos, size_type len, bool value);
+  void flip_range(size_type pos, size_type len);
+  dynamic_bitset &apply(BitOp op, const dynamic_bitset &other);
+  size_type scan(size_type block) const;
+};
+
+inline dynamic_bitset::dynamic_bitset(size_type n, bool value)
+    : words_(blocks_for(n)), size_(n) {
+  bulk_fill(words_.data(), words_.size(), value ? ~block_type{0} : 0);
+  trim();
+}
+
+inline dynamic_bitset::dynamic_bitset(const dynamic_bitset &other)
+    : words_(other.words_), size_(other.size_) {}
+
+inline dynamic_bitset::dynamic_bitset(dynamic_bitset &&other)
+    : words_(std::move(other.words_)), size_(other.size_) {
+  other.size_ = 0;
+}
+
+inline dynamic_bitset &dynamic_bitset::operator=(const dynamic_bitset &other) {
+  if (this != &other) {
+    dynamic_bitset tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::operator=(dynamic_bitset &&other) {
+  if (this != &other) {
+    dynamic_bitset tmp(std::move(other));
+    swap(tmp);
+  }
+  return *this;
+}
+
+inline bool dynamic_bitset::test(size_type pos) const {
+  check(pos);
+  return (*this)[pos];
+}
+
+inline bool dynamic_bitset::operator[](size_type pos) const {
+  return (words_[pos / kBlockBits] >> (pos % kBlockBits)) & 1U;
+}
+
+inline dynamic_bitset::reference dynamic_bitset::operator[](size_type pos) {
+  return reference(&words_[pos / kBlockBits],
+                   block_type{1} << (pos % kBlockBits));
+}
+
+inline dynamic_bitset::block_type *dynamic_bitset::data() {
+  return words_.data();
+}
+
+inline const dynamic_bitset::block_type *dynamic_bitset::data() const {
+  return words_.data();
+}
+
+inline bool dynamic_bitset::empty() const { return size_ == 0; }
+
+inline dynamic_bitset::size_type dynamic_bitset::size() const { return size_; }
+
+inline dynamic_bitset::size_type dynamic_bitset::num_blocks() const {
+  return words_.size();
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::memory_usage() const {
+  return memory_report().total();
+}
+
+inline MemoryReport dynamic_bitset::memory_report() const {
+  MemoryReport report = words_.memory_report();
+  report.object = sizeof(*this);
+  return report;
+}
+
+// слова добавляются нулевыми, ёмкость растёт не меньше чем вдвое
+inline void dynamic_bitset::resize(size_type n, bool value) {
+  size_type old_size = size_;
+  size_type blocks = blocks_for(n);
+  if (blocks > words_.capacity()) {
+    size_type twice = words_.capacity() * 2;
+    words_.reserve(blocks > twice ? blocks : twice);
+  }
+  while (words_.size() < blocks) words_.push_back(0);
+  while (words_.size() > blocks) words_.pop_back();
+  size_ = n;
+  if (n > old_size && value) fill_range(old_size, n - old_size, true);
+  trim();
+}
+
+inline void dynamic_bitset::push_back(bool value) {
+  if (size_ % kBlockBits == 0) words_.push_back(0);
+  ++size_;
+  (*this)[size_ - 1] = value;
+}
+
+inline void dynamic_bitset::clear() {
+  words_.clear();
+  size_ = 0;
+}
+
+inline void dynamic_bitset::swap(dynamic_bitset &other) {
+  words_.swap(other.words_);
+  std::swap(size_, other.size_);
+}
+
+inline dynamic_bitset &dynamic_bitset::set() {
+  bulk_fill(words_.data(), words_.size(), ~block_type{0});
+  trim();
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::set(size_type pos, bool value) {
+  check(pos);
+  (*this)[pos] = value;
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::set(size_type pos, size_type len,
+                                           bool value) {
+  check(pos, len);
+  fill_range(pos, len, value);
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::reset() {
+  bulk_fill(words_.data(), words_.size(), block_type{0});
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::reset(size_type pos) {
+  return set(pos, false);
+}
+
+inline dynamic_bitset &dynamic_bitset::reset(size_type pos, size_type len) {
+  return set(pos, len, false);
+}
+
+inline dynamic_bitset &dynamic_bitset::flip() {
+  flip_range(0, size_);
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::flip(size_type pos) {
+  check(pos);
+  (*this)[pos].flip();
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::flip(size_type pos, size_type len) {
+  check(pos, len);
+  flip_range(pos, len);
+  return *this;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::count() const {
+  return bulk_popcount(words_.data(), words_.size());
+}
+
+inline bool dynamic_bitset::all() const { return count() == size_; }
+
+inline bool dynamic_bitset::any() const { return find_first() != npos; }
+
+inline bool dynamic_bitset::none() const { return !any(); }
+
+inline dynamic_bitset::size_type dynamic_bitset::find_first() const {
+  return scan(0);
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::find_next(
+    size_type pos) const {
+  if (pos >= size_ || ++pos == size_) return npos;
+  size_type block = pos / kBlockBits;
+  block_type word = words_[block] >> (pos % kBlockBits);
+  if (word != 0) return pos + __builtin_ctzll(word);
+  return scan(block + 1);
+}
+
+inline dynamic_bitset &dynamic_bitset::operator&=(
+    const dynamic_bitset &other) {
+  return apply(BitOp::kAnd, other);
+}
+
+inline dynamic_bitset &dynamic_bitset::operator|=(
+    const dynamic_bitset &other) {
+  return apply(BitOp::kOr, other);
+}
+
+inline dynamic_bitset &dynamic_bitset::operator^=(
+    const dynamic_bitset &other) {
+  return apply(BitOp::kXor, other);
+}
+
+inline dynamic_bitset &dynamic_bitset::operator-=(
+    const dynamic_bitset &other) {
+  return apply(BitOp::kAndNot, other);
+}
+
+inline dynamic_bitset dynamic_bitset::operator~() const {
+  dynamic_bitset result(*this);
+  result.flip();
+  return result;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::blocks_for(size_type bits) {
+  return bits / kBlockBits + (bits % kBlockBits != 0);
+}
+
+inline void dynamic_bitset::check(size_type pos, size_type len) const {
+  if (pos > size_ || len > size_ - pos) {
+    throw std::out_of_range("Out of range");
+  }
+}
+
+// обнуляет биты последнего слова за size()
+inline void dynamic_bitset::trim() {
+  if (size_ % kBlockBits != 0) {
+    words_[words_.size() - 1] &= (block_type{1} << (size_ % kBlockBits)) - 1;
+  }
+}
+
+// неполные слова по краям - через маску, целые слова между ними - bulk_fill
+inline void dynamic_bitset::fill_range(size_type pos, size_type len,
+                                       bool value) {
+  if (len == 0) return;
+  size_type first = pos / kBlockBits, last = (pos + len - 1) / kBlockBits;
+  block_type head = ~block_type{0} << (pos % kBlockBits);
+  size_type end_bit = (pos + len - 1) % kBlockBits;
+  block_type tail = ~block_type{0} >> (kBlockBits - 1 - end_bit);
+  block_type fill = value ? ~block_type{0} : 0;
+  if (first == last) {
+    block_type mask = head & tail;
+    words_[first] = (words_[first] & ~mask) | (fill & mask);
+    return;
+  }
+  words_[first] = (words_[first] & ~head) | (fill & head);
+  bulk_fill(words_.data() + first + 1, last - first - 1, fill);
+  words_[last] = (words_[last] & ~tail) | (fill & tail);
+}
+
+inline void dynamic_bitset::flip_range(size_type pos, size_type len) {
+  if (len == 0) return;
+  size_type first = pos / kBlockBits, last = (pos + len - 1) / kBlockBits;
+  block_type head = ~block_type{0} << (pos % kBlockBits);
+  size_type end_bit = (pos + len - 1) % kBlockBits;
+  block_type tail = ~block_type{0} >> (kBlockBits - 1 - end_bit);
+  if (first == last) {
+    words_[first] ^= head & tail;
+    return;
+  }
+  words_[first] ^= head;
+  for (size_type i = first + 1; i < last; ++i) words_[i] = ~words_[i];
+  words_[last] ^= tail;
+}
+
+inline dynamic_bitset &dynamic_bitset::apply(BitOp op,
+                                             const dynamic_bitset &other) {
+  if (size_ != other.size_) throw std::invalid_argument("size mismatch");
+  bulk_bitwise(op, words_.data(), other.words_.data(), words_.size());
+  return *this;
+}
+
+// первый единичный бит начиная со слова block
+inline dynamic_bitset::size_type dynamic_bitset::scan(size_type block) const {
+  for (; block < words_.size(); ++block) {
+    if (words_[block] != 0) {
+      return block * kBlockBits + __builtin_ctzll(words_[block]);
+    }
+  }
+  return npos;
+}
+
+inline bool operator==(const dynamic_bitset &lhs, const dynamic_bitset &rhs) {
+  return lhs.size() == rhs.size() &&
+         bulk_equal(lhs.data(), rhs.data(), lhs.num_blocks());
+}
+
+inline bool operator!=(const dynamic_bitset &lhs, const dynamic_bitset &rhs) {
+  return !(lhs == rhs);
+}
+
+inline dynamic_bitset operator&(const dynamic_bitset &lhs,
+                                const dynamic_bitset &rhs) {
+  dynamic_bitset result(lhs);
+  result &= rhs;
+  return result;
+}
+
+inline dynamic_bitset operator|(const dynamic_bitset &lhs,
+                                const dynamic_bitset &rhs) {
+  dynamic_bitset result(lhs);
+  result |= rhs;
+  return result;
+}
+
+inline dynamic_bitset operator^(const dynamic_bitset &lhs,
+                                const dynamic_bitset &rhs) {
+  dynamic_bitset result(lhs);
+  result ^= rhs;
+  return result;
+}
+
+inline dynamic_bitset operator-(const dynamic_bitset &lhs,
+                                const dynamic_bitset &rhs) {
+  dynamic_bitset result(lhs);
+  result -= rhs;
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_DYNAMIC_BITSET_H_
@@ -0,0 +1,457 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_FLAT_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_FLAT_MAP_H_
+
+#include <algorithm>         // для std::stable_sort
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::pair, std::move
+
+#include "flat_search.h"
+#include "iterator_flat.h"
+#include "memory_report.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Отображение на двух отсортированных s21::vector - ключей и значений.
+// Поиск - бинарный без ветвлений по плотному массиву ключей, вставка и
+// удаление - O(n) сдвигом. Рассчитано на словари, которые строятся один раз
+// (конструкторы от диапазона сортируют и убирают дубликаты за O(n log n))
+// и много читаются. Интерфейс повторяет s21::map; при повторяющихся ключах
+// остаётся первое вхождение, как при поэлементном insert.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = std::pair<const key_type &, mapped_type &>;
+  using const_reference = std::pair<const key_type &, const mapped_type &>;
+  using iterator = FlatMapIterator<key_type, mapped_type>;
+  using const_iterator = FlatMapIterator<key_type, const mapped_type>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  flat_map() {}
+  explicit flat_map(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  flat_map(InputIt first, InputIt last);
+  flat_map(vector<key_type> &&keys, vector<mapped_type> &&values);
+  flat_map(const flat_map &m);
+  flat_map(flat_map &&m);
+  ~flat_map() {}
+  flat_map &operator=(const flat_map &m);
+  flat_map &operator=(flat_map &&m);
+
+  mapped_type &at(const key_type &key);
+  const mapped_type &at(const key_type &key) const;
+  mapped_type &operator[](const key_type &key);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  void shrink_to_fit();
+  // ключи и значения - в отдельных массивах, поэтому выравнивания пары нет
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  const vector<key_type> &keys() const;
+  const vector<mapped_type> &values() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(flat_map &other);
+  void merge(flat_map &other);
+
+  bool contains(const key_type &key) const;
+  iterator find(const key_type &key);
+  const_iterator find(const key_type &key) const;
+  iterator lower_bound(const key_type &key);
+  const_iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key);
+  const_iterator upper_bound(const key_type &key) const;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+
+ private:
+  vector<key_type> keys_;
+  vector<mapped_type> values_;
+  Compare comp_{};
+
+  size_type lower_index(const key_type &key) const;
+  size_type find_index(const key_type &key) const;
+  iterator iterator_at(size_type index);
+  const_iterator iterator_at(size_type index) const;
+  void sort_unique();
+};
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare>::flat_map(
+    std::initializer_list<value_type> const &items)
+    : flat_map(items.begin(), items.end()) {}
+
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+flat_map<Key, T, Compare>::flat_map(InputIt first, InputIt last) {
+  for (; first != last; ++first) {
+    keys_.push_back(first->first);
+    values_.push_back(first->second);
+  }
+  sort_unique();
+}
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare>::flat_map(vector<key_type> &&keys,
+                                    vector<mapped_type> &&values) {
+  if (keys.size() != values.size()) {
+    throw std::invalid_argument("keys and values differ in size");
+  }
+  keys_ = std::move(keys);
+  values_ = std::move(values);
+  sort_unique();
+}
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare>::flat_map(const flat_map &m)
+    : keys_(m.keys_), values_(m.values_), comp_(m.comp_) {}
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare>::flat_map(flat_map &&m)
+    : keys_(std::move(m.keys_)),
+      values_(std::move(m.values_)),
+      comp_(m.comp_) {}
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare> &flat_map<Key, T, Compare>::operator=(
+    const flat_map &m) {
+  if (this != &m) {
+    flat_map tmp(m);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare> &flat_map<Key, T, Compare>::operator=(
+    flat_map &&m) {
+  if (this != &m) {
+    keys_ = std::move(m.keys_);
+    values_ = std::move(m.values_);
+    comp_ = m.comp_;
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+T &flat_map<Key, T, Compare>::at(const key_type &key) {
+  size_type index = find_index(key);
+  if (index == size()) throw std::out_of_range("Out of range");
+  return values_[index];
+}
+
+template <typename Key, typename T, typename Compare>
+const T &flat_map<Key, T, Compare>::at(const key_type &key) const {
+  size_type index = find_index(key);
+  if (index == size()) throw std::out_of_range("Out of range");
+  return values_[index];
+}
+
+template <typename Key, typename T, typename Compare>
+T &flat_map<Key, T, Compare>::operator[](const key_type &key) {
+  return *insert(key, mapped_type()).first.value_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::begin() {
+  return iterator_at(0);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::end() {
+  return iterator_at(size());
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::begin() const {
+  return iterator_at(0);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::end() const {
+  return iterator_at(size());
+}
+
+template <typename Key, typename T, typename Compare>
+bool flat_map<Key, T, Compare>::empty() const {
+  return keys_.size() == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type flat_map<Key, T, Compare>::size()
+    const {
+  return keys_.size();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::max_size() const {
+  return keys_.max_size() < values_.max_size() ? keys_.max_size()
+                                               : values_.max_size();
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::reserve(size_type size) {
+  keys_.reserve(size);
+  values_.reserve(size);
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::shrink_to_fit() {
+  keys_.shrink_to_fit();
+  values_.shrink_to_fit();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename Key, typename T, typename Compare>
+MemoryReport flat_map<Key, T, Compare>::memory_report() const {
+  MemoryReport report = keys_.memory_report();
+  report += values_.memory_report();
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename Key, typename T, typename Compare>
+const vector<Key> &flat_map<Key, T, Compare>::keys() const {
+  return keys_;
+}
+
+template <typename Key, typename T, typename Compare>
+const vector<T> &flat_map<Key, T, Compare>::values() const {
+  return values_;
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::clear() {
+  keys_.clear();
+  values_.clear();
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert(const value_type &value) {
+  return insert(value.first, value.second);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert(const key_type &key, const mapped_type &obj) {
+  size_type index = lower_index(key);
+  if (index != size() && !comp_(key, keys_[index])) {
+    return {iterator_at(index), false};
+  }
+  keys_.insert(keys_.begin() + index, key);
+  values_.insert(values_.begin() + index, obj);
+  return {iterator_at(index), true};
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert_or_assign(const key_type &key,
+                                            const mapped_type &obj) {
+  std::pair<iterator, bool> result = insert(key, obj);
+  if (!result.second) *result.first.value_ = obj;
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::erase(iterator pos) {
+  if (pos == end()) return;
+  size_type index = static_cast<size_type>(pos.key_ - keys_.data());
+  keys_.erase(keys_.begin() + index);
+  values_.erase(values_.begin() + index);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type flat_map<Key, T, Compare>::erase(
+    const key_type &key) {
+  size_type index = find_index(key);
+  if (index == size()) return 0;
+  erase(iterator_at(index));
+  return 1;
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::swap(flat_map &other) {
+  keys_.swap(other.keys_);
+  values_.swap(other.values_);
+  std::swap(comp_, other.comp_);
+}
+
+// Слияние двух отсортированных массивов за один проход: ключи, которые уже
+// есть в этом отображении, остаются в other, как у s21::map::merge.
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::merge(flat_map &other) {
+  if (this == &other || other.empty()) return;
+  vector<key_type> keys, rest_keys;
+  vector<mapped_type> values, rest_values;
+  keys.reserve(size() + other.size());
+  values.reserve(size() + other.size());
+  size_type i = 0, j = 0;
+  while (i < size() || j < other.size()) {
+    bool take_other = j < other.size() &&
+                      (i == size() || comp_(other.keys_[j], keys_[i]));
+    if (take_other) {
+      keys.push_back(std::move(other.keys_[j]));
+      values.push_back(std::move(other.values_[j++]));
+      continue;
+    }
+    if (j < other.size() && !comp_(keys_[i], other.keys_[j])) {
+      rest_keys.push_back(std::move(other.keys_[j]));
+      rest_values.push_back(std::move(other.values_[j++]));
+    }
+    keys.push_back(std::move(keys_[i]));
+    values.push_back(std::move(values_[i++]));
+  }
+  keys_ = std::move(keys);
+  values_ = std::move(values);
+  other.keys_ = std::move(rest_keys);
+  other.values_ = std::move(rest_values);
+}
+
+template <typename Key, typename T, typename Compare>
+bool flat_map<Key, T, Compare>::contains(const key_type &key) const {
+  return find_index(key) != size();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::find(
+    const key_type &key) {
+  return iterator_at(find_index(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::find(const key_type &key) const {
+  return iterator_at(find_index(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::lower_bound(const key_type &key) {
+  return iterator_at(lower_index(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::lower_bound(const key_type &key) const {
+  return iterator_at(lower_index(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::upper_bound(const key_type &key) {
+  return iterator_at(branchless_upper_bound(keys_.data(), size(), key, comp_));
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::upper_bound(const key_type &key) const {
+  return iterator_at(branchless_upper_bound(keys_.data(), size(), key, comp_));
+}
+
+// Итераторы, возвращённые вставками, сдвигаются последующими вставками,
+// поэтому они строятся поиском после того, как вставлено всё.
+template <typename Key, typename T, typename Compare>
+template <class... Args>
+vector<std::pair<typename flat_map<Key, T, Compare>::iterator, bool>>
+flat_map<Key, T, Compare>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  vector<bool> inserted;
+  for (auto &val : arg) inserted.push_back(insert(val).second);
+  size_type i = 0;
+  for (auto &val : arg) result.push_back({find(val.first), inserted[i++]});
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::lower_index(const key_type &key) const {
+  return branchless_lower_bound(keys_.data(), size(), key, comp_);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::find_index(const key_type &key) const {
+  size_type index = lower_index(key);
+  return (index != size() && !comp_(key, keys_[index])) ? index : size();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::iterator_at(size_type index) {
+  return iterator(keys_.data() + index, values_.data() + index);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::iterator_at(size_type index) const {
+  return const_iterator(keys_.data() + index, values_.data() + index);
+}
+
+// Сортирует ключи вместе со значениями через перестановку индексов
+// (устойчиво, чтобы из равных ключей выжил первый) и выбрасывает дубликаты.
+// Уже отсортированный вход проверяется за один проход и не копируется.
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::sort_unique() {
+  size_type n = size();
+  const key_type *k = keys_.data();
+  bool sorted = true;
+  for (size_type i = 1; i < n && sorted; ++i) sorted = comp_(k[i - 1], k[i]);
+  if (sorted) return;
+
+  vector<size_type> order(n);
+  for (size_type i = 0; i < n; ++i) order[i] = i;
+  std::stable_sort(order.data(), order.data() + n,
+                   [&](size_type a, size_type b) { return comp_(k[a], k[b]); });
+
+  vector<key_type> keys;
+  vector<mapped_type> values;
+  keys.reserve(n);
+  values.reserve(n);
+  for (size_type i = 0; i < n; ++i) {
+    size_type from = order[i];
+    if (keys.empty() || comp_(keys.back(), keys_[from])) {
+      keys.push_back(std::move(keys_[from]));
+      values.push_back(std::move(values_[from]));
+    }
+  }
+  keys_ = std::move(keys);
+  values_ = std::move(values);
+  if (size() < n) shrink_to_fit();
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_FLAT_MAP_H_
@@ -0,0 +1,284 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_FLAT_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_FLAT_SET_H_
+
+#include <algorithm>         // для std::sort, std::unique
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <utility>           // для std::pair, std::move
+
+#include "flat_search.h"
+#include "memory_report.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Множество на одном отсортированном s21::vector: поиск - бинарный без
+// ветвлений, вставка и удаление - O(n) сдвигом. Интерфейс повторяет
+// s21::set и дополнен lower_bound/upper_bound.
+template <typename Key, typename Compare = std::less<Key>>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = const value_type *;
+  using const_iterator = const value_type *;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  flat_set() {}
+  explicit flat_set(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  flat_set(InputIt first, InputIt last);
+  explicit flat_set(vector<key_type> &&keys);
+  flat_set(const flat_set &s);
+  flat_set(flat_set &&s);
+  ~flat_set() {}
+  flat_set &operator=(const flat_set &s);
+  flat_set &operator=(flat_set &&s);
+
+  iterator begin() const;
+  iterator end() const;
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  void shrink_to_fit();
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(flat_set &other);
+  void merge(flat_set &other);
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+
+ private:
+  vector<key_type> keys_;
+  Compare comp_{};
+
+  size_type lower_index(const key_type &key) const;
+  void sort_unique();
+};
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare>::flat_set(
+    std::initializer_list<value_type> const &items)
+    : flat_set(items.begin(), items.end()) {}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+flat_set<Key, Compare>::flat_set(InputIt first, InputIt last) {
+  for (; first != last; ++first) keys_.push_back(*first);
+  sort_unique();
+}
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare>::flat_set(vector<key_type> &&keys)
+    : keys_(std::move(keys)) {
+  sort_unique();
+}
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare>::flat_set(const flat_set &s)
+    : keys_(s.keys_), comp_(s.comp_) {}
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare>::flat_set(flat_set &&s)
+    : keys_(std::move(s.keys_)), comp_(s.comp_) {}
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare> &flat_set<Key, Compare>::operator=(const flat_set &s) {
+  if (this != &s) {
+    flat_set tmp(s);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare> &flat_set<Key, Compare>::operator=(flat_set &&s) {
+  if (this != &s) {
+    keys_ = std::move(s.keys_);
+    comp_ = s.comp_;
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::begin()
+    const {
+  return keys_.data();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::end() const {
+  return keys_.data() + keys_.size();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::find(
+    const key_type &key) const {
+  size_type index = lower_index(key);
+  return (index != size() && !comp_(key, keys_[index])) ? begin() + index
+                                                         : end();
+}
+
+template <typename Key, typename Compare>
+bool flat_set<Key, Compare>::contains(const key_type &key) const {
+  return find(key) != end();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::lower_bound(
+    const key_type &key) const {
+  return begin() + lower_index(key);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::upper_bound(
+    const key_type &key) const {
+  return begin() + branchless_upper_bound(keys_.data(), size(), key, comp_);
+}
+
+template <typename Key, typename Compare>
+bool flat_set<Key, Compare>::empty() const {
+  return keys_.size() == 0;
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::size()
+    const {
+  return keys_.size();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::max_size()
+    const {
+  return keys_.max_size();
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::reserve(size_type size) {
+  keys_.reserve(size);
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::shrink_to_fit() {
+  keys_.shrink_to_fit();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type
+flat_set<Key, Compare>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename Key, typename Compare>
+MemoryReport flat_set<Key, Compare>::memory_report() const {
+  MemoryReport report = keys_.memory_report();
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::clear() {
+  keys_.clear();
+}
+
+template <typename Key, typename Compare>
+std::pair<typename flat_set<Key, Compare>::iterator, bool>
+flat_set<Key, Compare>::insert(const value_type &value) {
+  size_type index = lower_index(value);
+  if (index != size() && !comp_(value, keys_[index])) {
+    return {begin() + index, false};
+  }
+  keys_.insert(keys_.begin() + index, value);
+  return {begin() + index, true};
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::erase(iterator pos) {
+  if (pos != end()) keys_.erase(keys_.begin() + (pos - begin()));
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::erase(
+    const key_type &key) {
+  iterator pos = find(key);
+  if (pos == end()) return 0;
+  erase(pos);
+  return 1;
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::swap(flat_set &other) {
+  keys_.swap(other.keys_);
+  std::swap(comp_, other.comp_);
+}
+
+// слияние за один проход; элементы, которые уже есть здесь, остаются в other
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::merge(flat_set &other) {
+  if (this == &other || other.empty()) return;
+  vector<key_type> keys, rest;
+  keys.reserve(size() + other.size());
+  size_type i = 0, j = 0;
+  while (i < size() || j < other.size()) {
+    if (j < other.size() && (i == size() || comp_(other.keys_[j], keys_[i]))) {
+      keys.push_back(std::move(other.keys_[j++]));
+      continue;
+    }
+    if (j < other.size() && !comp_(keys_[i], other.keys_[j])) {
+      rest.push_back(std::move(other.keys_[j++]));
+    }
+    keys.push_back(std::move(keys_[i++]));
+  }
+  keys_ = std::move(keys);
+  other.keys_ = std::move(rest);
+}
+
+template <typename Key, typename Compare>
+template <class... Args>
+vector<std::pair<typename flat_set<Key, Compare>::iterator, bool>>
+flat_set<Key, Compare>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  vector<bool> inserted;
+  for (auto &val : arg) inserted.push_back(insert(val).second);
+  size_type i = 0;
+  for (auto &val : arg) result.push_back({find(val), inserted[i++]});
+  return result;
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::lower_index(
+    const key_type &key) const {
+  return branchless_lower_bound(keys_.data(), size(), key, comp_);
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::sort_unique() {
+  key_type *first = keys_.data();
+  key_type *last = first + keys_.size();
+  std::sort(first, last, comp_);
+  last = std::unique(first, last, [&](const key_type &a, const key_type &b) {
+    return !comp_(a, b) && !comp_(b, a);
+  });
+  while (keys_.size() > static_cast<size_type>(last - first)) keys_.pop_back();
+  keys_.shrink_to_fit();
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_FLAT_SET_H_
@@ -2,15 +2,20 @@
 #define CPP2_S21_CONTAINERS_SRC_S21_LIST_H_
 
 #include <cstddef>           // для std::size_t
+#include <functional>        // для std::equal_to
 #include <initializer_list>  // для istd::nitializer_list
 #include <stdexcept>         // для исключений
 
 #include "iterator_list.h"
+#include "memory_report.h"
+#include "memory_source.h"
 #include "node_double.h"
 
 namespace s21 {
-template <typename T>
-class list {
+// Source - откуда берутся узлы (см. memory_source.h); пустой HeapSource
+// по умолчанию не увеличивает размер списка
+template <typename T, typename Source = HeapSource>
+class list : private TrackedSource<Tracked::kList, Source> {
  public:
   using value_type = T;
   using reference = T &;
@@ -27,7 +32,7 @@ class list {
   list(const list &l);
   list(list &&l);
   ~list();
-  list operator=(list &&l);
+  list &operator=(list &&l);
 
   const_reference front();
   const_reference back();
@@ -38,6 +43,9 @@ class list {
   bool empty();
   size_type size();
   size_type max_size();
+  // узлы с фиктивным; его значение учитывается как slack
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
 
   void clear();
   iterator insert(iterator pos, const_reference value);
@@ -47,12 +55,20 @@ class list {
   void push_front(const_reference value);
   void pop_front();
   void swap(list &other);
+  // узлы переходят в этот список, поэтому источник памяти должен быть
+  // тем же, иначе std::invalid_argument
   void merge(list &other);
   void splice(const_iterator pos, list &other);
   void reverse();
-  void unique();
+  size_type unique();
   void sort();
 
+  size_type remove(const_reference value);
+  template <typename UnaryPredicate>
+  size_type remove_if(UnaryPredicate pred);
+  template <typename BinaryPredicate>
+  size_type unique(BinaryPredicate pred);
+
   template <typename... Args>
   iterator emplace(const_iterator pos, Args &&...args);
   template <typename... Args>
@@ -60,217 +76,272 @@ class list {
   template <typename... Args>
   void emplace_front(Args &&...args);
 
+ protected:
+  using Memory = TrackedSource<Tracked::kList, Source>;
+
+  // для pmr::list: узлы из ресурса
+  explicit list(const Source &source);
+  list(const list &l, const Source &source);
+
+  Memory &memory() { return *this; }
+  const Memory &memory() const { return *this; }
+
  private:
   size_type size_;
-  Node *head_;
-  Node *tail_;
-
-  void creat_first_node(const_reference value);
+  // фиктивный узел кольцевого списка: sentinel_->next_ - первый элемент,
+  // sentinel_->prev_ - последний, сам sentinel_ служит end()
+  Node *sentinel_;
+
+  void link_before(Node *pos, Node *node);
+  void unlink(Node *node);
+  void transfer(Node *pos, Node *first, Node *last);
+  void unlink_range(Node *first, Node *last, size_type count, Node **garbage);
+  void free_chain(Node *first);
 };
 
-template <typename T>
-s21::list<T>::list() : size_(0), head_(nullptr), tail_(nullptr) {}
+template <typename T, typename Source>
+s21::list<T, Source>::list() : list(Source()) {}
+
+template <typename T, typename Source>
+s21::list<T, Source>::list(const Source &source)
+    : Memory(source),
+      size_(0),
+      sentinel_(memory().template create<Node>()) {
+  sentinel_->next_ = sentinel_;
+  sentinel_->prev_ = sentinel_;
+}
 
-template <typename T>
-s21::list<T>::list(size_type n) : list() {
+template <typename T, typename Source>
+s21::list<T, Source>::list(size_type n) : list() {
   for (size_type i = 0; i < n; ++i) {
-    push_front(0);
+    push_back(value_type());
   }
 }
 
-template <typename T>
-s21::list<T>::list(const std::initializer_list<T> &items) : list() {
+template <typename T, typename Source>
+s21::list<T, Source>::list(const std::initializer_list<T> &items) : list() {
   for (auto item : items) {
     push_back(item);
   }
 }
 
-template <typename T>
-s21::list<T>::list(const s21::list<T> &l) : list() {
-  for (Node *i = l.head_; i != l.tail_->next_;) {
+template <typename T, typename Source>
+s21::list<T, Source>::list(const s21::list<T, Source> &l)
+    : list(l, Source()) {}
+
+template <typename T, typename Source>
+s21::list<T, Source>::list(const s21::list<T, Source> &l,
+                           const Source &source)
+    : list(source) {
+  for (Node *i = l.sentinel_->next_; i != l.sentinel_; i = i->next_) {
     push_back(i->value_);
-    i = i->next_;
   }
 }
 
-template <typename T>
-s21::list<T>::list(s21::list<T> &&l) : list() {
+template <typename T, typename Source>
+s21::list<T, Source>::list(s21::list<T, Source> &&l) : list() {
   swap(l);
 }
 
-template <typename T>
-s21::list<T> s21::list<T>::operator=(s21::list<T> &&l) {
-  clear();
-  swap(l);
+template <typename T, typename Source>
+s21::list<T, Source> &s21::list<T, Source>::operator=(
+    s21::list<T, Source> &&l) {
+  if (this != &l) {
+    clear();
+    swap(l);
+  }
+  return *this;
 }
 
-template <typename T>
-s21::list<T>::~list() {
+template <typename T, typename Source>
+s21::list<T, Source>::~list() {
+  if (memory().skip_destroy()) return;
   clear();
+  memory().destroy(sentinel_);
 }
 
-template <typename T>
-void s21::list<T>::creat_first_node(const_reference value) {
-  Node *new_node = new node_double(value);
+template <typename T, typename Source>
+void s21::list<T, Source>::link_before(Node *pos, Node *node) {
+  node->next_ = pos;
+  node->prev_ = pos->prev_;
+  pos->prev_->next_ = node;
+  pos->prev_ = node;
   ++size_;
-  head_ = tail_ = new_node;
-  head_->next_ = nullptr;
-  head_->prev_ = nullptr;
-}
-
-template <typename T>
-void s21::list<T>::push_front(const_reference value) {
-  if (size_ == 0) {
-    creat_first_node(value);
-  } else {
-    Node *new_node = new node_double(value);
-    ++size_;
-    head_->prev_ = new_node;
-    new_node->next_ = head_;
-    new_node->prev_ = nullptr;
-    head_ = new_node;
-  }
 }
 
-template <typename T>
-void s21::list<T>::push_back(const_reference value) {
-  if (size_ == 0) {
-    creat_first_node(value);
-  } else {
-    Node *new_node = new node_double(value);
-    ++size_;
-    tail_->next_ = new_node;
-    new_node->prev_ = tail_;
-    new_node->next_ = nullptr;
-    tail_ = new_node;
+template <typename T, typename Source>
+void s21::list<T, Source>::unlink(Node *node) {
+  node->prev_->next_ = node->next_;
+  node->next_->prev_ = node->prev_;
+  --size_;
+}
+
+// переносит узлы [first, last] (возможно, из другого списка) перед pos,
+// счётчики размеров корректирует вызывающая сторона
+template <typename T, typename Source>
+void s21::list<T, Source>::transfer(Node *pos, Node *first, Node *last) {
+  first->prev_->next_ = last->next_;
+  last->next_->prev_ = first->prev_;
+  first->prev_ = pos->prev_;
+  last->next_ = pos;
+  pos->prev_->next_ = first;
+  pos->prev_ = last;
+}
+
+// отцепляет подряд идущие узлы [first, last] одной перелинковкой и
+// добавляет их в цепочку garbage (через next_) для освобождения free_chain()
+template <typename T, typename Source>
+void s21::list<T, Source>::unlink_range(Node *first, Node *last,
+                                        size_type count, Node **garbage) {
+  first->prev_->next_ = last->next_;
+  last->next_->prev_ = first->prev_;
+  last->next_ = *garbage;
+  *garbage = first;
+  size_ -= count;
+}
+
+template <typename T, typename Source>
+void s21::list<T, Source>::free_chain(Node *first) {
+  while (first) {
+    Node *next = first->next_;
+    memory().destroy(first);
+    first = next;
   }
 }
 
-template <typename T>
-typename s21::list<T>::iterator s21::list<T>::begin() {
-  return iterator(head_);
+template <typename T, typename Source>
+void s21::list<T, Source>::push_front(const_reference value) {
+  link_before(sentinel_->next_, memory().template create<Node>(value));
+}
+
+template <typename T, typename Source>
+void s21::list<T, Source>::push_back(const_reference value) {
+  link_before(sentinel_, memory().template create<Node>(value));
 }
 
-template <typename T>
-typename s21::list<T>::iterator s21::list<T>::end() {
-  return iterator(tail_->next_);
+template <typename T, typename Source>
+typename s21::list<T, Source>::iterator s21::list<T, Source>::begin() {
+  return iterator(sentinel_->next_);
 }
 
-template <typename T>
-void s21::list<T>::swap(s21::list<T> &other) {
+template <typename T, typename Source>
+typename s21::list<T, Source>::iterator s21::list<T, Source>::end() {
+  return iterator(sentinel_);
+}
+
+template <typename T, typename Source>
+void s21::list<T, Source>::swap(s21::list<T, Source> &other) {
   std::swap(size_, other.size_);
-  std::swap(head_, other.head_);
-  std::swap(tail_, other.tail_);
+  std::swap(sentinel_, other.sentinel_);
+  std::swap(memory(), other.memory());
 }
 
-template <typename T>
-void s21::list<T>::erase(s21::list<T>::iterator pos) {
-  if (empty()) throw std::invalid_argument("the list is empty");
-  pos.ptr_node_ == head_ ? head_ = head_->next_
-                         : (pos.ptr_node_->prev_)->next_ = pos.ptr_node_->next_;
-  pos.ptr_node_ == tail_ ? tail_ = tail_->prev_
-                         : (pos.ptr_node_->next_)->prev_ = pos.ptr_node_->prev_;
-  delete pos.ptr_node_;
-  --size_;
+template <typename T, typename Source>
+void s21::list<T, Source>::erase(s21::list<T, Source>::iterator pos) {
+  if (pos.ptr_node_ == sentinel_) {
+    throw std::invalid_argument(empty() ? "the list is empty"
+                                        : "cannot erase end()");
+  }
+  unlink(pos.ptr_node_);
+  memory().destroy(pos.ptr_node_);
 }
 
-template <typename T>
-void s21::list<T>::pop_front() {
+template <typename T, typename Source>
+void s21::list<T, Source>::pop_front() {
   if (empty()) throw std::invalid_argument("the list is empty");
-  erase(iterator(head_));
+  erase(iterator(sentinel_->next_));
 }
 
-template <typename T>
-void s21::list<T>::pop_back() {
+template <typename T, typename Source>
+void s21::list<T, Source>::pop_back() {
   if (empty()) throw std::invalid_argument("the list is empty");
-  erase(iterator(tail_));
+  erase(iterator(sentinel_->prev_));
 }
 
-template <typename T>
-void s21::list<T>::clear() {
-  while (size_) pop_back();
+template <typename T, typename Source>
+void s21::list<T, Source>::clear() {
+  Node *i = sentinel_->next_;
+  while (i != sentinel_) {
+    Node *next = i->next_;
+    memory().destroy(i);
+    i = next;
+  }
+  sentinel_->next_ = sentinel_;
+  sentinel_->prev_ = sentinel_;
+  size_ = 0;
 }
 
-template <typename T>
-const T &s21::list<T>::front() {
+template <typename T, typename Source>
+const T &s21::list<T, Source>::front() {
   if (empty()) throw std::invalid_argument("the list is empty");
-  return head_->value_;
+  return sentinel_->next_->value_;
 }
 
-template <typename T>
-const T &s21::list<T>::back() {
+template <typename T, typename Source>
+const T &s21::list<T, Source>::back() {
   if (empty()) throw std::invalid_argument("the list is empty");
-  return tail_->value_;
+  return sentinel_->prev_->value_;
 }
 
-template <typename T>
-bool s21::list<T>::empty() {
-  return (head_ == nullptr && size_ == 0);
+template <typename T, typename Source>
+bool s21::list<T, Source>::empty() {
+  return size_ == 0;
 }
 
-template <typename T>
-std::size_t s21::list<T>::size() {
+template <typename T, typename Source>
+std::size_t s21::list<T, Source>::size() {
   return size_;
 }
 
-template <typename T>
-std::size_t s21::list<T>::max_size() {
+template <typename T, typename Source>
+std::size_t s21::list<T, Source>::max_size() {
   return SIZE_MAX / (sizeof(Node) * 2);
 }
 
-template <typename T>
-typename s21::list<T>::iterator s21::list<T>::insert(s21::list<T>::iterator pos,
-                                                     const_reference value) {
-  iterator result;
-  if (size_ == 0) {
-    creat_first_node(value);
-    result = iterator(head_);
-  } else if (pos.ptr_node_ == head_) {
-    push_front(value);
-    result = iterator(head_);
-  } else if (pos.ptr_node_ == tail_->next_) {
-    push_back(value);
-    result = iterator(tail_);
-  } else {
-    Node *elm1 = pos.ptr_node_;
-    Node *elm2 = new node_double(value);
-    ++size_;
-
-    elm2->next_ = elm1;
-    elm2->prev_ = elm1->prev_;
-    elm1->prev_->next_ = elm2;
-    elm1->prev_ = elm2;
-
-    result = iterator(elm2);
-  }
-  return result;
+template <typename T, typename Source>
+std::size_t s21::list<T, Source>::memory_usage() const {
+  return memory_report().total();
 }
 
-template <typename T>
-void s21::list<T>::splice(s21::list<T>::iterator pos, s21::list<T> &other) {
-  Node *elm1 = pos.ptr_node_;
-  Node *elm2 = other.head_;
-  Node *elm3 = other.tail_;
-
-  elm3->next_ = elm1;
-  if (elm1 != head_) {
-    elm2->prev_ = elm1->prev_;
-    elm1->prev_->next_ = elm2;
+template <typename T, typename Source>
+s21::MemoryReport s21::list<T, Source>::memory_report() const {
+  const size_type nodes = size_ + 1;
+  MemoryReport report;
+  report.payload = size_ * memory::payload_size<T>::value;
+  report.slack = sizeof(T);
+  report.pointers = nodes * 2 * sizeof(Node *);
+  report.padding =
+      nodes * sizeof(Node) - report.payload - report.slack - report.pointers;
+  if constexpr (Source::kFromHeap) {
+    report.headers = nodes * memory::heap_overhead(sizeof(Node));
   }
-  elm1->prev_ = elm3;
-  if (elm1 == head_) head_ = other.head_;
+  report.object = sizeof(*this);
+  return report;
+}
 
-  size_ += other.size_;
+template <typename T, typename Source>
+typename s21::list<T, Source>::iterator s21::list<T, Source>::insert(
+    s21::list<T, Source>::iterator pos, const_reference value) {
+  Node *new_node = memory().template create<Node>(value);
+  link_before(pos.ptr_node_, new_node);
+  return iterator(new_node);
+}
 
-  other.head_ = nullptr;
-  other.tail_ = nullptr;
+template <typename T, typename Source>
+void s21::list<T, Source>::splice(s21::list<T, Source>::iterator pos,
+                                  s21::list<T, Source> &other) {
+  if (!memory().same_source(other.memory()))
+    throw std::invalid_argument("Cannot splice lists with different memory");
+  if (this == &other || other.empty()) return;
+  transfer(pos.ptr_node_, other.sentinel_->next_, other.sentinel_->prev_);
+  size_ += other.size_;
   other.size_ = 0;
 }
 
-template <typename T>
-void s21::list<T>::sort() {
+template <typename T, typename Source>
+void s21::list<T, Source>::sort() {
   for (size_type j = 0; j < size_; ++j) {
-    for (Node *i = head_; i != tail_; i = i->next_) {
+    for (Node *i = sentinel_->next_; i->next_ != sentinel_; i = i->next_) {
       Node *elm1 = i;
       Node *elm2 = elm1->next_;
       if (elm1->value_ > elm2->value_) {
@@ -280,69 +351,116 @@ void s21::list<T>::sort() {
   }
 }
 
-template <typename T>
-void s21::list<T>::reverse() {
-  tail_ = head_;
-  Node *elm = tail_->next_;
-  while (tail_->next_) {
-    head_->prev_ = elm;
-    tail_->next_ = elm->next_;
-    elm->next_ = head_;
-    elm->prev_ = nullptr;
-    head_ = elm;
-    elm = tail_->next_;
+template <typename T, typename Source>
+void s21::list<T, Source>::reverse() {
+  Node *i = sentinel_;
+  do {
+    std::swap(i->next_, i->prev_);
+    i = i->prev_;
+  } while (i != sentinel_);
+}
+
+template <typename T, typename Source>
+typename s21::list<T, Source>::size_type s21::list<T, Source>::unique() {
+  return unique(std::equal_to<value_type>());
+}
+
+template <typename T, typename Source>
+template <typename BinaryPredicate>
+typename s21::list<T, Source>::size_type s21::list<T, Source>::unique(
+    BinaryPredicate pred) {
+  Node *garbage = nullptr;
+  size_type removed = 0;
+  try {
+    for (Node *kept = sentinel_->next_; kept != sentinel_;
+         kept = kept->next_) {
+      Node *last = kept;
+      size_type count = 0;
+      while (last->next_ != sentinel_ &&
+             pred(kept->value_, last->next_->value_)) {
+        last = last->next_;
+        ++count;
+      }
+      if (count) {
+        unlink_range(kept->next_, last, count, &garbage);
+        removed += count;
+      }
+    }
+  } catch (...) {
+    free_chain(garbage);
+    throw;
   }
-  tail_->next_ = nullptr;
+  free_chain(garbage);
+  return removed;
+}
+
+template <typename T, typename Source>
+typename s21::list<T, Source>::size_type s21::list<T, Source>::remove(
+    const_reference value) {
+  // value может ссылаться на элемент самого списка, поэтому узлы
+  // освобождаются только после полного прохода
+  return remove_if([&value](const_reference item) { return item == value; });
 }
 
-template <typename T>
-void s21::list<T>::unique() {
-  iterator it = begin();
-  while (it.ptr_node_ != tail_) {
-    iterator it_next = it;
-    ++it_next;
-    if (*it == *it_next) erase(it_next);
-    ++it;
+template <typename T, typename Source>
+template <typename UnaryPredicate>
+typename s21::list<T, Source>::size_type s21::list<T, Source>::remove_if(
+    UnaryPredicate pred) {
+  Node *garbage = nullptr;
+  size_type removed = 0;
+  try {
+    Node *i = sentinel_->next_;
+    while (i != sentinel_) {
+      if (!pred(i->value_)) {
+        i = i->next_;
+        continue;
+      }
+      Node *last = i;
+      size_type count = 1;
+      while (last->next_ != sentinel_ && pred(last->next_->value_)) {
+        last = last->next_;
+        ++count;
+      }
+      Node *next = last->next_;
+      unlink_range(i, last, count, &garbage);
+      removed += count;
+      i = next;
+    }
+  } catch (...) {
+    free_chain(garbage);
+    throw;
   }
+  free_chain(garbage);
+  return removed;
 }
 
-template <typename T>
-void s21::list<T>::merge(s21::list<T> &other) {
-  Node *elm1 = head_;
-  Node *elm2 = other.head_;
+template <typename T, typename Source>
+void s21::list<T, Source>::merge(s21::list<T, Source> &other) {
+  if (!memory().same_source(other.memory()))
+    throw std::invalid_argument("Cannot merge lists with different memory");
+  if (this == &other) return;
+  Node *elm1 = sentinel_->next_;
+  Node *elm2 = other.sentinel_->next_;
 
-  while (other.head_ && elm1 != tail_->next_) {
+  while (elm1 != sentinel_ && elm2 != other.sentinel_) {
     if (elm2->value_ < elm1->value_) {
-      other.head_ = elm2->next_;
-      elm2->next_ = elm1;
-      if (elm1 != head_) {
-        elm2->prev_ = elm1->prev_;
-        elm1->prev_->next_ = elm2;
-      }
-      elm1->prev_ = elm2;
-      if (elm1 == head_) head_ = elm2;
-      elm2 = other.head_;
-      ++size_;
-      --other.size_;
+      Node *next = elm2->next_;
+      transfer(elm1, elm2, elm2);
+      elm2 = next;
     } else {
       elm1 = elm1->next_;
     }
   }
-  while (other.size_) {
-    other.head_ = elm2->next_;
-    elm2->next_ = tail_->next_;
-    elm2->prev_ = tail_;
-    tail_->next_ = elm2;
-    tail_ = elm2;
-    elm2 = other.head_;
-    ++size_;
-    --other.size_;
+  if (elm2 != other.sentinel_) {
+    transfer(sentinel_, elm2, other.sentinel_->prev_);
   }
+  size_ += other.size_;
+  other.size_ = 0;
 }
 
-template <class T>
+template <class T, class Source>
 template <class... Args>
-void list<T>::emplace_front(Args &&...args) {
+void list<T, Source>::emplace_front(Args &&...args) {
   if ((sizeof...(args)) == 0) {
     value_type _empty = {};
     push_front(_empty);
@@ -351,9 +469,9 @@ void list<T>::emplace_front(Args &&...args) {
   for (auto &val : arg) push_front(val);
 }
 
-template <class T>
+template <class T, class Source>
 template <class... Args>
-void list<T>::emplace_back(Args &&...args) {
+void list<T, Source>::emplace_back(Args &&...args) {
   if ((sizeof...(args)) == 0) {
     value_type _empty = {};
     push_back(_empty);
@@ -362,10 +480,10 @@ void list<T>::emplace_back(Args &&...args) {
   for (auto &val : arg) push_back(val);
 }
 
-template <class T>
+template <class T, class Source>
 template <class... Args>
-typename list<T>::iterator list<T>::emplace(const_iterator pos,
-                                            Args &&...args) {
+typename list<T, Source>::iterator list<T, Source>::emplace(
+    const_iterator pos, Args &&...args) {
   if ((sizeof...(args)) == 0) {
     value_type _empty = {};
     insert(pos, _empty);
@@ -9,17 +9,18 @@
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key, typename T>
-class map : RBTree<Key, T> {
+template <typename Key, typename T, typename Source = HeapSource>
+class map : RBTree<Key, T, Tracked::kMap, Source> {
  public:
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename s21::RBTree<key_type, mapped_type>::iterator;
-  using const_iterator =
-      typename s21::RBTree<key_type, mapped_type>::const_iterator;
+  using iterator =
+      typename RBTree<key_type, mapped_type, Tracked::kMap, Source>::iterator;
+  using const_iterator = typename RBTree<key_type, mapped_type, Tracked::kMap,
+                                         Source>::const_iterator;
   using size_type = std::size_t;
 
   typedef s21::RBTreeNode<key_type, mapped_type> Node;
@@ -40,6 +41,8 @@ class map : RBTree<Key, T> {
   bool empty();
   size_type size();
   size_type max_size();
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
 
   void clear();
   std::pair<iterator, bool> insert(const_reference value);
@@ -56,24 +59,33 @@ class map : RBTree<Key, T> {
   template <typename... Args>
   vector<std::pair<iterator, bool>> emplace(Args &&...args);
 
+ protected:
+  // для pmr::map: узлы из ресурса
+  explicit map(const Source &memory)
+      : s21::RBTree<Key, T, Tracked::kMap, Source>(memory) {}
+
+  using s21::RBTree<key_type, mapped_type, Tracked::kMap, Source>::memory;
+
  private:
   size_type size_{0};
-  using s21::RBTree<key_type, mapped_type>::_root;
-  using s21::RBTree<key_type, mapped_type>::Contains;
-  using s21::RBTree<key_type, mapped_type>::Insert;
-  using s21::RBTree<key_type, mapped_type>::Remove;
+  using s21::RBTree<key_type, mapped_type, Tracked::kMap, Source>::_root;
+  using s21::RBTree<key_type, mapped_type, Tracked::kMap, Source>::Contains;
+  using s21::RBTree<key_type, mapped_type, Tracked::kMap, Source>::Insert;
+  using s21::RBTree<key_type, mapped_type, Tracked::kMap, Source>::Nodes_report;
+  using s21::RBTree<key_type, mapped_type, Tracked::kMap, Source>::Remove;
 };
 
-template <class key_type, class mapped_type>
-s21::map<key_type, mapped_type>::map(
+template <class key_type, class mapped_type, class Source>
+s21::map<key_type, mapped_type, Source>::map(
     const std::initializer_list<value_type> &items) {
   for (value_type item : items) {
     insert(item);
   }
 }
 
-template <class key_type, class mapped_type>
-s21::map<key_type, mapped_type>::map(const s21::map<key_type, mapped_type> &m) {
+template <class key_type, class mapped_type, class Source>
+s21::map<key_type, mapped_type, Source>::map(
+    const s21::map<key_type, mapped_type, Source> &m) {
   iterator it = m.begin();
   iterator it_end = m.end();
   while (it != it_end) {
@@ -82,29 +94,31 @@ s21::map<key_type, mapped_type>::map(const s21::map<key_type, mapped_type> &m) {
   }
 }
 
-template <class key_type, class mapped_type>
-s21::map<key_type, mapped_type>::map(s21::map<key_type, mapped_type> &&m) {
+template <class key_type, class mapped_type, class Source>
+s21::map<key_type, mapped_type, Source>::map(
+    s21::map<key_type, mapped_type, Source> &&m) {
   clear();
   swap(m);
 }
 
-template <class key_type, class mapped_type>
-s21::map<key_type, mapped_type> s21::map<key_type, mapped_type>::operator=(
-    s21::map<key_type, mapped_type> &&m) {
+template <class key_type, class mapped_type, class Source>
+s21::map<key_type, mapped_type, Source>
+s21::map<key_type, mapped_type, Source>::operator=(
+    s21::map<key_type, mapped_type, Source> &&m) {
   clear();
   swap(m);
 }
 
-template <class key_type, class mapped_type>
-void s21::map<key_type, mapped_type>::clear() {
-  s21::RBTree<key_type, mapped_type>::Destory(_root);
+template <class key_type, class mapped_type, class Source>
+void s21::map<key_type, mapped_type, Source>::clear() {
+  s21::RBTree<key_type, mapped_type, Tracked::kMap, Source>::Destory(_root);
   size_ = 0;
   _root = nullptr;
 }
 
-template <class key_type, class mapped_type>
-std::pair<typename s21::map<key_type, mapped_type>::iterator, bool>
-s21::map<key_type, mapped_type>::insert(const_reference value) {
+template <class key_type, class mapped_type, class Source>
+std::pair<typename s21::map<key_type, mapped_type, Source>::iterator, bool>
+s21::map<key_type, mapped_type, Source>::insert(const_reference value) {
   std::pair<iterator, bool> result;
   if (!contains(value.first)) {
     Insert(value.first, value.second);
@@ -117,9 +131,9 @@ s21::map<key_type, mapped_type>::insert(const_reference value) {
   return result;
 }
 
-template <class key_type, class mapped_type>
-std::pair<typename s21::map<key_type, mapped_type>::iterator, bool>
-s21::map<key_type, mapped_type>::insert(const key_type &key,
+template <class key_type, class mapped_type, class Source>
+std::pair<typename s21::map<key_type, mapped_type, Source>::iterator, bool>
+s21::map<key_type, mapped_type, Source>::insert(const key_type &key,
                                         const mapped_type &obj) {
   std::pair<iterator, bool> result;
   if (!contains(key)) {
@@ -133,9 +147,9 @@ s21::map<key_type, mapped_type>::insert(const key_type &key,
   return result;
 }
 
-template <class key_type, class mapped_type>
-std::pair<typename s21::map<key_type, mapped_type>::iterator, bool>
-s21::map<key_type, mapped_type>::insert_or_assign(const key_type &key,
+template <class key_type, class mapped_type, class Source>
+std::pair<typename s21::map<key_type, mapped_type, Source>::iterator, bool>
+s21::map<key_type, mapped_type, Source>::insert_or_assign(const key_type &key,
                                                   const mapped_type &obj) {
   std::pair<iterator, bool> result;
   if (!contains(key)) {
@@ -151,37 +165,40 @@ s21::map<key_type, mapped_type>::insert_or_assign(const key_type &key,
   return result;
 }
 
-template <class key_type, class mapped_type>
-void s21::map<key_type, mapped_type>::erase(
-    s21::map<key_type, mapped_type>::iterator pos) {
+template <class key_type, class mapped_type, class Source>
+void s21::map<key_type, mapped_type, Source>::erase(
+    s21::map<key_type, mapped_type, Source>::iterator pos) {
   if (contains(pos.ptr_->_key)) {
     Remove(pos.ptr_->_key);
     --size_;
   }
 }
 
-template <class key_type, class mapped_type>
-typename s21::map<key_type, mapped_type>::iterator
-s21::map<key_type, mapped_type>::begin() const {
+template <class key_type, class mapped_type, class Source>
+typename s21::map<key_type, mapped_type, Source>::iterator
+s21::map<key_type, mapped_type, Source>::begin() const {
   Node *x = _root;
-  while (x->_left) x = x->_left;
+  while (x && x->_left) x = x->_left;
   return iterator(_root, x);
 }
 
-template <class key_type, class mapped_type>
-typename s21::map<key_type, mapped_type>::iterator
-s21::map<key_type, mapped_type>::end() const {
+template <class key_type, class mapped_type, class Source>
+typename s21::map<key_type, mapped_type, Source>::iterator
+s21::map<key_type, mapped_type, Source>::end() const {
   Node *x = _root;
   while (x) x = x->_right;
   return iterator(_root, x);
 }
 
-template <class key_type, class mapped_type>
-typename s21::map<key_type, mapped_type>::iterator
-s21::map<key_type, mapped_type>::find(const key_type &key) {
+template <class key_type, class mapped_type, class Source>
+typename s21::map<key_type, mapped_type, Source>::iterator
+s21::map<key_type, mapped_type, Source>::find(const key_type &key) {
   iterator result = end();
   Node *x = _root;
+  S21_RECORD(Tracked::kMap, Counter::kLookups, 1);
   while (x != nullptr) {
+    S21_RECORD(Tracked::kMap, Counter::kNodeVisits, 1);
+    S21_RECORD(Tracked::kMap, Counter::kComparisons, key == x->_key ? 1 : 2);
     if (key == x->_key) {
       result = iterator(_root, x);
       break;
@@ -194,8 +211,8 @@ s21::map<key_type, mapped_type>::find(const key_type &key) {
   return result;
 }
 
-template <class key_type, class mapped_type>
-mapped_type &s21::map<key_type, mapped_type>::at(const key_type &key) {
+template <class key_type, class mapped_type, class Source>
+mapped_type &s21::map<key_type, mapped_type, Source>::at(const key_type &key) {
   if (!contains(key)) {
     throw std::out_of_range("Out of range");
   }
@@ -204,8 +221,9 @@ mapped_type &s21::map<key_type, mapped_type>::at(const key_type &key) {
   return it.ptr_->_value;
 }
 
-template <class key_type, class mapped_type>
-mapped_type &s21::map<key_type, mapped_type>::operator[](const key_type &key) {
+template <class key_type, class mapped_type, class Source>
+mapped_type &s21::map<key_type, mapped_type, Source>::operator[](
+    const key_type &key) {
   if (!contains(key)) {
     insert(key, mapped_type());
   }
@@ -213,37 +231,51 @@ mapped_type &s21::map<key_type, mapped_type>::operator[](const key_type &key) {
   return it.ptr_->_value;
 }
 
-template <class key_type, class mapped_type>
-bool s21::map<key_type, mapped_type>::contains(const key_type &key) {
+template <class key_type, class mapped_type, class Source>
+bool s21::map<key_type, mapped_type, Source>::contains(const key_type &key) {
   return Contains(key);
 }
 
-template <class key_type, class mapped_type>
-void s21::map<key_type, mapped_type>::swap(
-    s21::map<key_type, mapped_type> &other) {
+template <class key_type, class mapped_type, class Source>
+void s21::map<key_type, mapped_type, Source>::swap(
+    s21::map<key_type, mapped_type, Source> &other) {
   std::swap(_root, other._root);
   std::swap(size_, other.size_);
+  std::swap(memory(), other.memory());
 }
 
-template <class key_type, class mapped_type>
-bool s21::map<key_type, mapped_type>::empty() {
+template <class key_type, class mapped_type, class Source>
+bool s21::map<key_type, mapped_type, Source>::empty() {
   return (_root == nullptr && size_ == 0);
 }
 
-template <class key_type, class mapped_type>
-std::size_t s21::map<key_type, mapped_type>::size() {
+template <class key_type, class mapped_type, class Source>
+std::size_t s21::map<key_type, mapped_type, Source>::size() {
   return size_;
 }
 
-template <class key_type, class mapped_type>
-std::size_t s21::map<key_type, mapped_type>::max_size() {
+template <class key_type, class mapped_type, class Source>
+std::size_t s21::map<key_type, mapped_type, Source>::max_size() {
   return SIZE_MAX / (sizeof(Node) * 2);
 }
 
-template <class key_type, class mapped_type>
-void s21::map<key_type, mapped_type>::merge(
-    s21::map<key_type, mapped_type> &other) {
-  s21::map<key_type, mapped_type> temp(other);
+template <class key_type, class mapped_type, class Source>
+std::size_t s21::map<key_type, mapped_type, Source>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <class key_type, class mapped_type, class Source>
+s21::MemoryReport s21::map<key_type, mapped_type, Source>::memory_report()
+    const {
+  MemoryReport report = Nodes_report(size_, false);
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <class key_type, class mapped_type, class Source>
+void s21::map<key_type, mapped_type, Source>::merge(
+    s21::map<key_type, mapped_type, Source> &other) {
+  s21::map<key_type, mapped_type, Source> temp(other);
   other.clear();
   iterator it = temp.begin();
   iterator it_end = temp.end();
@@ -258,10 +290,11 @@ void s21::map<key_type, mapped_type>::merge(
   temp.clear();
 }
 
-template <class key_type, class mapped_type>
+template <class key_type, class mapped_type, class Source>
 template <class... Args>
-s21::vector<std::pair<typename s21::map<key_type, mapped_type>::iterator, bool>>
-s21::map<key_type, mapped_type>::emplace(Args &&...args) {
+s21::vector<
+    std::pair<typename s21::map<key_type, mapped_type, Source>::iterator, bool>>
+s21::map<key_type, mapped_type, Source>::emplace(Args &&...args) {
   s21::vector<std::pair<iterator, bool>> result;
   std::pair<iterator, bool> elm;
   std::initializer_list<value_type> arg{args...};
@@ -0,0 +1,280 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_MPMC_QUEUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_MPMC_QUEUE_H_
+
+#include <atomic>              // для std::atomic
+#include <condition_variable>  // для std::condition_variable
+#include <cstddef>             // для std::size_t
+#include <mutex>               // для std::mutex
+#include <stdexcept>           // для исключений
+#include <thread>              // для std::this_thread::yield
+#include <utility>             // для std::move
+
+#include "memory_report.h"
+
+namespace s21 {
+// Ограниченная очередь для нескольких производителей и потребителей по
+// схеме Д. Вьюкова: у каждой ячейки есть номер sequence_. Ячейка свободна
+// для позиции pos, когда sequence_ == pos, и хранит готовый элемент, когда
+// sequence_ == pos + 1. Позицию захватывают CAS-ом по enqueue_pos_ или
+// dequeue_pos_, после чего работа с ячейкой идёт без гонок.
+template <typename T>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+  ~mpmc_queue();
+
+  bool try_push(const_reference value);
+  bool try_pop(reference value);
+
+  template <class InputIt>
+  size_type try_push_n(InputIt first, size_type n);
+  template <class OutputIt>
+  size_type try_pop_n(OutputIt out, size_type n);
+
+  void push(const_reference value);
+  void pop(reference value);
+
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+  // payload и slack делятся по size() на момент вызова; sequence_ каждой
+  // ячейки - статья control
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+ private:
+  static constexpr size_type kCacheLine = 64U;
+  static constexpr int kSpinCount = 64;
+
+  struct Cell {
+    std::atomic<size_type> sequence_;
+    value_type value_;
+  };
+
+  Cell *cells_{nullptr};
+  size_type mask_{0U};
+
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_{0U};
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_{0U};
+
+  alignas(kCacheLine) std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+  std::atomic<int> push_waiters_{0};
+  std::atomic<int> pop_waiters_{0};
+
+  size_type claim(std::atomic<size_type> *pos, size_type n, size_type shift,
+                  size_type *first);
+  template <class InputIt>
+  size_type enqueue(InputIt first, size_type n);
+  template <class OutputIt>
+  size_type dequeue(OutputIt out, size_type n);
+  void wake(std::atomic<int> *waiters, std::condition_variable *cv);
+};
+
+template <typename value_type>
+mpmc_queue<value_type>::mpmc_queue(size_type capacity) {
+  if (capacity < 2) throw std::invalid_argument("capacity must be at least 2");
+  size_type size = 2;
+  while (size < capacity) size <<= 1;
+  cells_ = new Cell[size];
+  for (size_type i = 0; i < size; ++i) {
+    cells_[i].sequence_.store(i, std::memory_order_relaxed);
+  }
+  mask_ = size - 1;
+}
+
+template <typename value_type>
+mpmc_queue<value_type>::~mpmc_queue() {
+  delete[] cells_;
+}
+
+// Захватывает до n подряд идущих позиций, начиная с *pos. Ячейка позиции p
+// доступна, когда её sequence_ == p + shift (shift = 0 для записи и 1 для
+// чтения); пока позиция не захвачена, sequence_ этой ячейки уже не
+// изменится, поэтому проверка перед CAS остаётся верной и после него.
+// Возвращает число захваченных позиций, первая из них - в *first.
+template <typename value_type>
+typename mpmc_queue<value_type>::size_type mpmc_queue<value_type>::claim(
+    std::atomic<size_type> *pos, size_type n, size_type shift,
+    size_type *first) {
+  size_type start = pos->load(std::memory_order_relaxed);
+  for (;;) {
+    size_type count = 0;
+    std::ptrdiff_t diff = 0;
+    while (count < n) {
+      size_type seq = cells_[(start + count) & mask_].sequence_.load(
+          std::memory_order_acquire);
+      diff = static_cast<std::ptrdiff_t>(seq - (start + count + shift));
+      if (diff != 0) break;
+      ++count;
+    }
+    if (count == 0) {
+      // очередь заполнена (для записи) или пуста (для чтения)
+      if (diff < 0) return 0;
+      start = pos->load(std::memory_order_relaxed);
+    } else if (pos->compare_exchange_weak(start, start + count,
+                                          std::memory_order_relaxed)) {
+      *first = start;
+      return count;
+    }
+  }
+}
+
+// будит ждущие потоки, только если такие есть; барьер упорядочивает
+// публикацию ячейки и чтение счётчика ждущих (пара к барьеру в push/pop)
+template <typename value_type>
+void mpmc_queue<value_type>::wake(std::atomic<int> *waiters,
+                                  std::condition_variable *cv) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiters->load(std::memory_order_relaxed) > 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cv->notify_all();
+  }
+}
+
+template <typename value_type>
+bool mpmc_queue<value_type>::try_push(const_reference value) {
+  return try_push_n(&value, 1) == 1;
+}
+
+template <typename value_type>
+bool mpmc_queue<value_type>::try_pop(reference value) {
+  return try_pop_n(&value, 1) == 1;
+}
+
+template <typename value_type>
+template <class InputIt>
+typename mpmc_queue<value_type>::size_type mpmc_queue<value_type>::try_push_n(
+    InputIt first, size_type n) {
+  size_type count = enqueue(first, n);
+  if (count) wake(&pop_waiters_, &not_empty_);
+  return count;
+}
+
+template <typename value_type>
+template <class OutputIt>
+typename mpmc_queue<value_type>::size_type mpmc_queue<value_type>::try_pop_n(
+    OutputIt out, size_type n) {
+  size_type count = dequeue(out, n);
+  if (count) wake(&push_waiters_, &not_full_);
+  return count;
+}
+
+template <typename value_type>
+template <class InputIt>
+typename mpmc_queue<value_type>::size_type mpmc_queue<value_type>::enqueue(
+    InputIt first, size_type n) {
+  size_type start = 0;
+  size_type count = n ? claim(&enqueue_pos_, n, 0, &start) : 0;
+  for (size_type i = 0; i < count; ++i, ++first) {
+    Cell &cell = cells_[(start + i) & mask_];
+    cell.value_ = *first;
+    cell.sequence_.store(start + i + 1, std::memory_order_release);
+  }
+  return count;
+}
+
+template <typename value_type>
+template <class OutputIt>
+typename mpmc_queue<value_type>::size_type mpmc_queue<value_type>::dequeue(
+    OutputIt out, size_type n) {
+  size_type start = 0;
+  size_type count = n ? claim(&dequeue_pos_, n, 1, &start) : 0;
+  for (size_type i = 0; i < count; ++i, ++out) {
+    Cell &cell = cells_[(start + i) & mask_];
+    *out = std::move(cell.value_);
+    cell.sequence_.store(start + i + mask_ + 1, std::memory_order_release);
+  }
+  return count;
+}
+
+// сначала крутится kSpinCount попыток, затем засыпает на not_full_
+template <typename value_type>
+void mpmc_queue<value_type>::push(const_reference value) {
+  for (int i = 0; i < kSpinCount; ++i) {
+    if (try_push(value)) return;
+    std::this_thread::yield();
+  }
+  {
+    // под mutex_ используется enqueue без пробуждения, иначе wake()
+    // повторно захватил бы mutex_
+    std::unique_lock<std::mutex> lock(mutex_);
+    push_waiters_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!enqueue(&value, 1)) not_full_.wait(lock);
+    push_waiters_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  wake(&pop_waiters_, &not_empty_);
+}
+
+// сначала крутится kSpinCount попыток, затем засыпает на not_empty_
+template <typename value_type>
+void mpmc_queue<value_type>::pop(reference value) {
+  for (int i = 0; i < kSpinCount; ++i) {
+    if (try_pop(value)) return;
+    std::this_thread::yield();
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    pop_waiters_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!dequeue(&value, 1)) not_empty_.wait(lock);
+    pop_waiters_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  wake(&push_waiters_, &not_full_);
+}
+
+template <typename value_type>
+bool mpmc_queue<value_type>::empty() const {
+  return size() == 0;
+}
+
+// из другого потока значение приблизительное
+template <typename value_type>
+typename mpmc_queue<value_type>::size_type mpmc_queue<value_type>::size()
+    const {
+  size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  return tail > head ? tail - head : 0;
+}
+
+template <typename value_type>
+typename mpmc_queue<value_type>::size_type mpmc_queue<value_type>::capacity()
+    const {
+  return mask_ + 1;
+}
+
+template <typename value_type>
+typename mpmc_queue<value_type>::size_type
+mpmc_queue<value_type>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type>
+MemoryReport mpmc_queue<value_type>::memory_report() const {
+  size_type n = size();
+  size_type cells = capacity();
+  MemoryReport report;
+  report.payload = n * memory::payload_size<value_type>::value;
+  report.padding = n * (sizeof(value_type) -
+                        memory::payload_size<value_type>::value);
+  report.slack = (cells - n) * sizeof(value_type);
+  report.control = cells * sizeof(std::atomic<size_type>);
+  report.padding += cells * (sizeof(Cell) - sizeof(std::atomic<size_type>) -
+                             sizeof(value_type));
+  report.headers = memory::array_overhead<Cell>(cells);
+  report.object = sizeof(*this);
+  return report;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_MPMC_QUEUE_H_
@@ -9,16 +9,18 @@
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key>
-class multiset : RBTree<Key, Key> {
+template <typename Key, typename Source = HeapSource>
+class multiset : RBTree<Key, Key, Tracked::kMultiset, Source> {
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename s21::RBTree<key_type, value_type>::iterator;
+  using iterator = typename RBTree<key_type, value_type, Tracked::kMultiset,
+                                   Source>::iterator;
   using const_iterator =
-      typename s21::RBTree<key_type, value_type>::const_iterator;
+      typename RBTree<key_type, value_type, Tracked::kMultiset,
+                      Source>::const_iterator;
   using size_type = std::size_t;
 
   typedef s21::RBTreeNode<key_type, value_type> Node;
@@ -36,6 +38,8 @@ class multiset : RBTree<Key, Key> {
   bool empty();
   size_type size();
   size_type max_size();
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
 
   void clear();
   iterator insert(const_reference value);
@@ -53,24 +57,34 @@ class multiset : RBTree<Key, Key> {
   template <typename... Args>
   vector<std::pair<iterator, bool>> emplace(Args &&...args);
 
+ protected:
+  // для pmr::multiset: узлы из ресурса
+  explicit multiset(const Source &memory)
+      : s21::RBTree<Key, Key, Tracked::kMultiset, Source>(memory) {}
+
+  using s21::RBTree<key_type, value_type, Tracked::kMultiset, Source>::memory;
+
  private:
   size_type size_{0};
-  using s21::RBTree<key_type, value_type>::_root;
-  using s21::RBTree<key_type, value_type>::Contains;
-  using s21::RBTree<key_type, value_type>::Insert;
-  using s21::RBTree<key_type, value_type>::Remove;
+  using s21::RBTree<key_type, value_type, Tracked::kMultiset, Source>::_root;
+  using s21::RBTree<key_type, value_type, Tracked::kMultiset, Source>::Contains;
+  using s21::RBTree<key_type, value_type, Tracked::kMultiset, Source>::Insert;
+  using s21::RBTree<key_type, value_type, Tracked::kMultiset,
+                    Source>::Nodes_report;
+  using s21::RBTree<key_type, value_type, Tracked::kMultiset, Source>::Remove;
 };
 
-template <class value_type>
-s21::multiset<value_type>::multiset(
+template <class value_type, class Source>
+s21::multiset<value_type, Source>::multiset(
     const std::initializer_list<value_type> &items) {
   for (auto item : items) {
     insert(item);
   }
 }
 
-template <class value_type>
-s21::multiset<value_type>::multiset(const s21::multiset<value_type> &ms) {
+template <class value_type, class Source>
+s21::multiset<value_type, Source>::multiset(
+    const s21::multiset<value_type, Source> &ms) {
   iterator it = ms.begin();
   iterator it_end = ms.end();
   while (it != it_end) {
@@ -79,50 +93,55 @@ s21::multiset<value_type>::multiset(const s21::multiset<value_type> &ms) {
   }
 }
 
-template <class value_type>
-s21::multiset<value_type>::multiset(s21::multiset<value_type> &&ms) {
+template <class value_type, class Source>
+s21::multiset<value_type, Source>::multiset(
+    s21::multiset<value_type, Source> &&ms) {
   clear();
   swap(ms);
 }
 
-template <class value_type>
-s21::multiset<value_type> s21::multiset<value_type>::operator=(
-    s21::multiset<value_type> &&ms) {
+template <class value_type, class Source>
+s21::multiset<value_type, Source> s21::multiset<value_type, Source>::operator=(
+    s21::multiset<value_type, Source> &&ms) {
   clear();
   swap(ms);
 }
 
-template <class value_type>
-typename s21::multiset<value_type>::iterator s21::multiset<value_type>::insert(
-    const_reference value) {
+template <class value_type, class Source>
+typename s21::multiset<value_type, Source>::iterator
+s21::multiset<value_type, Source>::insert(const_reference value) {
   Insert(value, value);
   ++size_;
   iterator result = find(value);
   return result;
 }
 
-template <class value_type>
-typename s21::multiset<value_type>::iterator s21::multiset<value_type>::begin()
-    const {
+template <class value_type, class Source>
+typename s21::multiset<value_type, Source>::iterator
+s21::multiset<value_type, Source>::begin() const {
   Node *x = _root;
-  while (x->_left) x = x->_left;
+  while (x && x->_left) x = x->_left;
   return iterator(_root, x);
 }
 
-template <class value_type>
-typename s21::multiset<value_type>::iterator s21::multiset<value_type>::end()
-    const {
+template <class value_type, class Source>
+typename s21::multiset<value_type, Source>::iterator
+s21::multiset<value_type, Source>::end() const {
   Node *x = _root;
   while (x) x = x->_right;
   return iterator(_root, x);
 }
 
-template <class value_type>
-typename s21::multiset<value_type>::iterator s21::multiset<value_type>::find(
-    const_reference key) {
+template <class value_type, class Source>
+typename s21::multiset<value_type, Source>::iterator
+s21::multiset<value_type, Source>::find(const_reference key) {
   iterator result = end();
   Node *x = _root;
+  S21_RECORD(Tracked::kMultiset, Counter::kLookups, 1);
   while (x != nullptr) {
+    S21_RECORD(Tracked::kMultiset, Counter::kNodeVisits, 1);
+    S21_RECORD(Tracked::kMultiset, Counter::kComparisons,
+               key == x->_value ? 1 : 2);
     if (key == x->_value) {
       result = iterator(_root, x);
       break;
@@ -135,44 +154,48 @@ typename s21::multiset<value_type>::iterator s21::multiset<value_type>::find(
   return result;
 }
 
-template <class value_type>
-bool s21::multiset<value_type>::contains(const_reference key) {
+template <class value_type, class Source>
+bool s21::multiset<value_type, Source>::contains(const_reference key) {
   return Contains(key);
 }
 
-template <class value_type>
-bool s21::multiset<value_type>::empty() {
+template <class value_type, class Source>
+bool s21::multiset<value_type, Source>::empty() {
   return (_root == nullptr && size_ == 0);
 }
 
-template <class value_type>
-std::size_t s21::multiset<value_type>::size() {
+template <class value_type, class Source>
+std::size_t s21::multiset<value_type, Source>::size() {
   return size_;
 }
 
-template <class value_type>
-void s21::multiset<value_type>::erase(s21::multiset<value_type>::iterator pos) {
+template <class value_type, class Source>
+void s21::multiset<value_type, Source>::erase(
+    s21::multiset<value_type, Source>::iterator pos) {
   if (contains(pos.ptr_->_key)) {
     Remove(pos.ptr_->_key);
     --size_;
   }
 }
 
-template <class value_type>
-void s21::multiset<value_type>::clear() {
-  s21::RBTree<value_type, value_type>::Destory(_root);
+template <class value_type, class Source>
+void s21::multiset<value_type, Source>::clear() {
+  s21::RBTree<value_type, value_type, Tracked::kMultiset, Source>::Destory(
+      _root);
   size_ = 0;
   _root = nullptr;
 }
 
-template <class value_type>
-void s21::multiset<value_type>::swap(s21::multiset<value_type> &other) {
+template <class value_type, class Source>
+void s21::multiset<value_type, Source>::swap(
+    s21::multiset<value_type, Source> &other) {
   std::swap(_root, other._root);
   std::swap(size_, other.size_);
+  std::swap(memory(), other.memory());
 }
 
-template <class value_type>
-std::size_t s21::multiset<value_type>::count(const_reference key) {
+template <class value_type, class Source>
+std::size_t s21::multiset<value_type, Source>::count(const_reference key) {
   size_type count = 0;
   if (contains(key)) {
     iterator it = begin();
@@ -189,17 +212,18 @@ std::size_t s21::multiset<value_type>::count(const_reference key) {
   return count;
 }
 
-template <class value_type>
-void s21::multiset<value_type>::merge(s21::multiset<value_type> &other) {
+template <class value_type, class Source>
+void s21::multiset<value_type, Source>::merge(
+    s21::multiset<value_type, Source> &other) {
   for (auto n : other) {
     insert(n);
   }
   other.clear();
 }
 
-template <class value_type>
-typename s21::multiset<value_type>::iterator
-s21::multiset<value_type>::lower_bound(const_reference key) {
+template <class value_type, class Source>
+typename s21::multiset<value_type, Source>::iterator
+s21::multiset<value_type, Source>::lower_bound(const_reference key) {
   iterator it = begin();
   iterator it_end = end();
   while (it != it_end && *it < key) {
@@ -208,9 +232,9 @@ s21::multiset<value_type>::lower_bound(const_reference key) {
   return it;
 }
 
-template <class value_type>
-typename s21::multiset<value_type>::iterator
-s21::multiset<value_type>::upper_bound(const_reference key) {
+template <class value_type, class Source>
+typename s21::multiset<value_type, Source>::iterator
+s21::multiset<value_type, Source>::upper_bound(const_reference key) {
   iterator it = begin();
   iterator it_end = end();
   while (it != it_end && *it <= key) {
@@ -219,22 +243,35 @@ s21::multiset<value_type>::upper_bound(const_reference key) {
   return it;
 }
 
-template <class value_type>
-std::pair<typename s21::multiset<value_type>::iterator,
-          typename s21::multiset<value_type>::iterator>
-s21::multiset<value_type>::equal_range(const_reference key) {
+template <class value_type, class Source>
+std::pair<typename s21::multiset<value_type, Source>::iterator,
+          typename s21::multiset<value_type, Source>::iterator>
+s21::multiset<value_type, Source>::equal_range(const_reference key) {
   return std::make_pair(lower_bound(key), upper_bound(key));
 }
 
-template <class value_type>
-std::size_t s21::multiset<value_type>::max_size() {
+template <class value_type, class Source>
+std::size_t s21::multiset<value_type, Source>::max_size() {
   return SIZE_MAX / ((sizeof(size_t) * 5) * 2);
 }
 
-template <class value_type>
+template <class value_type, class Source>
+std::size_t s21::multiset<value_type, Source>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <class value_type, class Source>
+s21::MemoryReport s21::multiset<value_type, Source>::memory_report() const {
+  MemoryReport report = Nodes_report(size_, true);
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <class value_type, class Source>
 template <class... Args>
-s21::vector<std::pair<typename s21::multiset<value_type>::iterator, bool>>
-s21::multiset<value_type>::emplace(Args &&...args) {
+s21::vector<
+    std::pair<typename s21::multiset<value_type, Source>::iterator, bool>>
+s21::multiset<value_type, Source>::emplace(Args &&...args) {
   s21::vector<std::pair<iterator, bool>> result;
   std::pair<iterator, bool> elm;
   std::initializer_list<key_type> arg{args...};
@@ -0,0 +1,185 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_PERSISTENT_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_PERSISTENT_MAP_H_
+
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::pair
+
+#include "PersistentTree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Персистентное отображение: копия (или snapshot()) стоит O(1) и делит с
+// оригиналом все узлы, а каждое изменение копирует только путь от корня.
+// Снимки можно раздавать читающим потокам, пока писатель продолжает менять
+// свой объект; сам объект одновременно менять и читать из разных потоков
+// нельзя. Элементы неизменяемы, поэтому operator[] нет, а итераторы
+// константные.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class persistent_map
+    : PersistentTree<Key, std::pair<const Key, T>, PersistentPairKey,
+                     Compare> {
+  using Base =
+      PersistentTree<Key, std::pair<const Key, T>, PersistentPairKey, Compare>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::iterator;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  persistent_map() {}
+  explicit persistent_map(std::initializer_list<value_type> const &items);
+  persistent_map(const persistent_map &m) = default;
+  persistent_map(persistent_map &&m);
+  ~persistent_map() {}
+  persistent_map &operator=(const persistent_map &m) = default;
+  persistent_map &operator=(persistent_map &&m);
+
+  // неизменяемая версия на текущий момент, O(1)
+  persistent_map snapshot() const;
+
+  const mapped_type &at(const key_type &key) const;
+
+  using Base::begin;
+  using Base::end;
+
+  using Base::empty;
+  using Base::max_size;
+  using Base::memory_report;
+  using Base::memory_usage;
+  using Base::size;
+
+  using Base::clear;
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(persistent_map &other);
+  void merge(persistent_map &other);
+
+  using Base::contains;
+  using Base::find;
+  using Base::lower_bound;
+  using Base::upper_bound;
+  size_type count(const key_type &key) const;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+};
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::persistent_map(
+    std::initializer_list<value_type> const &items) {
+  for (auto &item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::persistent_map(persistent_map &&m) {
+  swap(m);
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare> &persistent_map<Key, T, Compare>::operator=(
+    persistent_map &&m) {
+  if (this != &m) {
+    clear();
+    swap(m);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare> persistent_map<Key, T, Compare>::snapshot()
+    const {
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+const T &persistent_map<Key, T, Compare>::at(const key_type &key) const {
+  iterator it = find(key);
+  if (it == end()) throw std::out_of_range("Out of range");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename persistent_map<Key, T, Compare>::iterator, bool>
+persistent_map<Key, T, Compare>::insert(const value_type &value) {
+  bool inserted = this->insert_value(value, false);
+  return {find(value.first), inserted};
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename persistent_map<Key, T, Compare>::iterator, bool>
+persistent_map<Key, T, Compare>::insert(const key_type &key,
+                                        const mapped_type &obj) {
+  return insert(value_type(key, obj));
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename persistent_map<Key, T, Compare>::iterator, bool>
+persistent_map<Key, T, Compare>::insert_or_assign(const key_type &key,
+                                                  const mapped_type &obj) {
+  bool inserted = this->insert_value(value_type(key, obj), true);
+  return {find(key), inserted};
+}
+
+template <typename Key, typename T, typename Compare>
+void persistent_map<Key, T, Compare>::erase(iterator pos) {
+  if (pos != end()) this->erase_key(pos->first);
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::size_type
+persistent_map<Key, T, Compare>::erase(const key_type &key) {
+  return this->erase_key(key);
+}
+
+template <typename Key, typename T, typename Compare>
+void persistent_map<Key, T, Compare>::swap(persistent_map &other) {
+  Base::swap(other);
+}
+
+// элементы с ключами, которые уже есть в этом отображении, остаются в other
+template <typename Key, typename T, typename Compare>
+void persistent_map<Key, T, Compare>::merge(persistent_map &other) {
+  if (this == &other) return;
+  persistent_map rest;
+  for (auto &item : other) {
+    if (!this->insert_value(item, false)) rest.insert_value(item, false);
+  }
+  other.swap(rest);
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::size_type
+persistent_map<Key, T, Compare>::count(const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+// узлы пути, на которые указывали итераторы, освобождаются следующей
+// вставкой, поэтому итераторы в результате находятся заново
+template <typename Key, typename T, typename Compare>
+template <class... Args>
+vector<std::pair<typename persistent_map<Key, T, Compare>::iterator, bool>>
+persistent_map<Key, T, Compare>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) result.push_back(insert(val));
+  auto it = arg.begin();
+  for (auto &item : result) item.first = find((it++)->first);
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_PERSISTENT_MAP_H_
@@ -0,0 +1,142 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_PERSISTENT_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_PERSISTENT_SET_H_
+
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <utility>           // для std::pair
+
+#include "PersistentTree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Персистентное множество: копия (или snapshot()) стоит O(1), изменение
+// копирует только путь от корня, остальное общее со старыми версиями.
+// Правила для потоков те же, что у persistent_map.
+template <typename Key, typename Compare = std::less<Key>>
+class persistent_set : PersistentTree<Key, Key, PersistentSelfKey, Compare> {
+  using Base = PersistentTree<Key, Key, PersistentSelfKey, Compare>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::iterator;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  persistent_set() {}
+  explicit persistent_set(std::initializer_list<value_type> const &items);
+  persistent_set(const persistent_set &s) = default;
+  persistent_set(persistent_set &&s);
+  ~persistent_set() {}
+  persistent_set &operator=(const persistent_set &s) = default;
+  persistent_set &operator=(persistent_set &&s);
+
+  // неизменяемая версия на текущий момент, O(1)
+  persistent_set snapshot() const;
+
+  using Base::begin;
+  using Base::end;
+
+  using Base::empty;
+  using Base::max_size;
+  using Base::memory_report;
+  using Base::memory_usage;
+  using Base::size;
+
+  using Base::clear;
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(persistent_set &other);
+  void merge(persistent_set &other);
+
+  using Base::contains;
+  using Base::find;
+  using Base::lower_bound;
+  using Base::upper_bound;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+};
+
+template <typename Key, typename Compare>
+persistent_set<Key, Compare>::persistent_set(
+    std::initializer_list<value_type> const &items) {
+  for (auto &item : items) insert(item);
+}
+
+template <typename Key, typename Compare>
+persistent_set<Key, Compare>::persistent_set(persistent_set &&s) {
+  swap(s);
+}
+
+template <typename Key, typename Compare>
+persistent_set<Key, Compare> &persistent_set<Key, Compare>::operator=(
+    persistent_set &&s) {
+  if (this != &s) {
+    clear();
+    swap(s);
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare>
+persistent_set<Key, Compare> persistent_set<Key, Compare>::snapshot() const {
+  return *this;
+}
+
+template <typename Key, typename Compare>
+std::pair<typename persistent_set<Key, Compare>::iterator, bool>
+persistent_set<Key, Compare>::insert(const value_type &value) {
+  bool inserted = this->insert_value(value, false);
+  return {find(value), inserted};
+}
+
+template <typename Key, typename Compare>
+void persistent_set<Key, Compare>::erase(iterator pos) {
+  if (pos != end()) this->erase_key(*pos);
+}
+
+template <typename Key, typename Compare>
+typename persistent_set<Key, Compare>::size_type
+persistent_set<Key, Compare>::erase(const key_type &key) {
+  return this->erase_key(key);
+}
+
+template <typename Key, typename Compare>
+void persistent_set<Key, Compare>::swap(persistent_set &other) {
+  Base::swap(other);
+}
+
+// элементы, которые уже есть в этом множестве, остаются в other
+template <typename Key, typename Compare>
+void persistent_set<Key, Compare>::merge(persistent_set &other) {
+  if (this == &other) return;
+  persistent_set rest;
+  for (auto &item : other) {
+    if (!this->insert_value(item, false)) rest.insert_value(item, false);
+  }
+  other.swap(rest);
+}
+
+// узлы пути, на которые указывали итераторы, освобождаются следующей
+// вставкой, поэтому итераторы в результате находятся заново
+template <typename Key, typename Compare>
+template <class... Args>
+vector<std::pair<typename persistent_set<Key, Compare>::iterator, bool>>
+persistent_set<Key, Compare>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) result.push_back(insert(val));
+  auto it = arg.begin();
+  for (auto &item : result) item.first = find(*it++);
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_PERSISTENT_SET_H_
@@ -0,0 +1,426 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_PRIORITY_QUEUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::move, std::swap
+
+#include "memory_report.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Двоичная куча поверх последовательного контейнера, как std::priority_queue:
+// top() - наибольший элемент с точки зрения Compare.
+template <typename T, typename Container = s21::vector<T>,
+          typename Compare = std::less<T>>
+class priority_queue {
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  priority_queue() {}
+  explicit priority_queue(const Compare &compare);
+  explicit priority_queue(std::initializer_list<value_type> const &items);
+  priority_queue(const priority_queue &pq);
+  priority_queue(priority_queue &&pq);
+  ~priority_queue() {}
+  priority_queue &operator=(priority_queue &&pq);
+
+  const_reference top() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void push(const_reference value);
+  void pop();
+  void swap(priority_queue &other);
+
+ private:
+  container_type c_;
+  Compare compare_;
+
+  void sift_up(size_type pos);
+  void sift_down(size_type pos);
+};
+
+template <typename value_type, typename Container, typename Compare>
+priority_queue<value_type, Container, Compare>::priority_queue(
+    const Compare &compare)
+    : compare_(compare) {}
+
+// построение кучи снизу вверх за O(n)
+template <typename value_type, typename Container, typename Compare>
+priority_queue<value_type, Container, Compare>::priority_queue(
+    std::initializer_list<value_type> const &items) {
+  for (auto &item : items) c_.push_back(item);
+  for (size_type i = c_.size() / 2; i > 0; --i) sift_down(i - 1);
+}
+
+template <typename value_type, typename Container, typename Compare>
+priority_queue<value_type, Container, Compare>::priority_queue(
+    const priority_queue &pq)
+    : c_(pq.c_), compare_(pq.compare_) {}
+
+template <typename value_type, typename Container, typename Compare>
+priority_queue<value_type, Container, Compare>::priority_queue(
+    priority_queue &&pq)
+    : c_(std::move(pq.c_)), compare_(std::move(pq.compare_)) {}
+
+template <typename value_type, typename Container, typename Compare>
+priority_queue<value_type, Container, Compare> &
+priority_queue<value_type, Container, Compare>::operator=(
+    priority_queue &&pq) {
+  if (this != &pq) {
+    c_ = std::move(pq.c_);
+    compare_ = std::move(pq.compare_);
+  }
+  return *this;
+}
+
+template <typename value_type, typename Container, typename Compare>
+typename priority_queue<value_type, Container, Compare>::const_reference
+priority_queue<value_type, Container, Compare>::top() const {
+  if (empty()) throw std::invalid_argument("the priority queue is empty");
+  return c_.front();
+}
+
+template <typename value_type, typename Container, typename Compare>
+bool priority_queue<value_type, Container, Compare>::empty() const {
+  return c_.empty();
+}
+
+template <typename value_type, typename Container, typename Compare>
+typename priority_queue<value_type, Container, Compare>::size_type
+priority_queue<value_type, Container, Compare>::size() const {
+  return c_.size();
+}
+
+template <typename value_type, typename Container, typename Compare>
+typename priority_queue<value_type, Container, Compare>::size_type
+priority_queue<value_type, Container, Compare>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type, typename Container, typename Compare>
+MemoryReport priority_queue<value_type, Container, Compare>::memory_report()
+    const {
+  MemoryReport report = c_.memory_report();
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename value_type, typename Container, typename Compare>
+void priority_queue<value_type, Container, Compare>::push(
+    const_reference value) {
+  c_.push_back(value);
+  sift_up(c_.size() - 1);
+}
+
+template <typename value_type, typename Container, typename Compare>
+void priority_queue<value_type, Container, Compare>::pop() {
+  if (empty()) throw std::invalid_argument("the priority queue is empty");
+  c_[0] = std::move(c_[c_.size() - 1]);
+  c_.pop_back();
+  if (!c_.empty()) sift_down(0);
+}
+
+template <typename value_type, typename Container, typename Compare>
+void priority_queue<value_type, Container, Compare>::swap(
+    priority_queue &other) {
+  c_.swap(other.c_);
+  std::swap(compare_, other.compare_);
+}
+
+// элемент поднимается "дыркой": родители сдвигаются вниз, а сам он
+// записывается один раз
+template <typename value_type, typename Container, typename Compare>
+void priority_queue<value_type, Container, Compare>::sift_up(size_type pos) {
+  value_type value = std::move(c_[pos]);
+  while (pos > 0) {
+    size_type parent = (pos - 1) / 2;
+    if (!compare_(c_[parent], value)) break;
+    c_[pos] = std::move(c_[parent]);
+    pos = parent;
+  }
+  c_[pos] = std::move(value);
+}
+
+template <typename value_type, typename Container, typename Compare>
+void priority_queue<value_type, Container, Compare>::sift_down(size_type pos) {
+  size_type size = c_.size();
+  value_type value = std::move(c_[pos]);
+  for (;;) {
+    size_type child = pos * 2 + 1;
+    if (child >= size) break;
+    if (child + 1 < size && compare_(c_[child], c_[child + 1])) ++child;
+    if (!compare_(value, c_[child])) break;
+    c_[pos] = std::move(c_[child]);
+    pos = child;
+  }
+  c_[pos] = std::move(value);
+}
+
+// Индексированная d-арная куча (по умолчанию 4-арная: дети узла лежат
+// рядом и помещаются в одну-две кэш-линии). В отличие от priority_queue,
+// top() - наименьший элемент по Compare, как принято для Дейкстры и
+// таймеров. push() возвращает дескриптор, по которому элемент можно
+// изменить (decrease_key, update) или удалить (erase) за O(log n).
+template <typename T, std::size_t Arity = 4, typename Compare = std::less<T>>
+class d_ary_heap {
+ public:
+  static_assert(Arity >= 2, "d_ary_heap requires Arity >= 2");
+
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using handle_type = std::size_t;
+
+  d_ary_heap() {}
+  explicit d_ary_heap(const Compare &compare);
+
+  const_reference top() const;
+  handle_type top_handle() const;
+  const_reference value(handle_type handle) const;
+  bool contains(handle_type handle) const;
+
+  bool empty() const;
+  size_type size() const;
+  void reserve(size_type size);
+  // дескрипторы в элементах кучи, positions_ и free_ - статья pointers
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  handle_type push(const_reference value);
+  void pop();
+  void decrease_key(handle_type handle, const_reference value);
+  void update(handle_type handle, const_reference value);
+  void erase(handle_type handle);
+  void clear();
+
+ private:
+  static constexpr size_type kNone = static_cast<size_type>(-1);
+
+  // значение хранится прямо в элементе кучи, чтобы сравнения при
+  // просеивании не ходили по дескриптору в отдельный массив
+  struct Entry {
+    value_type value_;
+    handle_type handle_;
+  };
+
+  // positions_ индексируется дескриптором, free_ - освободившиеся
+  // дескрипторы для повторного использования
+  s21::vector<Entry> heap_;
+  s21::vector<size_type> positions_;
+  s21::vector<handle_type> free_;
+  Compare compare_;
+
+  void place(size_type pos, Entry &&entry);
+  void sift_up(size_type pos);
+  void sift_down(size_type pos);
+  void check(handle_type handle) const;
+};
+
+template <typename value_type, std::size_t Arity, typename Compare>
+d_ary_heap<value_type, Arity, Compare>::d_ary_heap(const Compare &compare)
+    : compare_(compare) {}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::place(size_type pos,
+                                                   Entry &&entry) {
+  positions_[entry.handle_] = pos;
+  heap_[pos] = std::move(entry);
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::sift_up(size_type pos) {
+  Entry entry = std::move(heap_[pos]);
+  while (pos > 0) {
+    size_type parent = (pos - 1) / Arity;
+    if (!compare_(entry.value_, heap_[parent].value_)) break;
+    place(pos, std::move(heap_[parent]));
+    pos = parent;
+  }
+  place(pos, std::move(entry));
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::sift_down(size_type pos) {
+  size_type size = heap_.size();
+  Entry entry = std::move(heap_[pos]);
+  for (;;) {
+    size_type first = pos * Arity + 1;
+    if (first >= size) break;
+    size_type last = (first + Arity < size) ? first + Arity : size;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (compare_(heap_[child].value_, heap_[best].value_)) best = child;
+    }
+    if (!compare_(heap_[best].value_, entry.value_)) break;
+    place(pos, std::move(heap_[best]));
+    pos = best;
+  }
+  place(pos, std::move(entry));
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::check(handle_type handle) const {
+  if (!contains(handle)) throw std::out_of_range("invalid heap handle");
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+typename d_ary_heap<value_type, Arity, Compare>::const_reference
+d_ary_heap<value_type, Arity, Compare>::top() const {
+  if (empty()) throw std::invalid_argument("the heap is empty");
+  return heap_[0].value_;
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+typename d_ary_heap<value_type, Arity, Compare>::handle_type
+d_ary_heap<value_type, Arity, Compare>::top_handle() const {
+  if (empty()) throw std::invalid_argument("the heap is empty");
+  return heap_[0].handle_;
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+typename d_ary_heap<value_type, Arity, Compare>::const_reference
+d_ary_heap<value_type, Arity, Compare>::value(handle_type handle) const {
+  check(handle);
+  return heap_[positions_[handle]].value_;
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+bool d_ary_heap<value_type, Arity, Compare>::contains(
+    handle_type handle) const {
+  return handle < positions_.size() && positions_[handle] != kNone;
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+bool d_ary_heap<value_type, Arity, Compare>::empty() const {
+  return heap_.size() == 0;
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+typename d_ary_heap<value_type, Arity, Compare>::size_type
+d_ary_heap<value_type, Arity, Compare>::size() const {
+  return heap_.size();
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+typename d_ary_heap<value_type, Arity, Compare>::size_type
+d_ary_heap<value_type, Arity, Compare>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+MemoryReport d_ary_heap<value_type, Arity, Compare>::memory_report() const {
+  MemoryReport report = heap_.memory_report();
+  size_type n = heap_.size();
+  report.payload = n * memory::payload_size<value_type>::value;
+  report.pointers = n * sizeof(handle_type);
+  report.padding = n * sizeof(Entry) - report.payload - report.pointers;
+  for (MemoryReport index : {positions_.memory_report(),
+                             free_.memory_report()}) {
+    index.pointers = index.payload;
+    index.payload = 0;
+    index.object = 0;
+    report += index;
+  }
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::reserve(size_type size) {
+  heap_.reserve(size);
+  positions_.reserve(size);
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+typename d_ary_heap<value_type, Arity, Compare>::handle_type
+d_ary_heap<value_type, Arity, Compare>::push(const_reference value) {
+  handle_type handle;
+  if (free_.empty()) {
+    handle = positions_.size();
+    positions_.push_back(heap_.size());
+  } else {
+    handle = free_.back();
+    free_.pop_back();
+    positions_[handle] = heap_.size();
+  }
+  heap_.push_back(Entry{value, handle});
+  sift_up(heap_.size() - 1);
+  return handle;
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::pop() {
+  erase(top_handle());
+}
+
+// значение может только приблизиться к вершине кучи
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::decrease_key(
+    handle_type handle, const_reference value) {
+  check(handle);
+  value_type &current = heap_[positions_[handle]].value_;
+  if (compare_(current, value)) {
+    throw std::invalid_argument("decrease_key: new key is greater");
+  }
+  current = value;
+  sift_up(positions_[handle]);
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::update(handle_type handle,
+                                                    const_reference value) {
+  check(handle);
+  value_type &current = heap_[positions_[handle]].value_;
+  bool up = compare_(value, current);
+  current = value;
+  if (up) {
+    sift_up(positions_[handle]);
+  } else {
+    sift_down(positions_[handle]);
+  }
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::erase(handle_type handle) {
+  check(handle);
+  size_type pos = positions_[handle];
+  size_type last = heap_.size() - 1;
+  positions_[handle] = kNone;
+  free_.push_back(handle);
+  if (pos != last) {
+    // на место удалённого встаёт последний элемент и просеивается в нужную
+    // сторону
+    handle_type moved = heap_[last].handle_;
+    place(pos, std::move(heap_[last]));
+    heap_.pop_back();
+    sift_up(pos);
+    sift_down(positions_[moved]);
+  } else {
+    heap_.pop_back();
+  }
+}
+
+template <typename value_type, std::size_t Arity, typename Compare>
+void d_ary_heap<value_type, Arity, Compare>::clear() {
+  heap_.clear();
+  positions_.clear();
+  free_.clear();
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_PRIORITY_QUEUE_H_
@@ -1,11 +1,20 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_QUEUE_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_QUEUE_H_
 
+#include <cstddef>           // для std::size_t
+#include <cstdint>           // для SIZE_MAX
 #include <initializer_list>  // для std::initializer_list
+#include <iterator>          // для std::iterator_traits
+#include <stdexcept>         // для исключений
+#include <type_traits>       // для std::is_base_of
+#include <utility>           // для std::move, std::swap
 
-#include "node_single.h"
+#include "instrument.h"
+#include "memory_report.h"
 
 namespace s21 {
+// Очередь на кольцевом буфере: ёмкость всегда степень двойки, поэтому
+// индекс элемента вычисляется маской (head_ + i) & (capacity_ - 1).
 template <typename T>
 class queue {
  public:
@@ -14,43 +23,54 @@ class queue {
   using const_reference = const value_type &;
   using size_type = std::size_t;
 
-  typedef s21::node_single<value_type> Node;
-
-  queue();
+  queue() {}
   explicit queue(std::initializer_list<value_type> const &items);
   queue(const queue &q);
   queue(queue &&q);
   ~queue();
-  queue operator=(queue &&q);
+  queue &operator=(queue &&q);
 
   const_reference front();
   const_reference back();
 
   bool empty();
   size_type size();
+  size_type capacity() const;
+  size_type max_size() const;
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+  void reserve(size_type size);
 
   void push(const_reference value);
   void pop();
   void swap(queue &other);
 
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last);
+  void pop_n(size_type n);
+  template <class OutputIt>
+  OutputIt pop_n(size_type n, OutputIt out);
+
   template <class... Args>
   void emplace_back(Args &&...args);
 
  private:
-  size_type size_;
-  Node *head_;
-  Node *tail_;
+  static constexpr size_type kMinCapacity = 8U;
+
+  value_type *data_{nullptr};
+  size_type capacity_{0U};
+  size_type head_{0U};
+  size_type size_{0U};
 
-  void creat_first_node(const_reference value);
+  size_type mask() const;
+  void relocate(size_type capacity);
   void remove();
 };
 
-template <typename value_type>
-s21::queue<value_type>::queue() : size_(0), head_(nullptr), tail_(nullptr) {}
-
 template <typename value_type>
 s21::queue<value_type>::queue(const std::initializer_list<value_type> &items)
     : queue() {
+  reserve(items.size());
   for (auto item : items) {
     push(item);
   }
@@ -58,11 +78,16 @@ s21::queue<value_type>::queue(const std::initializer_list<value_type> &items)
 
 template <typename value_type>
 s21::queue<value_type>::queue(const s21::queue<value_type> &q) : queue() {
-  if (q.head_) {
-    for (Node *i = q.head_; i != q.tail_->next_;) {
-      push(i->value_);
-      i = i->next_;
+  if (q.size_) {
+    data_ = new value_type[q.capacity_];
+    S21_RECORD(Tracked::kQueue, Counter::kAllocations, 1);
+    S21_RECORD(Tracked::kQueue, Counter::kBytesAllocated,
+               q.capacity_ * sizeof(value_type));
+    capacity_ = q.capacity_;
+    for (size_type i = 0; i < q.size_; ++i) {
+      data_[i] = q.data_[(q.head_ + i) & q.mask()];
     }
+    size_ = q.size_;
   }
 }
 
@@ -78,68 +103,164 @@ s21::queue<value_type>::~queue() {
 
 template <typename value_type>
 bool s21::queue<value_type>::empty() {
-  return (head_ == nullptr && size_ == 0);
+  return size_ == 0;
 }
 
 template <typename value_type>
 void s21::queue<value_type>::remove() {
-  while (size_) pop();
+  if (data_ != nullptr) S21_RECORD(Tracked::kQueue, Counter::kFrees, 1);
+  delete[] data_;
+  data_ = nullptr;
+  capacity_ = head_ = size_ = 0;
 }
 
 template <typename value_type>
-s21::queue<value_type> s21::queue<value_type>::operator=(
+s21::queue<value_type> &s21::queue<value_type>::operator=(
     s21::queue<value_type> &&q) {
-  remove();
-  swap(q);
+  if (this != &q) {
+    remove();
+    swap(q);
+  }
+  return *this;
 }
 
 template <typename value_type>
-void s21::queue<value_type>::creat_first_node(const_reference value) {
-  Node *new_node = new Node(value);
-  ++size_;
-  head_ = tail_ = new_node;
-  head_->next_ = nullptr;
+typename s21::queue<value_type>::size_type s21::queue<value_type>::mask()
+    const {
+  return capacity_ - 1;
+}
+
+// переносит элементы в новый буфер, разворачивая кольцо так, что
+// первый элемент оказывается в нулевой ячейке
+template <typename value_type>
+void s21::queue<value_type>::relocate(size_type capacity) {
+  value_type *data = new value_type[capacity];
+  S21_RECORD(Tracked::kQueue, Counter::kAllocations, 1);
+  S21_RECORD(Tracked::kQueue, Counter::kBytesAllocated,
+             capacity * sizeof(value_type));
+  for (size_type i = 0; i < size_; ++i) {
+    data[i] = std::move(data_[(head_ + i) & mask()]);
+  }
+  if (data_ != nullptr) {
+    S21_RECORD(Tracked::kQueue, Counter::kFrees, 1);
+    S21_RECORD(Tracked::kQueue, Counter::kReallocations, 1);
+    S21_RECORD(Tracked::kQueue, Counter::kRelocatedBytes,
+               size_ * sizeof(value_type));
+  }
+  delete[] data_;
+  data_ = data;
+  capacity_ = capacity;
+  head_ = 0;
+}
+
+template <typename value_type>
+typename s21::queue<value_type>::size_type s21::queue<value_type>::capacity()
+    const {
+  return capacity_;
+}
+
+// как у vector: при таком пределе ёмкость, округлённая вверх до степени
+// двойки, не переполняет size_type
+template <typename value_type>
+typename s21::queue<value_type>::size_type s21::queue<value_type>::max_size()
+    const {
+  return SIZE_MAX / (sizeof(value_type) * 2);
+}
+
+template <typename value_type>
+typename s21::queue<value_type>::size_type
+s21::queue<value_type>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type>
+s21::MemoryReport s21::queue<value_type>::memory_report() const {
+  MemoryReport report = memory::array_report<value_type>(size_, capacity_);
+  report.headers = memory::array_overhead<value_type>(capacity_);
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename value_type>
+void s21::queue<value_type>::reserve(size_type size) {
+  if (size <= capacity_) return;
+  if (size > max_size())
+    throw std::length_error("Cannot create queue larger than max_size()");
+  size_type capacity = capacity_ ? capacity_ : kMinCapacity;
+  while (capacity < size) capacity <<= 1;
+  relocate(capacity);
 }
 
 template <typename value_type>
 void s21::queue<value_type>::push(const_reference value) {
-  if (size_ == 0) {
-    creat_first_node(value);
+  if (size_ == capacity_) {
+    // value может ссылаться на элемент этой же очереди
+    value_type copy = value;
+    reserve(size_ + 1);
+    data_[(head_ + size_) & mask()] = std::move(copy);
   } else {
-    Node *new_node = new Node(value);
-    ++size_;
-    tail_->next_ = new_node;
-    new_node->next_ = nullptr;
-    tail_ = new_node;
+    data_[(head_ + size_) & mask()] = value;
   }
+  ++size_;
 }
 
 template <typename value_type>
 void s21::queue<value_type>::pop() {
   if (empty()) throw std::invalid_argument("the queue is empty");
-  Node *node_to_delete = head_;
-  head_ = head_->next_;
-  delete node_to_delete;
+  data_[head_] = value_type();
+  head_ = (head_ + 1) & mask();
   --size_;
 }
 
+template <typename value_type>
+template <class InputIt>
+void s21::queue<value_type>::push_range(InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+    reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+  }
+  for (; first != last; ++first) push(*first);
+}
+
+template <typename value_type>
+void s21::queue<value_type>::pop_n(size_type n) {
+  if (n > size_) throw std::invalid_argument("not enough elements in queue");
+  for (size_type i = 0; i < n; ++i) {
+    data_[(head_ + i) & mask()] = value_type();
+  }
+  if (capacity_) head_ = (head_ + n) & mask();
+  size_ -= n;
+}
+
+template <typename value_type>
+template <class OutputIt>
+OutputIt s21::queue<value_type>::pop_n(size_type n, OutputIt out) {
+  if (n > size_) throw std::invalid_argument("not enough elements in queue");
+  for (size_type i = 0; i < n; ++i, ++out) {
+    *out = std::move(data_[(head_ + i) & mask()]);
+  }
+  pop_n(n);
+  return out;
+}
+
 template <typename value_type>
 void s21::queue<value_type>::swap(s21::queue<value_type> &other) {
-  std::swap(size_, other.size_);
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
   std::swap(head_, other.head_);
-  std::swap(tail_, other.tail_);
+  std::swap(size_, other.size_);
 }
 
 template <typename value_type>
 const value_type &s21::queue<value_type>::front() {
   if (empty()) throw std::invalid_argument("the queue is empty");
-  return head_->value_;
+  return data_[head_];
 }
 
 template <typename value_type>
 const value_type &s21::queue<value_type>::back() {
   if (empty()) throw std::invalid_argument("the queue is empty");
-  return tail_->value_;
+  return data_[(head_ + size_ - 1) & mask()];
 }
 
 template <typename value_type>
@@ -160,4 +281,4 @@ void queue<value_type>::emplace_back(Args &&...args) {
 
 }  // namespace s21
 
-#endif  // CPP2_S21_CONTAINERS_SRC_S21_QUEUE_H_
\ No newline at end of file
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_QUEUE_H_
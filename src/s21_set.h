@@ -9,16 +9,17 @@
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key>
-class set : RBTree<Key, Key> {
+template <typename Key, typename Source = HeapSource>
+class set : RBTree<Key, Key, Tracked::kSet, Source> {
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename s21::RBTree<key_type, value_type>::iterator;
-  using const_iterator =
-      typename s21::RBTree<key_type, value_type>::const_iterator;
+  using iterator =
+      typename RBTree<key_type, value_type, Tracked::kSet, Source>::iterator;
+  using const_iterator = typename RBTree<key_type, value_type, Tracked::kSet,
+                                         Source>::const_iterator;
   using size_type = std::size_t;
 
   typedef s21::RBTreeNode<key_type, value_type> Node;
@@ -38,6 +39,8 @@ class set : RBTree<Key, Key> {
   bool empty();
   size_type size();
   size_type max_size();
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
 
   void clear();
   std::pair<iterator, bool> insert(const value_type &value);
@@ -48,23 +51,32 @@ class set : RBTree<Key, Key> {
   template <typename... Args>
   vector<std::pair<iterator, bool>> emplace(Args &&...args);
 
+ protected:
+  // для pmr::set: узлы из ресурса
+  explicit set(const Source &memory)
+      : s21::RBTree<Key, Key, Tracked::kSet, Source>(memory) {}
+
+  using s21::RBTree<key_type, value_type, Tracked::kSet, Source>::memory;
+
  private:
   size_type size_{0};
-  using s21::RBTree<key_type, value_type>::_root;
-  using s21::RBTree<key_type, value_type>::Contains;
-  using s21::RBTree<key_type, value_type>::Insert;
-  using s21::RBTree<key_type, value_type>::Remove;
+  using s21::RBTree<key_type, value_type, Tracked::kSet, Source>::_root;
+  using s21::RBTree<key_type, value_type, Tracked::kSet, Source>::Contains;
+  using s21::RBTree<key_type, value_type, Tracked::kSet, Source>::Insert;
+  using s21::RBTree<key_type, value_type, Tracked::kSet, Source>::Nodes_report;
+  using s21::RBTree<key_type, value_type, Tracked::kSet, Source>::Remove;
 };
 
-template <class value_type>
-s21::set<value_type>::set(const std::initializer_list<value_type> &items) {
+template <class value_type, class Source>
+s21::set<value_type, Source>::set(
+    const std::initializer_list<value_type> &items) {
   for (auto item : items) {
     insert(item);
   }
 }
 
-template <class value_type>
-s21::set<value_type>::set(const s21::set<value_type> &s) {
+template <class value_type, class Source>
+s21::set<value_type, Source>::set(const s21::set<value_type, Source> &s) {
   iterator it_begin = s.begin();
   iterator it_end = s.end();
   while (it_begin != it_end) {
@@ -73,28 +85,29 @@ s21::set<value_type>::set(const s21::set<value_type> &s) {
   }
 }
 
-template <class value_type>
-s21::set<value_type>::set(s21::set<value_type> &&s) {
+template <class value_type, class Source>
+s21::set<value_type, Source>::set(s21::set<value_type, Source> &&s) {
   clear();
   swap(s);
 }
 
-template <class value_type>
-s21::set<value_type> s21::set<value_type>::operator=(s21::set<value_type> &&s) {
+template <class value_type, class Source>
+s21::set<value_type, Source> s21::set<value_type, Source>::operator=(
+    s21::set<value_type, Source> &&s) {
   clear();
   swap(s);
 }
 
-template <class value_type>
-void s21::set<value_type>::clear() {
-  s21::RBTree<value_type, value_type>::Destory(_root);
+template <class value_type, class Source>
+void s21::set<value_type, Source>::clear() {
+  s21::RBTree<value_type, value_type, Tracked::kSet, Source>::Destory(_root);
   size_ = 0;
   _root = nullptr;
 }
 
-template <class value_type>
-std::pair<typename s21::set<value_type>::iterator, bool>
-s21::set<value_type>::insert(const value_type &value) {
+template <class value_type, class Source>
+std::pair<typename s21::set<value_type, Source>::iterator, bool>
+s21::set<value_type, Source>::insert(const value_type &value) {
   std::pair<iterator, bool> result;
   if (!contains(value)) {
     Insert(value, value);
@@ -107,34 +120,40 @@ s21::set<value_type>::insert(const value_type &value) {
   return result;
 }
 
-template <class value_type>
-void s21::set<value_type>::erase(s21::set<value_type>::iterator pos) {
+template <class value_type, class Source>
+void s21::set<value_type, Source>::erase(
+    s21::set<value_type, Source>::iterator pos) {
   if (contains(pos.ptr_->_key)) {
     Remove(pos.ptr_->_key);
     --size_;
   }
 }
 
-template <class value_type>
-typename s21::set<value_type>::iterator s21::set<value_type>::begin() const {
+template <class value_type, class Source>
+typename s21::set<value_type, Source>::iterator
+s21::set<value_type, Source>::begin() const {
   Node *x = _root;
-  while (x->_left) x = x->_left;
+  while (x && x->_left) x = x->_left;
   return iterator(_root, x);
 }
 
-template <class value_type>
-typename s21::set<value_type>::iterator s21::set<value_type>::end() const {
+template <class value_type, class Source>
+typename s21::set<value_type, Source>::iterator
+s21::set<value_type, Source>::end() const {
   Node *x = _root;
   while (x) x = x->_right;
   return iterator(_root, x);
 }
 
-template <class value_type>
-typename s21::set<value_type>::iterator s21::set<value_type>::find(
-    const value_type &key) {
+template <class value_type, class Source>
+typename s21::set<value_type, Source>::iterator
+s21::set<value_type, Source>::find(const value_type &key) {
   iterator result = end();
   Node *x = _root;
+  S21_RECORD(Tracked::kSet, Counter::kLookups, 1);
   while (x != nullptr) {
+    S21_RECORD(Tracked::kSet, Counter::kNodeVisits, 1);
+    S21_RECORD(Tracked::kSet, Counter::kComparisons, key == x->_value ? 1 : 2);
     if (key == x->_value) {
       result = iterator(_root, x);
       break;
@@ -147,35 +166,48 @@ typename s21::set<value_type>::iterator s21::set<value_type>::find(
   return result;
 }
 
-template <class value_type>
-bool s21::set<value_type>::contains(const value_type &key) {
+template <class value_type, class Source>
+bool s21::set<value_type, Source>::contains(const value_type &key) {
   return Contains(key);
 }
 
-template <class value_type>
-void s21::set<value_type>::swap(s21::set<value_type> &other) {
+template <class value_type, class Source>
+void s21::set<value_type, Source>::swap(s21::set<value_type, Source> &other) {
   std::swap(_root, other._root);
   std::swap(size_, other.size_);
+  std::swap(memory(), other.memory());
 }
 
-template <class value_type>
-bool s21::set<value_type>::empty() {
+template <class value_type, class Source>
+bool s21::set<value_type, Source>::empty() {
   return (_root == nullptr && size_ == 0);
 }
 
-template <class value_type>
-std::size_t s21::set<value_type>::size() {
+template <class value_type, class Source>
+std::size_t s21::set<value_type, Source>::size() {
   return size_;
 }
 
-template <class value_type>
-std::size_t s21::set<value_type>::max_size() {
+template <class value_type, class Source>
+std::size_t s21::set<value_type, Source>::max_size() {
   return SIZE_MAX / ((sizeof(size_t) * 5) * 2);
 }
 
-template <class value_type>
-void s21::set<value_type>::merge(s21::set<value_type> &other) {
-  s21::set<value_type> temp(other);
+template <class value_type, class Source>
+std::size_t s21::set<value_type, Source>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <class value_type, class Source>
+s21::MemoryReport s21::set<value_type, Source>::memory_report() const {
+  MemoryReport report = Nodes_report(size_, true);
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <class value_type, class Source>
+void s21::set<value_type, Source>::merge(s21::set<value_type, Source> &other) {
+  s21::set<value_type, Source> temp(other);
   other.clear();
   for (auto n : temp) {
     if (!contains(n)) {
@@ -187,10 +219,10 @@ void s21::set<value_type>::merge(s21::set<value_type> &other) {
   temp.clear();
 }
 
-template <class value_type>
+template <class value_type, class Source>
 template <class... Args>
-s21::vector<std::pair<typename s21::set<value_type>::iterator, bool>>
-s21::set<value_type>::emplace(Args &&...args) {
+s21::vector<std::pair<typename s21::set<value_type, Source>::iterator, bool>>
+s21::set<value_type, Source>::emplace(Args &&...args) {
   s21::vector<std::pair<iterator, bool>> result;
   std::pair<iterator, bool> elm;
   std::initializer_list<value_type> arg{args...};
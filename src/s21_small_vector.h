@@ -0,0 +1,442 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SMALL_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SMALL_VECTOR_H_
+
+#include <cstddef>           // для std::size_t
+#include <cstdint>           // для SIZE_MAX
+#include <cstring>           // для std::memcpy
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <type_traits>       // для std::is_trivially_copyable
+#include <utility>           // для std::move
+
+#include "memory_report.h"
+
+namespace s21 {
+// Вектор с интерфейсом s21::vector, у которого первые N элементов лежат
+// внутри объекта: пока size() <= N, память в куче не выделяется. При росте
+// дальше элементы переезжают в кучу, а shrink_to_fit() при size() <= N
+// возвращает их обратно. Как и у s21::vector, ёмкость заполнена
+// сконструированными по умолчанию объектами. Перемещение из вектора во
+// встроенном режиме перемещает элементы по одному, поэтому итераторы
+// перемещённого вектора недействительны в обоих режимах.
+template <typename T, std::size_t N>
+class small_vector {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+  using size_type = std::size_t;
+
+  static_assert(N > 0, "small_vector needs at least one inline slot");
+
+  small_vector() {}
+  explicit small_vector(size_type n);
+  explicit small_vector(std::initializer_list<value_type> const &items);
+  small_vector(const small_vector &v);
+  small_vector(small_vector &&v);
+  ~small_vector();
+  small_vector &operator=(const small_vector &v);
+  small_vector &operator=(small_vector &&v);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+  iterator data();
+  const_iterator data() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  // элементы во встроенном буфере, а не в куче
+  bool is_inline() const;
+  // встроенный буфер входит в отчёт всегда: в режиме кучи он весь slack
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  void erase(iterator pos);
+  void push_back(const_reference value);
+  void pop_back();
+  void swap(small_vector &other);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  void emplace_back(Args &&...args);
+
+ private:
+  size_type size_{0U};
+  size_type capacity_{N};
+  iterator data_{inline_};
+  value_type inline_[N];
+
+  void remove();
+  void allocate(size_type size);
+  void steal(small_vector *v);
+
+  static void copy_elements(iterator dst, const_iterator src, size_type n);
+  static void move_elements(iterator dst, iterator src, size_type n);
+};
+
+template <typename value_type, std::size_t N>
+small_vector<value_type, N>::small_vector(size_type n) {
+  reserve(n);
+  size_ = n;
+}
+
+template <typename value_type, std::size_t N>
+small_vector<value_type, N>::small_vector(
+    std::initializer_list<value_type> const &items) {
+  reserve(items.size());
+  for (auto &item : items) data_[size_++] = item;
+}
+
+template <typename value_type, std::size_t N>
+small_vector<value_type, N>::small_vector(const small_vector &v) {
+  reserve(v.size_);
+  copy_elements(data_, v.data_, v.size_);
+  size_ = v.size_;
+}
+
+template <typename value_type, std::size_t N>
+small_vector<value_type, N>::small_vector(small_vector &&v) {
+  steal(&v);
+}
+
+template <typename value_type, std::size_t N>
+small_vector<value_type, N>::~small_vector() {
+  remove();
+}
+
+template <typename value_type, std::size_t N>
+small_vector<value_type, N> &small_vector<value_type, N>::operator=(
+    const small_vector &v) {
+  if (this != &v) {
+    clear();
+    reserve(v.size_);
+    copy_elements(data_, v.data_, v.size_);
+    size_ = v.size_;
+  }
+  return *this;
+}
+
+template <typename value_type, std::size_t N>
+small_vector<value_type, N> &small_vector<value_type, N>::operator=(
+    small_vector &&v) {
+  if (this != &v) {
+    remove();
+    steal(&v);
+  }
+  return *this;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::reference
+small_vector<value_type, N>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Out of range");
+  return data_[pos];
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::const_reference
+small_vector<value_type, N>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Out of range");
+  return data_[pos];
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::reference
+small_vector<value_type, N>::operator[](size_type pos) {
+  return data_[pos];
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::const_reference
+small_vector<value_type, N>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::const_reference
+small_vector<value_type, N>::front() const {
+  return data_[0];
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::const_reference
+small_vector<value_type, N>::back() const {
+  return data_[size_ - 1];
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::iterator
+small_vector<value_type, N>::data() {
+  return data_;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::const_iterator
+small_vector<value_type, N>::data() const {
+  return data_;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::iterator
+small_vector<value_type, N>::begin() {
+  return data_;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::iterator
+small_vector<value_type, N>::end() {
+  return data_ + size_;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::const_iterator
+small_vector<value_type, N>::begin() const {
+  return data_;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::const_iterator
+small_vector<value_type, N>::end() const {
+  return data_ + size_;
+}
+
+template <typename value_type, std::size_t N>
+bool small_vector<value_type, N>::empty() const {
+  return size_ == 0;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::size_type
+small_vector<value_type, N>::size() const {
+  return size_;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::size_type
+small_vector<value_type, N>::max_size() const {
+  return SIZE_MAX / (sizeof(value_type) * 2);
+}
+
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::reserve(size_type size) {
+  if (size > capacity_) allocate(size);
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::size_type
+small_vector<value_type, N>::capacity() const {
+  return capacity_;
+}
+
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::shrink_to_fit() {
+  if (size_ < capacity_) allocate(size_);
+}
+
+template <typename value_type, std::size_t N>
+bool small_vector<value_type, N>::is_inline() const {
+  return data_ == inline_;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::size_type
+small_vector<value_type, N>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type, std::size_t N>
+MemoryReport small_vector<value_type, N>::memory_report() const {
+  MemoryReport report = memory::array_report<value_type>(size_, capacity_);
+  if (!is_inline()) {
+    report.slack += sizeof(inline_);
+    report.headers = memory::array_overhead<value_type>(capacity_);
+  }
+  report.object = sizeof(*this) - sizeof(inline_);
+  return report;
+}
+
+// как у s21::vector: объекты остаются в ёмкости, куча не освобождается
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::clear() {
+  size_ = 0;
+}
+
+template <typename value_type, std::size_t N>
+typename small_vector<value_type, N>::iterator
+small_vector<value_type, N>::insert(iterator pos, const_reference value) {
+  size_type index = static_cast<size_type>(pos - data_);
+  if (index >= size_) {
+    push_back(value);
+    return data_ + size_ - 1;
+  }
+  value_type copy = value;
+  push_back(data_[size_ - 1]);
+  for (size_type i = size_ - 2; i > index; --i) {
+    data_[i] = std::move(data_[i - 1]);
+  }
+  data_[index] = std::move(copy);
+  return data_ + index;
+}
+
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::erase(iterator pos) {
+  if (size_ != 0) {
+    for (; pos + 1 != end(); ++pos) *pos = std::move(*(pos + 1));
+    --size_;
+  }
+}
+
+// value копируется до переезда: он может ссылаться на элемент этого вектора
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::push_back(const_reference value) {
+  if (size_ == capacity_) {
+    value_type copy = value;
+    allocate(capacity_ * 2);
+    data_[size_++] = std::move(copy);
+  } else {
+    data_[size_++] = value;
+  }
+}
+
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::pop_back() {
+  if (!empty()) --size_;
+}
+
+// во встроенном режиме указатель не обменять, поэтому обмен через
+// перемещения
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::swap(small_vector &other) {
+  if (this == &other) return;
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(data_, other.data_);
+  } else {
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+}
+
+template <typename value_type, std::size_t N>
+template <class... Args>
+typename small_vector<value_type, N>::iterator
+small_vector<value_type, N>::emplace(const_iterator pos, Args &&...args) {
+  iterator it = data_ + (pos - data_);
+  if ((sizeof...(args)) == 0) {
+    value_type _empty = {};
+    insert(it, _empty);
+  }
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) {
+    it = insert(it, val);
+    ++it;
+  }
+  return it;
+}
+
+template <typename value_type, std::size_t N>
+template <class... Args>
+void small_vector<value_type, N>::emplace_back(Args &&...args) {
+  if ((sizeof...(args)) == 0) {
+    value_type _empty = {};
+    push_back(_empty);
+  }
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) push_back(val);
+}
+
+// освобождает кучу и возвращает вектор во встроенный режим
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::remove() {
+  if (!is_inline()) delete[] data_;
+  data_ = inline_;
+  capacity_ = N;
+  size_ = 0;
+}
+
+// Новая ёмкость не меньше N; если size <= N, элементы возвращаются во
+// встроенный буфер.
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::allocate(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("Cannot create vector larger than max_size()");
+  }
+  size_type keep = size_ < size ? size_ : size;
+  if (size <= N) {
+    if (is_inline()) return;
+    move_elements(inline_, data_, keep);
+    delete[] data_;
+    data_ = inline_;
+    capacity_ = N;
+  } else {
+    iterator data = new value_type[size];
+    move_elements(data, data_, keep);
+    if (!is_inline()) delete[] data_;
+    data_ = data;
+    capacity_ = size;
+  }
+  size_ = keep;
+}
+
+// забирает содержимое v: кучу - указателем, встроенный буфер - по
+// элементам; v остаётся пустым во встроенном режиме
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::steal(small_vector *v) {
+  if (v->is_inline()) {
+    move_elements(inline_, v->inline_, v->size_);
+  } else {
+    data_ = v->data_;
+    capacity_ = v->capacity_;
+    v->data_ = v->inline_;
+    v->capacity_ = N;
+  }
+  size_ = v->size_;
+  v->size_ = 0;
+}
+
+// тривиально копируемые типы переносятся одним memcpy, остальные -
+// поэлементно, чтобы не дублировать владеющие указатели
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::copy_elements(iterator dst,
+                                                const_iterator src,
+                                                size_type n) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    if (n) std::memcpy(dst, src, n * sizeof(value_type));
+  } else {
+    for (size_type i = 0; i < n; ++i) dst[i] = src[i];
+  }
+}
+
+template <typename value_type, std::size_t N>
+void small_vector<value_type, N>::move_elements(iterator dst, iterator src,
+                                                size_type n) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    if (n) std::memcpy(dst, src, n * sizeof(value_type));
+  } else {
+    for (size_type i = 0; i < n; ++i) dst[i] = std::move(src[i]);
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SMALL_VECTOR_H_
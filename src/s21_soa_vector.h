@@ -0,0 +1,352 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SOA_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SOA_VECTOR_H_
+
+#include <cstddef>           // для std::size_t
+#include <cstdint>           // для SIZE_MAX
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <tuple>             // для std::tuple, std::get
+#include <utility>           // для std::move, std::index_sequence
+
+#include "iterator_soa.h"
+#include "memory_report.h"
+#include "s21_vector.h"
+#include "span.h"
+
+namespace s21 {
+// Вектор записей из полей Fields..., где каждое поле хранится в своём
+// столбце - отдельном s21::vector. Проход по одному-двум полям читает только
+// их столбцы и векторизуется компилятором. Запись целиком видна как кортеж
+// ссылок на поля: operator[] и итераторы возвращают std::tuple<Fields &...>,
+// так что работает for (auto [a, b] : soa).
+template <typename... Fields>
+class soa_vector {
+ public:
+  static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+  using value_type = std::tuple<Fields...>;
+  using reference = std::tuple<Fields &...>;
+  using const_reference = std::tuple<const Fields &...>;
+  using iterator = SoaIterator<soa_vector, reference>;
+  using const_iterator = SoaIterator<const soa_vector, const_reference>;
+  using size_type = std::size_t;
+
+  // тип поля с номером I
+  template <std::size_t I>
+  using field_type = typename std::tuple_element<I, value_type>::type;
+
+  soa_vector() {}
+  explicit soa_vector(size_type n);
+  explicit soa_vector(std::initializer_list<value_type> const &items);
+  soa_vector(const soa_vector &v);
+  soa_vector(soa_vector &&v);
+  ~soa_vector() {}
+  soa_vector &operator=(const soa_vector &v);
+  soa_vector &operator=(soa_vector &&v);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+
+  // столбец поля I целиком; действителен до изменения размера
+  template <std::size_t I>
+  span<field_type<I>> column();
+  template <std::size_t I>
+  span<const field_type<I>> column() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  // сумма по столбцам: у столбцов нет выравнивания между полями
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void clear();
+  void push_back(const value_type &value);
+  void push_back(value_type &&value);
+  void pop_back();
+  void swap(soa_vector &other);
+
+  template <typename... Args>
+  void emplace_back(Args &&...args);
+
+ private:
+  using indices = std::index_sequence_for<Fields...>;
+
+  std::tuple<vector<Fields>...> columns_;
+
+  template <std::size_t... I>
+  reference get(size_type pos, std::index_sequence<I...>);
+  template <std::size_t... I>
+  const_reference get(size_type pos, std::index_sequence<I...>) const;
+  template <typename Tuple, std::size_t... I>
+  void append(Tuple &&value, std::index_sequence<I...>);
+  template <std::size_t... I>
+  void swap_columns(soa_vector &other, std::index_sequence<I...>);
+  template <typename F, std::size_t... I>
+  void for_each_column(F &&f, std::index_sequence<I...>);
+};
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(size_type n) {
+  reserve(n);
+  for (size_type i = 0; i < n; ++i) push_back(value_type());
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(
+    std::initializer_list<value_type> const &items) {
+  reserve(items.size());
+  for (auto &item : items) push_back(item);
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(const soa_vector &v)
+    : columns_(v.columns_) {}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(soa_vector &&v) {
+  swap(v);
+}
+
+template <typename... Fields>
+soa_vector<Fields...> &soa_vector<Fields...>::operator=(const soa_vector &v) {
+  if (this != &v) {
+    soa_vector tmp(v);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename... Fields>
+soa_vector<Fields...> &soa_vector<Fields...>::operator=(soa_vector &&v) {
+  if (this != &v) {
+    soa_vector tmp(std::move(v));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::at(
+    size_type pos) {
+  if (pos >= size()) throw std::out_of_range("Out of range");
+  return get(pos, indices());
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::at(
+    size_type pos) const {
+  if (pos >= size()) throw std::out_of_range("Out of range");
+  return get(pos, indices());
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::operator[](
+    size_type pos) {
+  return get(pos, indices());
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference
+soa_vector<Fields...>::operator[](size_type pos) const {
+  return get(pos, indices());
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::front()
+    const {
+  return get(0, indices());
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::back()
+    const {
+  return get(size() - 1, indices());
+}
+
+template <typename... Fields>
+template <std::size_t I>
+span<typename soa_vector<Fields...>::template field_type<I>>
+soa_vector<Fields...>::column() {
+  auto &col = std::get<I>(columns_);
+  return span<field_type<I>>(col.data(), col.size());
+}
+
+template <typename... Fields>
+template <std::size_t I>
+span<const typename soa_vector<Fields...>::template field_type<I>>
+soa_vector<Fields...>::column() const {
+  auto &col = std::get<I>(columns_);
+  return span<const field_type<I>>(col.data(), col.size());
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::iterator soa_vector<Fields...>::begin() {
+  return iterator(this, 0);
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::iterator soa_vector<Fields...>::end() {
+  return iterator(this, size());
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::begin()
+    const {
+  return const_iterator(this, 0);
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::end()
+    const {
+  return const_iterator(this, size());
+}
+
+template <typename... Fields>
+bool soa_vector<Fields...>::empty() const {
+  return size() == 0;
+}
+
+// все столбцы одной длины, размер берётся по первому
+template <typename... Fields>
+typename soa_vector<Fields...>::size_type soa_vector<Fields...>::size() const {
+  return std::get<0>(columns_).size();
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::size_type soa_vector<Fields...>::max_size()
+    const {
+  return SIZE_MAX / (sizeof(Fields) + ...) / 2;
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("Cannot create vector larger than max_size()");
+  }
+  for_each_column([size](auto &col) { col.reserve(size); }, indices());
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::size_type soa_vector<Fields...>::capacity()
+    const {
+  return std::get<0>(columns_).capacity();
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::shrink_to_fit() {
+  for_each_column([](auto &col) { col.shrink_to_fit(); }, indices());
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::size_type soa_vector<Fields...>::memory_usage()
+    const {
+  return memory_report().total();
+}
+
+template <typename... Fields>
+MemoryReport soa_vector<Fields...>::memory_report() const {
+  MemoryReport report;
+  std::apply(
+      [&report](const auto &...col) {
+        ((report += col.memory_report()), ...);
+      },
+      columns_);
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::clear() {
+  for_each_column([](auto &col) { col.clear(); }, indices());
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::push_back(const value_type &value) {
+  append(value, indices());
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::push_back(value_type &&value) {
+  append(std::move(value), indices());
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::pop_back() {
+  if (!empty()) {
+    for_each_column([](auto &col) { col.pop_back(); }, indices());
+  }
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::swap(soa_vector &other) {
+  if (this != &other) swap_columns(other, indices());
+}
+
+template <typename... Fields>
+template <class... Args>
+void soa_vector<Fields...>::emplace_back(Args &&...args) {
+  if ((sizeof...(args)) == 0) push_back(value_type());
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) push_back(val);
+}
+
+template <typename... Fields>
+template <std::size_t... I>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::get(
+    size_type pos, std::index_sequence<I...>) {
+  return reference(std::get<I>(columns_)[pos]...);
+}
+
+template <typename... Fields>
+template <std::size_t... I>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::get(
+    size_type pos, std::index_sequence<I...>) const {
+  return const_reference(std::get<I>(columns_)[pos]...);
+}
+
+// если столбец не смог вырасти, уже дополненные столбцы откатываются,
+// чтобы длины не разошлись
+template <typename... Fields>
+template <typename Tuple, std::size_t... I>
+void soa_vector<Fields...>::append(Tuple &&value, std::index_sequence<I...>) {
+  size_type done = 0;
+  try {
+    ((std::get<I>(columns_).push_back(
+          std::get<I>(std::forward<Tuple>(value))),
+      ++done),
+     ...);
+  } catch (...) {
+    ((I < done ? std::get<I>(columns_).pop_back() : void()), ...);
+    throw;
+  }
+}
+
+template <typename... Fields>
+template <std::size_t... I>
+void soa_vector<Fields...>::swap_columns(soa_vector &other,
+                                         std::index_sequence<I...>) {
+  (std::get<I>(columns_).swap(std::get<I>(other.columns_)), ...);
+}
+
+template <typename... Fields>
+template <typename F, std::size_t... I>
+void soa_vector<Fields...>::for_each_column(F &&f, std::index_sequence<I...>) {
+  (f(std::get<I>(columns_)), ...);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SOA_VECTOR_H_
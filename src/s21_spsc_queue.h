@@ -0,0 +1,195 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SPSC_QUEUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SPSC_QUEUE_H_
+
+#include <atomic>     // для std::atomic
+#include <cstddef>    // для std::size_t
+#include <stdexcept>  // для исключений
+#include <utility>    // для std::move
+
+#include "memory_report.h"
+
+namespace s21 {
+// Ограниченная очередь без блокировок для одного производителя и одного
+// потребителя. tail_ пишет только производитель, head_ - только потребитель;
+// каждая сторона держит кэшированную копию чужого индекса, чтобы не читать
+// разделяемую кэш-линию на каждой операции.
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  explicit spsc_queue(size_type capacity);
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+  ~spsc_queue();
+
+  bool try_push(const_reference value);
+  bool try_push(value_type &&value);
+  bool try_pop(reference value);
+
+  template <class InputIt>
+  size_type try_push_n(InputIt first, size_type n);
+  template <class OutputIt>
+  size_type try_pop_n(OutputIt out, size_type n);
+
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+  // payload и slack делятся по size() на момент вызова
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+ private:
+  static constexpr size_type kCacheLine = 64U;
+
+  value_type *data_{nullptr};
+  size_type mask_{0U};
+
+  alignas(kCacheLine) std::atomic<size_type> head_{0U};
+  size_type cached_tail_{0U};
+
+  alignas(kCacheLine) std::atomic<size_type> tail_{0U};
+  size_type cached_head_{0U};
+
+  char padding_[kCacheLine - sizeof(std::atomic<size_type>) -
+                sizeof(size_type)];
+
+  size_type free_slots(size_type tail, size_type wanted);
+  size_type ready_slots(size_type head, size_type wanted);
+};
+
+template <typename value_type>
+spsc_queue<value_type>::spsc_queue(size_type capacity) {
+  if (capacity == 0) throw std::invalid_argument("capacity must be positive");
+  size_type size = 1;
+  while (size < capacity) size <<= 1;
+  data_ = new value_type[size];
+  mask_ = size - 1;
+}
+
+template <typename value_type>
+spsc_queue<value_type>::~spsc_queue() {
+  delete[] data_;
+}
+
+// сторона производителя: перечитывает head_ только когда по кэшированному
+// значению свободных ячеек меньше, чем нужно
+template <typename value_type>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::free_slots(
+    size_type tail, size_type wanted) {
+  size_type free = capacity() - (tail - cached_head_);
+  if (free < wanted) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    free = capacity() - (tail - cached_head_);
+  }
+  return free;
+}
+
+// сторона потребителя: перечитывает tail_ только когда по кэшированному
+// значению готовых элементов меньше, чем нужно
+template <typename value_type>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::ready_slots(
+    size_type head, size_type wanted) {
+  size_type ready = cached_tail_ - head;
+  if (ready < wanted) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    ready = cached_tail_ - head;
+  }
+  return ready;
+}
+
+template <typename value_type>
+bool spsc_queue<value_type>::try_push(const_reference value) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (free_slots(tail, 1) == 0) return false;
+  data_[tail & mask_] = value;
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename value_type>
+bool spsc_queue<value_type>::try_push(value_type &&value) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (free_slots(tail, 1) == 0) return false;
+  data_[tail & mask_] = std::move(value);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename value_type>
+bool spsc_queue<value_type>::try_pop(reference value) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (ready_slots(head, 1) == 0) return false;
+  value = std::move(data_[head & mask_]);
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename value_type>
+template <class InputIt>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::try_push_n(
+    InputIt first, size_type n) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  size_type free = free_slots(tail, n);
+  if (n > free) n = free;
+  for (size_type i = 0; i < n; ++i, ++first) {
+    data_[(tail + i) & mask_] = *first;
+  }
+  if (n) tail_.store(tail + n, std::memory_order_release);
+  return n;
+}
+
+template <typename value_type>
+template <class OutputIt>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::try_pop_n(
+    OutputIt out, size_type n) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  size_type ready = ready_slots(head, n);
+  if (n > ready) n = ready;
+  for (size_type i = 0; i < n; ++i, ++out) {
+    *out = std::move(data_[(head + i) & mask_]);
+  }
+  if (n) head_.store(head + n, std::memory_order_release);
+  return n;
+}
+
+template <typename value_type>
+bool spsc_queue<value_type>::empty() const {
+  return size() == 0;
+}
+
+// из другого потока значение приблизительное
+template <typename value_type>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::size()
+    const {
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type tail = tail_.load(std::memory_order_acquire);
+  return tail - head;
+}
+
+template <typename value_type>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::capacity()
+    const {
+  return mask_ + 1;
+}
+
+template <typename value_type>
+typename spsc_queue<value_type>::size_type
+spsc_queue<value_type>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type>
+MemoryReport spsc_queue<value_type>::memory_report() const {
+  MemoryReport report = memory::array_report<value_type>(size(), capacity());
+  report.headers = memory::array_overhead<value_type>(capacity());
+  report.object = sizeof(*this);
+  return report;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SPSC_QUEUE_H_
@@ -0,0 +1,335 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STABLE_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STABLE_VECTOR_H_
+
+#include <cstddef>           // для std::size_t
+#include <cstdint>           // для SIZE_MAX
+#include <initializer_list>  // для std::initializer_list
+#include <new>               // для placement new, std::align_val_t
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::move, std::swap
+
+#include "iterator_stable.h"
+#include "memory_report.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// размер куска по умолчанию: около 64 КБ, степень двойки
+template <typename T>
+constexpr std::size_t stable_vector_chunk() {
+  std::size_t n = 1;
+  while (n * 2 * sizeof(T) <= 65536) n *= 2;
+  return n;
+}
+
+// Вектор из кусков по ChunkSize элементов. Элемент i лежит в куске
+// i >> shift на месте i & mask. Рост добавляет новый кусок и ничего не
+// переносит: адреса элементов не меняются до их удаления, а пик памяти
+// при росте - один кусок (плюс каталог указателей на куски). Память кусков
+// сырая, конструируются только первые size() элементов. Вставки и удаления
+// в середине нет - они сдвигали бы элементы под сохранёнными указателями.
+template <typename T, std::size_t ChunkSize = stable_vector_chunk<T>()>
+class stable_vector {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = StableVectorIterator<stable_vector, value_type>;
+  using const_iterator =
+      StableVectorIterator<const stable_vector, const value_type>;
+  using size_type = std::size_t;
+
+  static_assert(ChunkSize != 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+                "ChunkSize must be a power of two");
+  static constexpr size_type kShift = __builtin_ctzll(ChunkSize);
+  static constexpr size_type kMask = ChunkSize - 1;
+
+  stable_vector() {}
+  explicit stable_vector(size_type n);
+  explicit stable_vector(std::initializer_list<value_type> const &items);
+  stable_vector(const stable_vector &v);
+  stable_vector(stable_vector &&v);
+  ~stable_vector();
+  stable_vector &operator=(const stable_vector &v);
+  stable_vector &operator=(stable_vector &&v);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  // освобождает пустые куски в конце
+  void shrink_to_fit();
+  // куски целиком (несконструированный хвост - slack) и каталог кусков
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void pop_back();
+  void swap(stable_vector &other);
+
+  template <typename... Args>
+  void emplace_back(Args &&...args);
+
+ private:
+  vector<value_type *> chunks_;
+  size_type size_{0U};
+
+  value_type *slot(size_type pos) const;
+  void add_chunk();
+};
+
+template <typename value_type, std::size_t ChunkSize>
+stable_vector<value_type, ChunkSize>::stable_vector(size_type n) {
+  reserve(n);
+  for (size_type i = 0; i < n; ++i) push_back(value_type());
+}
+
+template <typename value_type, std::size_t ChunkSize>
+stable_vector<value_type, ChunkSize>::stable_vector(
+    std::initializer_list<value_type> const &items) {
+  reserve(items.size());
+  for (auto &item : items) push_back(item);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+stable_vector<value_type, ChunkSize>::stable_vector(const stable_vector &v) {
+  reserve(v.size_);
+  for (size_type i = 0; i < v.size_; ++i) push_back(v[i]);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+stable_vector<value_type, ChunkSize>::stable_vector(stable_vector &&v) {
+  swap(v);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+stable_vector<value_type, ChunkSize>::~stable_vector() {
+  clear();
+  for (size_type i = 0; i < chunks_.size(); ++i) {
+    ::operator delete(chunks_[i], std::align_val_t(alignof(value_type)));
+  }
+}
+
+template <typename value_type, std::size_t ChunkSize>
+stable_vector<value_type, ChunkSize>
+    &stable_vector<value_type, ChunkSize>::operator=(const stable_vector &v) {
+  if (this != &v) {
+    clear();
+    reserve(v.size_);
+    for (size_type i = 0; i < v.size_; ++i) push_back(v[i]);
+  }
+  return *this;
+}
+
+template <typename value_type, std::size_t ChunkSize>
+stable_vector<value_type, ChunkSize>
+    &stable_vector<value_type, ChunkSize>::operator=(stable_vector &&v) {
+  if (this != &v) {
+    stable_vector tmp(std::move(v));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::reference
+stable_vector<value_type, ChunkSize>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Out of range");
+  return *slot(pos);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::const_reference
+stable_vector<value_type, ChunkSize>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Out of range");
+  return *slot(pos);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::reference
+stable_vector<value_type, ChunkSize>::operator[](size_type pos) {
+  return *slot(pos);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::const_reference
+stable_vector<value_type, ChunkSize>::operator[](size_type pos) const {
+  return *slot(pos);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::const_reference
+stable_vector<value_type, ChunkSize>::front() const {
+  return *slot(0);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::const_reference
+stable_vector<value_type, ChunkSize>::back() const {
+  return *slot(size_ - 1);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::iterator
+stable_vector<value_type, ChunkSize>::begin() {
+  return iterator(this, 0);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::iterator
+stable_vector<value_type, ChunkSize>::end() {
+  return iterator(this, size_);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::const_iterator
+stable_vector<value_type, ChunkSize>::begin() const {
+  return const_iterator(this, 0);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::const_iterator
+stable_vector<value_type, ChunkSize>::end() const {
+  return const_iterator(this, size_);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+bool stable_vector<value_type, ChunkSize>::empty() const {
+  return size_ == 0;
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::size_type
+stable_vector<value_type, ChunkSize>::size() const {
+  return size_;
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::size_type
+stable_vector<value_type, ChunkSize>::max_size() const {
+  return SIZE_MAX / sizeof(value_type) / 2;
+}
+
+template <typename value_type, std::size_t ChunkSize>
+void stable_vector<value_type, ChunkSize>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("Cannot create vector larger than max_size()");
+  }
+  while (capacity() < size) add_chunk();
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::size_type
+stable_vector<value_type, ChunkSize>::capacity() const {
+  return chunks_.size() << kShift;
+}
+
+template <typename value_type, std::size_t ChunkSize>
+typename stable_vector<value_type, ChunkSize>::size_type
+stable_vector<value_type, ChunkSize>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type, std::size_t ChunkSize>
+MemoryReport stable_vector<value_type, ChunkSize>::memory_report() const {
+  MemoryReport report = memory::array_report<value_type>(size_, capacity());
+  report.headers = chunks_.size() *
+                   memory::heap_overhead(ChunkSize * sizeof(value_type));
+  MemoryReport directory = chunks_.memory_report();
+  directory.pointers = directory.payload;
+  directory.payload = 0;
+  report += directory;
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename value_type, std::size_t ChunkSize>
+void stable_vector<value_type, ChunkSize>::shrink_to_fit() {
+  size_type used = (size_ + kMask) >> kShift;
+  if (used == chunks_.size()) return;
+  for (size_type i = used; i < chunks_.size(); ++i) {
+    ::operator delete(chunks_[i], std::align_val_t(alignof(value_type)));
+  }
+  while (chunks_.size() > used) chunks_.pop_back();
+  chunks_.shrink_to_fit();
+}
+
+// куски остаются за контейнером
+template <typename value_type, std::size_t ChunkSize>
+void stable_vector<value_type, ChunkSize>::clear() {
+  while (size_) pop_back();
+}
+
+template <typename value_type, std::size_t ChunkSize>
+void stable_vector<value_type, ChunkSize>::push_back(const_reference value) {
+  if (size_ == capacity()) add_chunk();
+  ::new (slot(size_)) value_type(value);
+  ++size_;
+}
+
+template <typename value_type, std::size_t ChunkSize>
+void stable_vector<value_type, ChunkSize>::push_back(value_type &&value) {
+  if (size_ == capacity()) add_chunk();
+  ::new (slot(size_)) value_type(std::move(value));
+  ++size_;
+}
+
+template <typename value_type, std::size_t ChunkSize>
+void stable_vector<value_type, ChunkSize>::pop_back() {
+  if (size_ != 0) {
+    --size_;
+    slot(size_)->~value_type();
+  }
+}
+
+template <typename value_type, std::size_t ChunkSize>
+void stable_vector<value_type, ChunkSize>::swap(stable_vector &other) {
+  if (this != &other) {
+    chunks_.swap(other.chunks_);
+    std::swap(size_, other.size_);
+  }
+}
+
+template <typename value_type, std::size_t ChunkSize>
+template <class... Args>
+void stable_vector<value_type, ChunkSize>::emplace_back(Args &&...args) {
+  if ((sizeof...(args)) == 0) push_back(value_type());
+  std::initializer_list<value_type> arg{args...};
+  for (auto &val : arg) push_back(val);
+}
+
+template <typename value_type, std::size_t ChunkSize>
+value_type *stable_vector<value_type, ChunkSize>::slot(size_type pos) const {
+  return chunks_[pos >> kShift] + (pos & kMask);
+}
+
+// каталог растёт как s21::vector, но переезжают только указатели на куски
+template <typename value_type, std::size_t ChunkSize>
+void stable_vector<value_type, ChunkSize>::add_chunk() {
+  void *memory = ::operator new(ChunkSize * sizeof(value_type),
+                                std::align_val_t(alignof(value_type)));
+  try {
+    chunks_.push_back(static_cast<value_type *>(memory));
+  } catch (...) {
+    ::operator delete(memory, std::align_val_t(alignof(value_type)));
+    throw;
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STABLE_VECTOR_H_
@@ -1,36 +1,45 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_STACK_H_
 
-// https://www.cyberforum.ru/cpp-beginners/thread2765490.html
-
 #include <initializer_list>  // для std::initializer_list
+#include <utility>           // для std::move
 
-#include "node_single.h"
+#include "memory_report.h"
+#include "s21_vector.h"
 
 namespace s21 {
-template <typename T>
+// Адаптер над последовательным контейнером, как std::stack: вершина стека -
+// последний элемент Container, которому нужны back, push_back, pop_back,
+// size, empty и swap (для reserve() - ещё и reserve).
+template <typename T, typename Container = s21::vector<T>>
 class stack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = std::size_t;
 
-  typedef s21::node_single<value_type> Node;
-
   stack() {}
   explicit stack(std::initializer_list<value_type> const &items);
+  // готовый контейнер, например pmr::vector на арене
+  explicit stack(container_type &&c);
   stack(const stack &s);
   stack(stack &&s);
-  ~stack();
-  reference operator=(stack &&s);
+  ~stack() {}
+  stack &operator=(stack &&s);
 
   const_reference top() const;
 
   bool empty() const;
   size_type size() const;
+  void reserve(size_type size);
+  // память Container и самого адаптера
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
 
   void push(const_reference value);
+  void push(value_type &&value);
   void pop();
   void swap(stack &other);
 
@@ -38,110 +47,89 @@ class stack {
   void emplace_front(Args &&...args);
 
  private:
-  size_type size_{0U};
-  Node *head_{nullptr};
-
-  void copy(Node *n);
-  void move(stack *s);
-  void remove();
+  container_type c_;
 };
 
-template <typename value_type>
-stack<value_type>::stack(std::initializer_list<value_type> const &items) {
-  for (auto item : items) push(item);
+template <typename value_type, typename Container>
+stack<value_type, Container>::stack(
+    std::initializer_list<value_type> const &items) {
+  for (auto &item : items) push(item);
 }
 
-template <typename value_type>
-stack<value_type>::stack(const stack &s) : size_(0), head_(nullptr) {
-  if (this != &s) copy(s.head_);
-}
+template <typename value_type, typename Container>
+stack<value_type, Container>::stack(container_type &&c) : c_(std::move(c)) {}
 
-template <typename value_type>
-stack<value_type>::stack(stack &&s) {
-  move(&s);
-}
+template <typename value_type, typename Container>
+stack<value_type, Container>::stack(const stack &s) : c_(s.c_) {}
 
-template <typename value_type>
-stack<value_type>::~stack() {
-  remove();
-}
+template <typename value_type, typename Container>
+stack<value_type, Container>::stack(stack &&s) : c_(std::move(s.c_)) {}
 
-template <typename value_type>
-typename stack<value_type>::reference stack<value_type>::operator=(stack &&s) {
-  move(s);
+template <typename value_type, typename Container>
+stack<value_type, Container> &stack<value_type, Container>::operator=(
+    stack &&s) {
+  if (this != &s) c_ = std::move(s.c_);
   return *this;
 }
 
-template <typename value_type>
-typename stack<value_type>::const_reference stack<value_type>::top() const {
-  return head_->value_;
+template <typename value_type, typename Container>
+typename stack<value_type, Container>::const_reference
+stack<value_type, Container>::top() const {
+  return c_.back();
 }
 
-template <typename value_type>
-bool stack<value_type>::empty() const {
-  bool result = false;
-  if (size_ == 0 || head_ == nullptr) result = true;
+template <typename value_type, typename Container>
+bool stack<value_type, Container>::empty() const {
+  return c_.empty();
+}
 
-  return result;
+template <typename value_type, typename Container>
+typename stack<value_type, Container>::size_type
+stack<value_type, Container>::size() const {
+  return c_.size();
 }
 
-template <typename value_type>
-typename stack<value_type>::size_type stack<value_type>::size() const {
-  return size_;
+template <typename value_type, typename Container>
+void stack<value_type, Container>::reserve(size_type size) {
+  c_.reserve(size);
 }
 
-template <typename value_type>
-void stack<value_type>::push(const_reference value) {
-  Node *new_node = new Node(value);
-  new_node->next_ = head_;
-  head_ = new_node;
-  ++size_;
+template <typename value_type, typename Container>
+typename stack<value_type, Container>::size_type
+stack<value_type, Container>::memory_usage() const {
+  return memory_report().total();
 }
 
-template <typename value_type>
-void stack<value_type>::pop() {
-  if (!empty()) {
-    Node *temp = head_;
-    head_ = head_->next_;
-    delete temp;
-    --size_;
-  }
+template <typename value_type, typename Container>
+MemoryReport stack<value_type, Container>::memory_report() const {
+  MemoryReport report = c_.memory_report();
+  report.object = sizeof(*this);
+  return report;
 }
 
-template <typename value_type>
-void stack<value_type>::swap(stack &other) {
-  if (this != &other) {
-    std::swap(other.size_, size_);
-    std::swap(other.head_, head_);
-  }
+template <typename value_type, typename Container>
+void stack<value_type, Container>::push(const_reference value) {
+  c_.push_back(value);
 }
 
-template <typename value_type>
-void stack<value_type>::copy(Node *n) {
-  if (!n) return;
-  copy(n->next_);
-  push(n->value_);
+template <typename value_type, typename Container>
+void stack<value_type, Container>::push(value_type &&value) {
+  c_.push_back(std::move(value));
 }
 
-template <typename value_type>
-void stack<value_type>::move(stack *s) {
-  if (this != s) {
-    remove();
-    size_ = s->size_;
-    head_ = s->head_;
-    s->size_ = 0;
-    s->head_ = nullptr;
-  }
+template <typename value_type, typename Container>
+void stack<value_type, Container>::pop() {
+  if (!empty()) c_.pop_back();
 }
 
-template <typename value_type>
-void stack<value_type>::remove() {
-  while (size_) pop();
+template <typename value_type, typename Container>
+void stack<value_type, Container>::swap(stack &other) {
+  if (this != &other) c_.swap(other.c_);
 }
 
-template <class value_type>
+template <typename value_type, typename Container>
 template <class... Args>
-void stack<value_type>::emplace_front(Args &&...args) {
+void stack<value_type, Container>::emplace_front(Args &&...args) {
   if ((sizeof...(args)) == 0) {
     value_type _empty = {};
     push(_empty);
@@ -0,0 +1,253 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STATIC_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STATIC_MAP_H_
+
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <utility>           // для std::pair, std::swap
+
+#include "eytzinger.h"
+#include "iterator_static.h"
+#include "s21_flat_map.h"
+#include "s21_map.h"
+
+namespace s21 {
+// Неизменяемое отображение в раскладке Эйтцингера: ключи и значения лежат
+// в двух параллельных массивах, поиск идёт только по плотному массиву
+// ключей. Строится из s21::map или из диапазона пар; при повторах ключа
+// остаётся первое вхождение, как у flat_map.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class static_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = std::pair<const key_type &, const mapped_type &>;
+  using const_reference = reference;
+  using iterator = StaticIterator<key_type, mapped_type>;
+  using const_iterator = iterator;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  static_map() {}
+  explicit static_map(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  static_map(InputIt first, InputIt last);
+  explicit static_map(const map<key_type, mapped_type> &m);
+  static_map(const static_map &m);
+  static_map(static_map &&m);
+  ~static_map();
+  static_map &operator=(const static_map &m);
+  static_map &operator=(static_map &&m);
+
+  const mapped_type &at(const key_type &key) const;
+
+  iterator begin() const;
+  iterator end() const;
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void swap(static_map &other);
+
+ private:
+  key_type *keys_{nullptr};
+  mapped_type *values_{nullptr};
+  size_type size_{0U};
+  Compare comp_{};
+
+  void build(const flat_map<key_type, mapped_type, Compare> &sorted);
+  size_type find_index(const key_type &key) const;
+  iterator iterator_at(size_type k) const;
+  void remove();
+};
+
+template <typename Key, typename T, typename Compare>
+static_map<Key, T, Compare>::static_map(
+    std::initializer_list<value_type> const &items)
+    : static_map(items.begin(), items.end()) {}
+
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+static_map<Key, T, Compare>::static_map(InputIt first, InputIt last) {
+  build(flat_map<key_type, mapped_type, Compare>(first, last));
+}
+
+// итератор s21::map разыменовывается только в значение, поэтому ключи
+// берутся из узлов напрямую
+template <typename Key, typename T, typename Compare>
+static_map<Key, T, Compare>::static_map(const map<key_type, mapped_type> &m) {
+  vector<key_type> keys;
+  vector<mapped_type> values;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    keys.push_back(it.ptr_->_key);
+    values.push_back(it.ptr_->_value);
+  }
+  build(flat_map<key_type, mapped_type, Compare>(std::move(keys),
+                                                 std::move(values)));
+}
+
+template <typename Key, typename T, typename Compare>
+static_map<Key, T, Compare>::static_map(const static_map &m)
+    : size_(m.size_), comp_(m.comp_) {
+  keys_ = eytzinger_copy(m.keys_, size_);
+  try {
+    values_ = eytzinger_copy(m.values_, size_);
+  } catch (...) {
+    eytzinger_destroy(keys_, size_);
+    throw;
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+static_map<Key, T, Compare>::static_map(static_map &&m) {
+  swap(m);
+}
+
+template <typename Key, typename T, typename Compare>
+static_map<Key, T, Compare>::~static_map() {
+  remove();
+}
+
+template <typename Key, typename T, typename Compare>
+static_map<Key, T, Compare> &static_map<Key, T, Compare>::operator=(
+    const static_map &m) {
+  if (this != &m) {
+    static_map tmp(m);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+static_map<Key, T, Compare> &static_map<Key, T, Compare>::operator=(
+    static_map &&m) {
+  if (this != &m) {
+    remove();
+    swap(m);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+const T &static_map<Key, T, Compare>::at(const key_type &key) const {
+  size_type k = find_index(key);
+  if (k == 0) throw std::out_of_range("Out of range");
+  return values_[k];
+}
+
+template <typename Key, typename T, typename Compare>
+typename static_map<Key, T, Compare>::iterator
+static_map<Key, T, Compare>::begin() const {
+  return iterator_at(eytzinger_first(size_));
+}
+
+template <typename Key, typename T, typename Compare>
+typename static_map<Key, T, Compare>::iterator
+static_map<Key, T, Compare>::end() const {
+  return iterator_at(0);
+}
+
+template <typename Key, typename T, typename Compare>
+typename static_map<Key, T, Compare>::iterator
+static_map<Key, T, Compare>::find(const key_type &key) const {
+  return iterator_at(find_index(key));
+}
+
+template <typename Key, typename T, typename Compare>
+bool static_map<Key, T, Compare>::contains(const key_type &key) const {
+  return find_index(key) != 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename static_map<Key, T, Compare>::iterator
+static_map<Key, T, Compare>::lower_bound(const key_type &key) const {
+  return iterator_at(eytzinger_lower_bound(keys_, size_, key, comp_));
+}
+
+template <typename Key, typename T, typename Compare>
+typename static_map<Key, T, Compare>::iterator
+static_map<Key, T, Compare>::upper_bound(const key_type &key) const {
+  return iterator_at(eytzinger_upper_bound(keys_, size_, key, comp_));
+}
+
+template <typename Key, typename T, typename Compare>
+bool static_map<Key, T, Compare>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename static_map<Key, T, Compare>::size_type
+static_map<Key, T, Compare>::size() const {
+  return size_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename static_map<Key, T, Compare>::size_type
+static_map<Key, T, Compare>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename Key, typename T, typename Compare>
+MemoryReport static_map<Key, T, Compare>::memory_report() const {
+  MemoryReport report = eytzinger_report<key_type>(size_);
+  report += eytzinger_report<mapped_type>(size_);
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename Key, typename T, typename Compare>
+void static_map<Key, T, Compare>::swap(static_map &other) {
+  std::swap(keys_, other.keys_);
+  std::swap(values_, other.values_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename Key, typename T, typename Compare>
+void static_map<Key, T, Compare>::build(
+    const flat_map<key_type, mapped_type, Compare> &sorted) {
+  size_type n = sorted.size();
+  keys_ = eytzinger_build<key_type>(sorted.keys().data(), n);
+  try {
+    values_ = eytzinger_build<mapped_type>(sorted.values().data(), n);
+  } catch (...) {
+    eytzinger_destroy(keys_, n);
+    keys_ = nullptr;
+    throw;
+  }
+  size_ = n;
+}
+
+template <typename Key, typename T, typename Compare>
+typename static_map<Key, T, Compare>::size_type
+static_map<Key, T, Compare>::find_index(const key_type &key) const {
+  size_type k = eytzinger_lower_bound(keys_, size_, key, comp_);
+  return (k != 0 && !comp_(key, keys_[k])) ? k : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename static_map<Key, T, Compare>::iterator
+static_map<Key, T, Compare>::iterator_at(size_type k) const {
+  return iterator(keys_, values_, size_, k);
+}
+
+template <typename Key, typename T, typename Compare>
+void static_map<Key, T, Compare>::remove() {
+  eytzinger_destroy(keys_, size_);
+  eytzinger_destroy(values_, size_);
+  keys_ = nullptr;
+  values_ = nullptr;
+  size_ = 0;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STATIC_MAP_H_
@@ -0,0 +1,216 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STATIC_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STATIC_SET_H_
+
+#include <algorithm>         // для std::sort, std::unique
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::less
+#include <initializer_list>  // для std::initializer_list
+#include <iterator>          // для std::make_move_iterator
+#include <type_traits>       // для std::is_same
+#include <utility>           // для std::swap
+
+#include "eytzinger.h"
+#include "iterator_static.h"
+#include "s21_set.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Неизменяемое множество в раскладке Эйтцингера для больших справочников,
+// которые пересобираются целиком и только читаются: find/lower_bound -
+// спуск без ветвлений с предвыборкой. Строится из s21::set или из
+// диапазона (неотсортированный диапазон сортируется, дубликаты убираются).
+template <typename Key, typename Compare = std::less<Key>>
+class static_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = StaticIterator<key_type, void>;
+  using const_iterator = iterator;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  static_set() {}
+  explicit static_set(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  static_set(InputIt first, InputIt last);
+  explicit static_set(const set<key_type> &s);
+  static_set(const static_set &s);
+  static_set(static_set &&s);
+  ~static_set();
+  static_set &operator=(const static_set &s);
+  static_set &operator=(static_set &&s);
+
+  iterator begin() const;
+  iterator end() const;
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+  void swap(static_set &other);
+
+ private:
+  key_type *keys_{nullptr};
+  size_type size_{0U};
+  Compare comp_{};
+
+  // переносит keys в раскладку; если они ещё не по comp_ и с дубликатами
+  // (sorted == false), сначала сортирует и убирает повторы
+  void build(vector<key_type> *keys, bool sorted);
+  iterator iterator_at(size_type k) const;
+};
+
+template <typename Key, typename Compare>
+static_set<Key, Compare>::static_set(
+    std::initializer_list<value_type> const &items)
+    : static_set(items.begin(), items.end()) {}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+static_set<Key, Compare>::static_set(InputIt first, InputIt last) {
+  vector<key_type> keys;
+  for (; first != last; ++first) keys.push_back(*first);
+  build(&keys, false);
+}
+
+// s21::set уже упорядочен по std::less и без повторов: с тем же Compare
+// сортировать нечего
+template <typename Key, typename Compare>
+static_set<Key, Compare>::static_set(const set<key_type> &s) {
+  vector<key_type> keys;
+  for (auto it = s.begin(); it != s.end(); ++it) keys.push_back(*it);
+  build(&keys, std::is_same<Compare, std::less<key_type>>::value);
+}
+
+template <typename Key, typename Compare>
+static_set<Key, Compare>::static_set(const static_set &s)
+    : keys_(eytzinger_copy(s.keys_, s.size_)), size_(s.size_), comp_(s.comp_) {}
+
+template <typename Key, typename Compare>
+static_set<Key, Compare>::static_set(static_set &&s) {
+  swap(s);
+}
+
+template <typename Key, typename Compare>
+static_set<Key, Compare>::~static_set() {
+  eytzinger_destroy(keys_, size_);
+}
+
+template <typename Key, typename Compare>
+static_set<Key, Compare> &static_set<Key, Compare>::operator=(
+    const static_set &s) {
+  if (this != &s) {
+    static_set tmp(s);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare>
+static_set<Key, Compare> &static_set<Key, Compare>::operator=(
+    static_set &&s) {
+  if (this != &s) {
+    static_set tmp(std::move(s));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare>
+typename static_set<Key, Compare>::iterator static_set<Key, Compare>::begin()
+    const {
+  return iterator_at(eytzinger_first(size_));
+}
+
+template <typename Key, typename Compare>
+typename static_set<Key, Compare>::iterator static_set<Key, Compare>::end()
+    const {
+  return iterator_at(0);
+}
+
+template <typename Key, typename Compare>
+typename static_set<Key, Compare>::iterator static_set<Key, Compare>::find(
+    const key_type &key) const {
+  size_type k = eytzinger_lower_bound(keys_, size_, key, comp_);
+  return (k != 0 && !comp_(key, keys_[k])) ? iterator_at(k) : end();
+}
+
+template <typename Key, typename Compare>
+bool static_set<Key, Compare>::contains(const key_type &key) const {
+  return find(key) != end();
+}
+
+template <typename Key, typename Compare>
+typename static_set<Key, Compare>::iterator
+static_set<Key, Compare>::lower_bound(const key_type &key) const {
+  return iterator_at(eytzinger_lower_bound(keys_, size_, key, comp_));
+}
+
+template <typename Key, typename Compare>
+typename static_set<Key, Compare>::iterator
+static_set<Key, Compare>::upper_bound(const key_type &key) const {
+  return iterator_at(eytzinger_upper_bound(keys_, size_, key, comp_));
+}
+
+template <typename Key, typename Compare>
+bool static_set<Key, Compare>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename Compare>
+typename static_set<Key, Compare>::size_type static_set<Key, Compare>::size()
+    const {
+  return size_;
+}
+
+template <typename Key, typename Compare>
+typename static_set<Key, Compare>::size_type
+static_set<Key, Compare>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename Key, typename Compare>
+MemoryReport static_set<Key, Compare>::memory_report() const {
+  MemoryReport report = eytzinger_report<key_type>(size_);
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename Key, typename Compare>
+void static_set<Key, Compare>::swap(static_set &other) {
+  std::swap(keys_, other.keys_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename Key, typename Compare>
+void static_set<Key, Compare>::build(vector<key_type> *keys, bool sorted) {
+  key_type *first = keys->data();
+  key_type *last = first + keys->size();
+  if (!sorted) {
+    std::sort(first, last, comp_);
+    last = std::unique(first, last, [&](const key_type &a, const key_type &b) {
+      return !comp_(a, b) && !comp_(b, a);
+    });
+  }
+  size_type n = static_cast<size_type>(last - first);
+  keys_ = eytzinger_build<key_type>(std::make_move_iterator(first), n);
+  size_ = n;
+}
+
+template <typename Key, typename Compare>
+typename static_set<Key, Compare>::iterator
+static_set<Key, Compare>::iterator_at(size_type k) const {
+  return iterator(keys_, size_, k);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STATIC_SET_H_
@@ -0,0 +1,130 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_THREAD_POOL_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_THREAD_POOL_H_
+
+#include <atomic>      // для std::atomic
+#include <chrono>      // для std::chrono::microseconds
+#include <cstddef>     // для std::size_t
+#include <functional>  // для std::function
+#include <memory>      // для std::unique_ptr
+#include <thread>      // для std::thread
+#include <vector>      // для std::vector
+
+#include "s21_mpmc_queue.h"
+#include "s21_ws_deque.h"
+
+namespace s21 {
+// Небольшой пул потоков для fork-join на s21::ws_deque: у каждого рабочего
+// свой дек, внешние задачи приходят через общую очередь inbox_, а простаивающий
+// рабочий крадёт задачи у соседей.
+class thread_pool {
+ public:
+  using size_type = std::size_t;
+
+  explicit thread_pool(size_type threads = std::thread::hardware_concurrency());
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+  ~thread_pool();
+
+  size_type size() const;
+
+  // вызывает body(first, last) на непересекающихся поддиапазонах
+  // [first, last) длиной не больше grain и ждёт завершения всех вызовов
+  void parallel_for(size_type first, size_type last, size_type grain,
+                    const std::function<void(size_type, size_type)> &body);
+
+ private:
+  static constexpr int kIdleSpins = 64;
+
+  struct Job {
+    const std::function<void(size_type, size_type)> *body_;
+    size_type grain_;
+    std::atomic<size_type> remaining_;
+  };
+
+  struct Task {
+    Job *job_;
+    size_type first_;
+    size_type last_;
+  };
+
+  std::vector<std::unique_ptr<ws_deque<Task *>>> deques_;
+  std::vector<std::thread> workers_;
+  mpmc_queue<Task *> inbox_;
+  std::atomic<bool> stop_{false};
+
+  void run(size_type index);
+  bool find_task(size_type index, Task **task);
+  void execute(size_type index, Task *task);
+};
+
+inline thread_pool::thread_pool(size_type threads) : inbox_(64) {
+  if (threads == 0) threads = 1;
+  for (size_type i = 0; i < threads; ++i) {
+    deques_.emplace_back(new ws_deque<Task *>());
+  }
+  for (size_type i = 0; i < threads; ++i) {
+    workers_.emplace_back(&thread_pool::run, this, i);
+  }
+}
+
+inline thread_pool::~thread_pool() {
+  stop_.store(true, std::memory_order_release);
+  for (auto &worker : workers_) worker.join();
+}
+
+inline thread_pool::size_type thread_pool::size() const {
+  return workers_.size();
+}
+
+inline void thread_pool::parallel_for(
+    size_type first, size_type last, size_type grain,
+    const std::function<void(size_type, size_type)> &body) {
+  if (first >= last) return;
+  Job job{&body, grain ? grain : 1, {last - first}};
+  inbox_.push(new Task{&job, first, last});
+  while (job.remaining_.load(std::memory_order_acquire) != 0) {
+    std::this_thread::yield();
+  }
+}
+
+inline bool thread_pool::find_task(size_type index, Task **task) {
+  if (deques_[index]->pop(*task) || inbox_.try_pop(*task)) return true;
+  for (size_type i = 1; i < deques_.size(); ++i) {
+    if (deques_[(index + i) % deques_.size()]->steal(*task)) return true;
+  }
+  return false;
+}
+
+// делит диапазон пополам, пока он больше grain: правая половина уходит в
+// свой дек (её могут украсть), левая обрабатывается дальше
+inline void thread_pool::execute(size_type index, Task *task) {
+  Job *job = task->job_;
+  while (task->last_ - task->first_ > job->grain_) {
+    size_type middle = task->first_ + (task->last_ - task->first_) / 2;
+    deques_[index]->push(new Task{job, middle, task->last_});
+    task->last_ = middle;
+  }
+  (*job->body_)(task->first_, task->last_);
+  size_type done = task->last_ - task->first_;
+  delete task;
+  job->remaining_.fetch_sub(done, std::memory_order_acq_rel);
+}
+
+inline void thread_pool::run(size_type index) {
+  int idle = 0;
+  Task *task = nullptr;
+  while (!stop_.load(std::memory_order_acquire)) {
+    if (find_task(index, &task)) {
+      execute(index, task);
+      idle = 0;
+    } else if (++idle < kIdleSpins) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_THREAD_POOL_H_
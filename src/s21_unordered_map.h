@@ -0,0 +1,243 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_MAP_H_
+
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::hash, std::equal_to
+#include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <tuple>             // для std::forward_as_tuple
+#include <utility>           // для std::pair
+
+#include "HashTable.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Неупорядоченное отображение на хеш-таблице с открытой адресацией. Интерфейс
+// повторяет s21::map, так что их можно менять местами typedef'ом; итератор
+// указывает на пару (ключ, значение), как у std::unordered_map. Если Hash и
+// KeyEqual прозрачны, find/contains/at/erase принимают любой сравнимый с
+// ключом тип без построения key_type.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map
+    : HashTable<Key, std::pair<const Key, T>, HashPairKey, Hash, KeyEqual> {
+  using Base =
+      HashTable<Key, std::pair<const Key, T>, HashPairKey, Hash, KeyEqual>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::const_iterator;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  template <typename K>
+  using key_arg =
+      typename HashKeyArg<Base::kTransparent>::template type<K, key_type>;
+
+  unordered_map() {}
+  explicit unordered_map(std::initializer_list<value_type> const &items);
+  unordered_map(const unordered_map &m);
+  unordered_map(unordered_map &&m);
+  ~unordered_map() {}
+  unordered_map &operator=(const unordered_map &m);
+  unordered_map &operator=(unordered_map &&m);
+
+  template <typename K = key_type>
+  mapped_type &at(const key_arg<K> &key);
+  template <typename K = key_type>
+  const mapped_type &at(const key_arg<K> &key) const;
+  mapped_type &operator[](const key_type &key);
+
+  using Base::begin;
+  using Base::end;
+
+  using Base::empty;
+  using Base::max_size;
+  using Base::size;
+
+  using Base::bucket_count;
+  using Base::load_factor;
+  using Base::max_load_factor;
+  using Base::rehash;
+  using Base::reserve;
+
+  using Base::memory_report;
+  using Base::memory_usage;
+
+  using Base::clear;
+  std::pair<iterator, bool> insert(const_reference value);
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+  void erase(iterator pos);
+  template <typename K = key_type>
+  size_type erase(const key_arg<K> &key);
+  void swap(unordered_map &other);
+  void merge(unordered_map &other);
+
+  template <typename K = key_type>
+  bool contains(const key_arg<K> &key) const;
+  template <typename K = key_type>
+  iterator find(const key_arg<K> &key);
+  template <typename K = key_type>
+  const_iterator find(const key_arg<K> &key) const;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual>::unordered_map(
+    std::initializer_list<value_type> const &items) {
+  reserve(items.size());
+  for (auto &item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual>::unordered_map(const unordered_map &m)
+    : Base(m) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual>::unordered_map(unordered_map &&m)
+    : Base(std::move(m)) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual>
+    &unordered_map<Key, T, Hash, KeyEqual>::operator=(const unordered_map &m) {
+  Base::operator=(m);
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual>
+    &unordered_map<Key, T, Hash, KeyEqual>::operator=(unordered_map &&m) {
+  Base::operator=(std::move(m));
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K>
+T &unordered_map<Key, T, Hash, KeyEqual>::at(const key_arg<K> &key) {
+  size_type index = this->find_index(key);
+  if (index == bucket_count()) throw std::out_of_range("Out of range");
+  return this->slots_[index].second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K>
+const T &unordered_map<Key, T, Hash, KeyEqual>::at(
+    const key_arg<K> &key) const {
+  size_type index = this->find_index(key);
+  if (index == bucket_count()) throw std::out_of_range("Out of range");
+  return this->slots_[index].second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T &unordered_map<Key, T, Hash, KeyEqual>::operator[](const key_type &key) {
+  size_type index =
+      this->emplace_key(key, std::piecewise_construct,
+                        std::forward_as_tuple(key), std::forward_as_tuple())
+          .first;
+  return this->slots_[index].second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::insert(const_reference value) {
+  auto result = this->emplace_key(value.first, value);
+  return {this->iterator_at(result.first), result.second};
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::insert(const key_type &key,
+                                              const mapped_type &obj) {
+  auto result = this->emplace_key(key, key, obj);
+  return {this->iterator_at(result.first), result.second};
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::insert_or_assign(
+    const key_type &key, const mapped_type &obj) {
+  auto result = this->emplace_key(key, key, obj);
+  if (!result.second) this->slots_[result.first].second = obj;
+  return {this->iterator_at(result.first), result.second};
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void unordered_map<Key, T, Hash, KeyEqual>::erase(iterator pos) {
+  if (pos != end()) this->erase_index(this->index_of(pos));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K>
+typename unordered_map<Key, T, Hash, KeyEqual>::size_type
+unordered_map<Key, T, Hash, KeyEqual>::erase(const key_arg<K> &key) {
+  size_type index = this->find_index(key);
+  if (index == bucket_count()) return 0;
+  this->erase_index(index);
+  return 1;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void unordered_map<Key, T, Hash, KeyEqual>::swap(unordered_map &other) {
+  Base::swap(other);
+}
+
+// Переносит из other элементы с отсутствующими здесь ключами; остальные
+// остаются в other, как у s21::map::merge.
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void unordered_map<Key, T, Hash, KeyEqual>::merge(unordered_map &other) {
+  if (this == &other) return;
+  for (size_type i = 0; i < other.bucket_count(); ++i) {
+    if (other.ctrl_[i] < 0) continue;
+    value_type &item = other.slots_[i];
+    if (this->emplace_key(item.first, std::move(item)).second) {
+      other.erase_index(i);
+    }
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K>
+bool unordered_map<Key, T, Hash, KeyEqual>::contains(
+    const key_arg<K> &key) const {
+  return this->find_index(key) != bucket_count();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K>
+typename unordered_map<Key, T, Hash, KeyEqual>::iterator
+unordered_map<Key, T, Hash, KeyEqual>::find(const key_arg<K> &key) {
+  return this->iterator_at(this->find_index(key));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K>
+typename unordered_map<Key, T, Hash, KeyEqual>::const_iterator
+unordered_map<Key, T, Hash, KeyEqual>::find(const key_arg<K> &key) const {
+  return this->iterator_at(this->find_index(key));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <class... Args>
+vector<std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator,
+                 bool>>
+unordered_map<Key, T, Hash, KeyEqual>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  reserve(size() + arg.size());  // итераторы в result не должны устареть
+  for (auto &val : arg) result.push_back(insert(val));
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_MAP_H_
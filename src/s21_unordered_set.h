@@ -0,0 +1,182 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_H_
+
+#include <cstddef>           // для std::size_t
+#include <functional>        // для std::hash, std::equal_to
+#include <initializer_list>  // для std::initializer_list
+#include <utility>           // для std::pair
+
+#include "HashTable.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Неупорядоченное множество на хеш-таблице с открытой адресацией, с тем же
+// интерфейсом, что у s21::set. Элементы менять через итератор нельзя: от
+// них зависит положение в таблице.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_set : HashTable<Key, Key, HashSelfKey, Hash, KeyEqual> {
+  using Base = HashTable<Key, Key, HashSelfKey, Hash, KeyEqual>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Base::const_iterator;
+  using const_iterator = typename Base::const_iterator;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  template <typename K>
+  using key_arg =
+      typename HashKeyArg<Base::kTransparent>::template type<K, key_type>;
+
+  unordered_set() {}
+  explicit unordered_set(std::initializer_list<value_type> const &items);
+  unordered_set(const unordered_set &s);
+  unordered_set(unordered_set &&s);
+  ~unordered_set() {}
+  unordered_set &operator=(const unordered_set &s);
+  unordered_set &operator=(unordered_set &&s);
+
+  iterator begin() const;
+  iterator end() const;
+  template <typename K = key_type>
+  iterator find(const key_arg<K> &key) const;
+  template <typename K = key_type>
+  bool contains(const key_arg<K> &key) const;
+
+  using Base::empty;
+  using Base::max_size;
+  using Base::size;
+
+  using Base::bucket_count;
+  using Base::load_factor;
+  using Base::max_load_factor;
+  using Base::rehash;
+  using Base::reserve;
+
+  using Base::memory_report;
+  using Base::memory_usage;
+
+  using Base::clear;
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  template <typename K = key_type>
+  size_type erase(const key_arg<K> &key);
+  void swap(unordered_set &other);
+  void merge(unordered_set &other);
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> emplace(Args &&...args);
+};
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(
+    std::initializer_list<value_type> const &items) {
+  reserve(items.size());
+  for (auto &item : items) insert(item);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(const unordered_set &s)
+    : Base(s) {}
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(unordered_set &&s)
+    : Base(std::move(s)) {}
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual> &unordered_set<Key, Hash, KeyEqual>::
+operator=(const unordered_set &s) {
+  Base::operator=(s);
+  return *this;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual> &unordered_set<Key, Hash, KeyEqual>::
+operator=(unordered_set &&s) {
+  Base::operator=(std::move(s));
+  return *this;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::iterator
+unordered_set<Key, Hash, KeyEqual>::begin() const {
+  return Base::begin();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::iterator
+unordered_set<Key, Hash, KeyEqual>::end() const {
+  return Base::end();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename K>
+typename unordered_set<Key, Hash, KeyEqual>::iterator
+unordered_set<Key, Hash, KeyEqual>::find(const key_arg<K> &key) const {
+  return this->iterator_at(this->find_index(key));
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename K>
+bool unordered_set<Key, Hash, KeyEqual>::contains(
+    const key_arg<K> &key) const {
+  return this->find_index(key) != bucket_count();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>
+unordered_set<Key, Hash, KeyEqual>::insert(const value_type &value) {
+  auto result = this->emplace_key(value, value);
+  return {this->iterator_at(result.first), result.second};
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void unordered_set<Key, Hash, KeyEqual>::erase(iterator pos) {
+  if (pos != end()) this->erase_index(this->index_of(pos));
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename K>
+typename unordered_set<Key, Hash, KeyEqual>::size_type
+unordered_set<Key, Hash, KeyEqual>::erase(const key_arg<K> &key) {
+  size_type index = this->find_index(key);
+  if (index == bucket_count()) return 0;
+  this->erase_index(index);
+  return 1;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void unordered_set<Key, Hash, KeyEqual>::swap(unordered_set &other) {
+  Base::swap(other);
+}
+
+// элементы, которые уже есть в этом множестве, остаются в other
+template <typename Key, typename Hash, typename KeyEqual>
+void unordered_set<Key, Hash, KeyEqual>::merge(unordered_set &other) {
+  if (this == &other) return;
+  for (size_type i = 0; i < other.bucket_count(); ++i) {
+    if (other.ctrl_[i] < 0) continue;
+    value_type &item = other.slots_[i];
+    if (this->emplace_key(item, std::move(item)).second) other.erase_index(i);
+  }
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <class... Args>
+vector<std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>>
+unordered_set<Key, Hash, KeyEqual>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result;
+  std::initializer_list<value_type> arg{args...};
+  reserve(size() + arg.size());  // итераторы в result не должны устареть
+  for (auto &val : arg) result.push_back(insert(val));
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_H_
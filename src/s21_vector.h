@@ -3,10 +3,19 @@
 
 #include <cstring>           // для std::memcpy
 #include <initializer_list>  // для std::initializer_list
+#include <stdexcept>         // для исключений
+#include <type_traits>       // для std::is_trivially_copyable
+#include <utility>           // для std::move, std::swap
+
+#include "instrument.h"
+#include "memory_report.h"
+#include "memory_source.h"
 
 namespace s21 {
-template <typename T>
-class vector {
+// Source - откуда берётся память под массив (см. memory_source.h); пустой
+// HeapSource по умолчанию не увеличивает размер вектора
+template <typename T, typename Source = HeapSource>
+class vector : private TrackedSource<Tracked::kVector, Source> {
  public:
   using value_type = T;
   using reference = value_type &;
@@ -21,7 +30,7 @@ class vector {
   vector(const vector &v);
   vector(vector &&v);
   ~vector();
-  reference operator=(vector &&v);
+  vector &operator=(vector &&v);
 
   reference at(size_type pos);
   reference operator[](size_type pos) const;
@@ -38,11 +47,16 @@ class vector {
   void reserve(size_type size);
   size_type capacity() const;
   void shrink_to_fit();
+  // память по статьям и её сумма; заголовки блоков оцениваются только
+  // для памяти из кучи, не из pmr-ресурса
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
 
   void clear();
   iterator insert(iterator pos, const_reference value);  //
   void erase(iterator pos);
-  void push_back(value_type value);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back();
   void swap(vector &other);
 
@@ -51,6 +65,15 @@ class vector {
   template <typename... Args>
   void emplace_back(Args &&...args);
 
+ protected:
+  using Memory = TrackedSource<Tracked::kVector, Source>;
+
+  // для pmr::vector: память из ресурса
+  explicit vector(const Source &memory) : Memory(memory) {}
+
+  Memory &memory() { return *this; }
+  const Memory &memory() const { return *this; }
+
  private:
   size_type size_{0U};
   size_type capacity_{0U};
@@ -60,21 +83,25 @@ class vector {
   void move(vector *v);
   void remove();
   void allocate(size_type size);
+
+  static void copy_elements(iterator dst, const_iterator src, size_type n);
+  static void move_elements(iterator dst, iterator src, size_type n);
 };
 
-template <typename value_type>
-vector<value_type>::vector(size_type n) : size_(n), capacity_(n) {
+template <typename value_type, typename Source>
+vector<value_type, Source>::vector(size_type n) : size_(n), capacity_(n) {
   if (n > max_size())
     throw std::length_error("Cannot create vector larger than max_size()");
 
-  data_ = (n) ? new value_type[n] : nullptr;
+  data_ = (n) ? memory().template create_array<value_type>(n) : nullptr;
 }
 
-template <typename value_type>
-vector<value_type>::vector(std::initializer_list<value_type> const &items) {
+template <typename value_type, typename Source>
+vector<value_type, Source>::vector(
+    std::initializer_list<value_type> const &items) {
   size_ = items.size();
 
-  data_ = (size_) ? new value_type[size_] : nullptr;
+  data_ = (size_) ? memory().template create_array<value_type>(size_) : nullptr;
 
   if (data_) {
     for (auto &i : items) {
@@ -84,175 +111,214 @@ vector<value_type>::vector(std::initializer_list<value_type> const &items) {
   }
 }
 
-template <typename value_type>
-vector<value_type>::vector(const vector &v)
-    : size_(v.size_), capacity_(v.capacity_) {
+template <typename value_type, typename Source>
+vector<value_type, Source>::vector(const vector &v)
+    : Memory(), size_(v.size_), capacity_(v.size_) {
   copy(v);
 }
 
-template <typename value_type>
-vector<value_type>::vector(vector &&v) {
+template <typename value_type, typename Source>
+vector<value_type, Source>::vector(vector &&v) {
   move(&v);
 }
 
-template <typename value_type>
-vector<value_type>::~vector() {
-  remove();
+template <typename value_type, typename Source>
+vector<value_type, Source>::~vector() {
+  if (!memory().skip_destroy()) remove();
 }
 
-template <typename value_type>
-typename vector<value_type>::reference vector<value_type>::operator=(
-    vector &&v) {
-  move(v);
+template <typename value_type, typename Source>
+vector<value_type, Source> &vector<value_type, Source>::operator=(vector &&v) {
+  move(&v);
   return *this;
 }
 
-template <typename value_type>
-typename vector<value_type>::reference vector<value_type>::at(size_type pos) {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::reference
+vector<value_type, Source>::at(size_type pos) {
   if (pos >= size_) throw std::out_of_range("Out of range");
 
   return data_[pos];
 }
 
-template <typename value_type>
-typename vector<value_type>::reference vector<value_type>::operator[](
-    const size_type index) const {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::reference
+vector<value_type, Source>::operator[](const size_type index) const {
   return data_[index];
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::front() const {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::const_reference
+vector<value_type, Source>::front() const {
   return data_[0];
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::back() const {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::const_reference
+vector<value_type, Source>::back() const {
   return data_[size_ - 1];
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::data() const {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::iterator
+vector<value_type, Source>::data() const {
   return data_;
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::begin() {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::iterator
+vector<value_type, Source>::begin() {
   return &data_[0];
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::end() {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::iterator
+vector<value_type, Source>::end() {
   return &data_[size_];
 }
 
-template <typename value_type>
-bool vector<value_type>::empty() const {
+template <typename value_type, typename Source>
+bool vector<value_type, Source>::empty() const {
   return (size_ == 0 || data_ == nullptr) ? true : false;
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::size() const {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::size_type
+vector<value_type, Source>::size() const {
   return size_;
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::max_size() const {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::size_type
+vector<value_type, Source>::max_size() const {
   return SIZE_MAX / (sizeof(value_type) * 2);
 }
 
-template <typename value_type>
-void vector<value_type>::reserve(size_type size) {
+template <typename value_type, typename Source>
+void vector<value_type, Source>::reserve(size_type size) {
   if (size > capacity_) allocate(size);
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::capacity() const {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::size_type
+vector<value_type, Source>::capacity() const {
   return capacity_;
 }
 
-template <typename value_type>
-void vector<value_type>::shrink_to_fit() {
+template <typename value_type, typename Source>
+void vector<value_type, Source>::shrink_to_fit() {
   if (size_ < capacity_) allocate(size_);
 }
 
-template <typename value_type>
-void vector<value_type>::clear() {
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::size_type
+vector<value_type, Source>::memory_usage() const {
+  return memory_report().total();
+}
+
+template <typename value_type, typename Source>
+MemoryReport vector<value_type, Source>::memory_report() const {
+  MemoryReport report = memory::array_report<value_type>(size_, capacity_);
+  if constexpr (Source::kFromHeap) {
+    report.headers = memory::array_overhead<value_type>(capacity_);
+  }
+  report.object = sizeof(*this);
+  return report;
+}
+
+template <typename value_type, typename Source>
+void vector<value_type, Source>::clear() {
   while (size_) pop_back();
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::insert(
-    iterator pos, const_reference value) {
-  size_type index = 0;
-  if (empty()) {
-    reserve(1);
+// Элементы за pos сдвигаются перемещением, а не копированием; value
+// копируется заранее, потому что может ссылаться на элемент этого вектора.
+template <typename value_type, typename Source>
+typename vector<value_type, Source>::iterator
+vector<value_type, Source>::insert(iterator pos, const_reference value) {
+  size_type index = static_cast<size_type>(pos - data_);
+  if (index >= size_) {
     push_back(value);
   } else {
-    value_type last = back();
-    while (&data_[index] != pos) {
-      ++index;
-    }
-    if (pos != end()) {
-      for (iterator it = end() - 1; it != pos; --it) {
-        *it = *(it - 1);
-      }
-      *pos = value;
-      push_back(last);
-    } else {
-      push_back(value);
+    value_type copy = value;
+    push_back(std::move(data_[size_ - 1]));
+    for (size_type i = size_ - 2; i > index; --i) {
+      data_[i] = std::move(data_[i - 1]);
     }
+    data_[index] = std::move(copy);
   }
   return &data_[index];
 }
 
-template <typename value_type>
-void vector<value_type>::erase(iterator pos) {
+template <typename value_type, typename Source>
+void vector<value_type, Source>::erase(iterator pos) {
   if (size_ != 0) {
     for (; pos + 1 != end(); pos += 1) {
-      *pos = *(pos + 1);
+      *pos = std::move(*(pos + 1));
     }
 
     size_ -= 1;
   }
 }
 
-template <typename value_type>
-void vector<value_type>::push_back(value_type value) {
-  if (empty()) reserve(1);
-  if (size_ == capacity_) allocate(capacity_ * 2);
+// При переезде value сначала забирается во временный объект: он может
+// ссылаться на элемент этого же вектора (так делает insert).
+template <typename value_type, typename Source>
+void vector<value_type, Source>::push_back(const_reference value) {
+  if (size_ == capacity_) {
+    value_type copy = value;
+    allocate(capacity_ ? capacity_ * 2 : 1);
+    data_[size_++] = std::move(copy);
+  } else {
+    data_[size_++] = value;
+  }
+}
 
-  data_[size_++] = value;
+template <typename value_type, typename Source>
+void vector<value_type, Source>::push_back(value_type &&value) {
+  if (size_ == capacity_) {
+    value_type moved = std::move(value);
+    allocate(capacity_ ? capacity_ * 2 : 1);
+    data_[size_++] = std::move(moved);
+  } else {
+    data_[size_++] = std::move(value);
+  }
 }
 
-template <typename value_type>
-void vector<value_type>::pop_back() {
+// освободившийся слот сбрасывается, как в queue::pop: иначе снятый
+// элемент (и то, чем он владеет) жил бы до перезаписи или удаления вектора
+template <typename value_type, typename Source>
+void vector<value_type, Source>::pop_back() {
   if (!empty()) {
-    --size_;
+    data_[--size_] = value_type();
   }
 }
 
-template <typename value_type>
-void vector<value_type>::swap(vector &other) {
+template <typename value_type, typename Source>
+void vector<value_type, Source>::swap(vector &other) {
   if (this != &other) {
     std::swap(other.size_, size_);
     std::swap(other.capacity_, capacity_);
     std::swap(other.data_, data_);
+    std::swap(other.memory(), memory());
   }
 }
 
-template <typename value_type>
-void vector<value_type>::copy(const vector &v) {
+template <typename value_type, typename Source>
+void vector<value_type, Source>::copy(const vector &v) {
   if (this != &v) {
-    data_ = (size_) ? new value_type[size_] : nullptr;
+    data_ =
+        (size_) ? memory().template create_array<value_type>(size_) : nullptr;
 
-    if (data_) std::memcpy(data_, v.data_, v.size_ * sizeof(value_type));
+    if (data_) copy_elements(data_, v.data_, v.size_);
   }
 }
 
-template <typename value_type>
-void vector<value_type>::move(vector *v) {
+template <typename value_type, typename Source>
+void vector<value_type, Source>::move(vector *v) {
   if (this != v) {
     remove();
+    memory() = v->memory();
     data_ = v->data_;
     capacity_ = v->capacity_;
     size_ = v->size_;
@@ -261,17 +327,17 @@ void vector<value_type>::move(vector *v) {
   }
 }
 
-template <typename value_type>
-void vector<value_type>::remove() {
+template <typename value_type, typename Source>
+void vector<value_type, Source>::remove() {
   if (data_ != nullptr) {
-    delete[] data_;
+    memory().destroy_array(data_, capacity_);
     data_ = nullptr;
     capacity_ = size_ = 0;
   }
 }
 
-template <typename value_type>
-void vector<value_type>::allocate(size_type size) {
+template <typename value_type, typename Source>
+void vector<value_type, Source>::allocate(size_type size) {
   if (size > max_size())
     throw std::length_error("Cannot create vector larger than max_size()");
 
@@ -280,28 +346,48 @@ void vector<value_type>::allocate(size_type size) {
   } else {
     size_type size_temp = (size_ > size) ? size : size_;
 
-    iterator data_temp = nullptr;
+    iterator data = memory().template create_array<value_type>(size);
 
     if (data_ != nullptr) {
-      data_temp = new value_type[size_temp];
-      std::memcpy(data_temp, data_, size_temp * sizeof(value_type));
-      delete[] data_;
+      S21_RECORD(Tracked::kVector, Counter::kReallocations, 1);
+      S21_RECORD(Tracked::kVector, Counter::kRelocatedBytes,
+                 size_temp * sizeof(value_type));
+      move_elements(data, data_, size_temp);
+      memory().destroy_array(data_, capacity_);
     }
 
-    data_ = new value_type[size];
+    data_ = data;
+    size_ = size_temp;
+    capacity_ = size;
+  }
+}
 
-    if (data_temp != nullptr) {
-      std::memcpy(data_, data_temp, size_temp * sizeof(value_type));
-      delete[] data_temp;
-    }
+// тривиально копируемые типы переносятся одним memcpy, остальные -
+// поэлементно, чтобы не дублировать владеющие указатели
+template <typename value_type, typename Source>
+void vector<value_type, Source>::copy_elements(iterator dst,
+                                               const_iterator src,
+                                               size_type n) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    std::memcpy(dst, src, n * sizeof(value_type));
+  } else {
+    for (size_type i = 0; i < n; ++i) dst[i] = src[i];
+  }
+}
 
-    capacity_ = size;
+template <typename value_type, typename Source>
+void vector<value_type, Source>::move_elements(iterator dst, iterator src,
+                                               size_type n) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    std::memcpy(dst, src, n * sizeof(value_type));
+  } else {
+    for (size_type i = 0; i < n; ++i) dst[i] = std::move(src[i]);
   }
 }
 
-template <class value_type>
+template <class value_type, class Source>
 template <class... Args>
-void vector<value_type>::emplace_back(Args &&...args) {
+void vector<value_type, Source>::emplace_back(Args &&...args) {
   if ((sizeof...(args)) == 0) {
     value_type _empty = {};
     push_back(_empty);
@@ -317,10 +403,10 @@ void vector<value_type>::emplace_back(Args &&...args) {
   }
 }
 
-template <class value_type>
+template <class value_type, class Source>
 template <class... Args>
-typename vector<value_type>::iterator vector<value_type>::emplace(
-    const_iterator pos, Args &&...args) {
+typename vector<value_type, Source>::iterator
+vector<value_type, Source>::emplace(const_iterator pos, Args &&...args) {
   iterator it = iterator(pos);
   if ((sizeof...(args)) == 0) {
     value_type _empty = {};
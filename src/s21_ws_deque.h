@@ -0,0 +1,210 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_WS_DEQUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_WS_DEQUE_H_
+
+#include <atomic>       // для std::atomic
+#include <cstddef>      // для std::size_t
+#include <cstdint>      // для std::int64_t
+#include <stdexcept>    // для исключений
+#include <type_traits>  // для std::is_trivially_copyable
+
+#include "memory_report.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Дек Чейза-Лева для планировщиков с кражей работы (порядок памяти по
+// Lê, Pop, Cohen, Zappa Nardelli, 2013). Владелец кладёт и забирает
+// элементы с нижнего конца (bottom_), другие потоки крадут с верхнего (top_).
+// Элементы хранятся в атомарных ячейках кольцевого массива, поэтому T должен
+// быть тривиально копируемым (обычно это указатель на задачу). При росте
+// старые массивы не освобождаются до разрушения дека: вор мог успеть
+// прочитать указатель на них.
+template <typename T>
+class ws_deque {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  static_assert(std::is_trivially_copyable<value_type>::value,
+                "ws_deque requires a trivially copyable value_type");
+
+  explicit ws_deque(size_type capacity = 32U);
+  ws_deque(const ws_deque &) = delete;
+  ws_deque &operator=(const ws_deque &) = delete;
+  ~ws_deque();
+
+  // только для потока-владельца
+  void push(const_reference value);
+  bool pop(reference value);
+
+  // для любого потока
+  bool steal(reference value);
+
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+  // только для владельца: retired_ меняет push(). Старые массивы, которые
+  // ещё могут читать воры, - статья slack
+  size_type memory_usage() const;
+  MemoryReport memory_report() const;
+
+ private:
+  static constexpr size_type kCacheLine = 64U;
+
+  struct Array {
+    std::int64_t mask_;
+    std::atomic<value_type> *cells_;
+
+    explicit Array(std::int64_t capacity)
+        : mask_(capacity - 1), cells_(new std::atomic<value_type>[capacity]) {}
+    ~Array() { delete[] cells_; }
+
+    value_type get(std::int64_t i) const {
+      return cells_[i & mask_].load(std::memory_order_relaxed);
+    }
+    void put(std::int64_t i, const_reference value) {
+      cells_[i & mask_].store(value, std::memory_order_relaxed);
+    }
+  };
+
+  alignas(kCacheLine) std::atomic<std::int64_t> top_{0};
+  alignas(kCacheLine) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<Array *> array_{nullptr};
+  s21::vector<Array *> retired_;
+
+  Array *grow(Array *array, std::int64_t bottom, std::int64_t top);
+};
+
+template <typename value_type>
+ws_deque<value_type>::ws_deque(size_type capacity) {
+  if (capacity == 0) throw std::invalid_argument("capacity must be positive");
+  size_type size = 1;
+  while (size < capacity) size <<= 1;
+  array_.store(new Array(static_cast<std::int64_t>(size)),
+               std::memory_order_relaxed);
+}
+
+template <typename value_type>
+ws_deque<value_type>::~ws_deque() {
+  delete array_.load(std::memory_order_relaxed);
+  for (size_type i = 0; i < retired_.size(); ++i) delete retired_[i];
+}
+
+template <typename value_type>
+typename ws_deque<value_type>::Array *ws_deque<value_type>::grow(
+    Array *array, std::int64_t bottom, std::int64_t top) {
+  Array *bigger = new Array((array->mask_ + 1) * 2);
+  for (std::int64_t i = top; i < bottom; ++i) bigger->put(i, array->get(i));
+  retired_.push_back(array);
+  array_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+
+template <typename value_type>
+void ws_deque<value_type>::push(const_reference value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  Array *array = array_.load(std::memory_order_relaxed);
+  if (bottom - top > array->mask_) array = grow(array, bottom, top);
+  array->put(bottom, value);
+  std::atomic_thread_fence(std::memory_order_release);
+  bottom_.store(bottom + 1, std::memory_order_relaxed);
+}
+
+template <typename value_type>
+bool ws_deque<value_type>::pop(reference value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Array *array = array_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t top = top_.load(std::memory_order_relaxed);
+
+  bool result = true;
+  if (top <= bottom) {
+    value = array->get(bottom);
+    if (top == bottom) {
+      // последний элемент: соревнуемся с ворами за top_
+      result = top_.compare_exchange_strong(top, top + 1,
+                                            std::memory_order_seq_cst,
+                                            std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+  } else {
+    result = false;
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return result;
+}
+
+template <typename value_type>
+bool ws_deque<value_type>::steal(reference value) {
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+  bool result = false;
+  if (top < bottom) {
+    Array *array = array_.load(std::memory_order_acquire);
+    value_type stolen = array->get(top);
+    if (top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed)) {
+      value = stolen;
+      result = true;
+    }
+  }
+  return result;
+}
+
+template <typename value_type>
+bool ws_deque<value_type>::empty() const {
+  return size() == 0;
+}
+
+// из другого потока значение приблизительное
+template <typename value_type>
+typename ws_deque<value_type>::size_type ws_deque<value_type>::size() const {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::int64_t top = top_.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_type>(bottom - top) : 0U;
+}
+
+template <typename value_type>
+typename ws_deque<value_type>::size_type ws_deque<value_type>::capacity()
+    const {
+  return static_cast<size_type>(
+      array_.load(std::memory_order_relaxed)->mask_ + 1);
+}
+
+template <typename value_type>
+typename ws_deque<value_type>::size_type ws_deque<value_type>::memory_usage()
+    const {
+  return memory_report().total();
+}
+
+template <typename value_type>
+MemoryReport ws_deque<value_type>::memory_report() const {
+  using Cell = std::atomic<value_type>;
+  MemoryReport report = memory::array_report<Cell>(size(), capacity());
+  report.headers = memory::array_overhead<Cell>(capacity());
+  for (size_type i = 0; i < retired_.size(); ++i) {
+    size_type cells = static_cast<size_type>(retired_[i]->mask_ + 1);
+    report.slack += cells * sizeof(Cell);
+    report.headers += memory::array_overhead<Cell>(cells);
+  }
+  // сами Array: текущий и отставленные
+  size_type arrays = retired_.size() + 1;
+  report.control += arrays * sizeof(Array);
+  report.headers += arrays * memory::heap_overhead(sizeof(Array));
+  MemoryReport retired = retired_.memory_report();
+  retired.pointers = retired.payload;
+  retired.payload = 0;
+  retired.object = 0;
+  report += retired;
+  report.object = sizeof(*this);
+  return report;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_WS_DEQUE_H_
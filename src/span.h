@@ -0,0 +1,42 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SPAN_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SPAN_H_
+
+#include <cstddef>  // для std::size_t
+
+namespace s21 {
+// Непрерывный участок чужой памяти: указатель и длина, без владения.
+// Аналог std::span из C++20 для проекта на C++17; T может быть const.
+template <typename T>
+class span {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using iterator = value_type *;
+  using size_type = std::size_t;
+
+  constexpr span() : data_(nullptr), size_(0) {}
+  constexpr span(iterator data, size_type size) : data_(data), size_(size) {}
+  // span<T> -> span<const T>
+  template <typename U>
+  constexpr span(const span<U> &other)
+      : data_(other.data()), size_(other.size()) {}
+
+  constexpr reference operator[](size_type pos) const { return data_[pos]; }
+  constexpr reference front() const { return data_[0]; }
+  constexpr reference back() const { return data_[size_ - 1]; }
+  constexpr iterator data() const { return data_; }
+
+  constexpr iterator begin() const { return data_; }
+  constexpr iterator end() const { return data_ + size_; }
+
+  constexpr bool empty() const { return size_ == 0; }
+  constexpr size_type size() const { return size_; }
+
+ private:
+  iterator data_;
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SPAN_H_
@@ -1,16 +1,51 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
 #include <queue>
+#include <random>
 #include <set>
 #include <stack>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "s21_containers.h"
 #include "s21_containersplus.h"
 
+namespace {
+// считает копирования: копирующий конструктор и копирующее присваивание
+struct CopyCounter {
+  static int copies;
+  int value = 0;
+  CopyCounter() = default;
+  explicit CopyCounter(int v) : value(v) {}
+  CopyCounter(const CopyCounter &other) : value(other.value) { ++copies; }
+  CopyCounter(CopyCounter &&other) = default;
+  CopyCounter &operator=(const CopyCounter &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CopyCounter &operator=(CopyCounter &&other) = default;
+};
+int CopyCounter::copies = 0;
+}  // namespace
+
 // Array start
 
 TEST(array_test, array_constructor_test) {
@@ -124,9 +159,9 @@ TEST(array_test, array_max_size_test) {
 
 TEST(array_test, max_size) {
   std::array<int, 5> std_int;
-  s21::array<int, 5> s21_int;
+  s21::array<int, 5> s21_int{};
   std::array<double, 5> std_double;
-  s21::array<double, 5> s21_double;
+  s21::array<double, 5> s21_double{};
 
   ASSERT_EQ(std_int.max_size(), s21_int.max_size());
   ASSERT_EQ(std_double.max_size(), s21_double.max_size());
@@ -146,6 +181,52 @@ TEST(array_test, array_swap_test) {
   ASSERT_EQ(*arr.begin(), 7);
 }
 
+TEST(array_test, array_inline_storage_test) {
+  static_assert(sizeof(s21::array<float, 3>) == 3 * sizeof(float),
+                "elements must be stored inline");
+  static_assert(std::is_trivially_copyable<s21::array<float, 3>>::value,
+                "array of trivially copyable T must be trivially copyable");
+  static_assert(!std::is_trivially_copyable<s21::array<std::string, 2>>::value,
+                "array of std::string is not trivially copyable");
+  s21::array<int, 3> arr({1, 2, 3});
+  s21::array<int, 3> copy = arr;
+  copy[0] = 10;
+  ASSERT_EQ(arr[0], 1);
+  ASSERT_EQ(copy[0], 10);
+}
+
+constexpr int array_constexpr_sum() {
+  s21::array<int, 4> arr({4, 3, 2, 1});
+  s21::array<int, 4> other({0, 0, 0, 0});
+  other.fill(5);
+  arr.swap(other);
+  return arr.at(0) + arr.front() + other[0] + other.back();
+}
+
+TEST(array_test, array_constexpr_test) {
+  static_assert(array_constexpr_sum() == 15, "array must work in constexpr");
+  constexpr s21::array<int, 2> arr({7, 8});
+  static_assert(arr.size() == 2 && arr[1] == 8 && !arr.empty(), "");
+  ASSERT_EQ(array_constexpr_sum(), 15);
+}
+
+TEST(array_test, array_compare_test) {
+  s21::array<int, 3> a({1, 2, 3});
+  s21::array<int, 3> b({1, 2, 4});
+  EXPECT_TRUE(a == a);
+  EXPECT_TRUE(a != b);
+  EXPECT_TRUE(a < b);
+  EXPECT_TRUE(a <= b);
+  EXPECT_TRUE(b > a);
+  EXPECT_TRUE(b >= a);
+  EXPECT_FALSE(b < a);
+  EXPECT_TRUE((s21::array<int, 0>() == s21::array<int, 0>()));
+}
+
+TEST(array_test_THROW, array_too_many_initializers_test) {
+  EXPECT_THROW((s21::array<int, 2>({1, 2, 3})), std::invalid_argument);
+}
+
 // Array end
 
 // List start
@@ -709,6 +790,102 @@ TEST(list_test, max_size) {
   ASSERT_EQ(std_double.max_size(), s21_double.max_size());
 }
 
+TEST(list_test, list_end_empty_test) {
+  s21::list<int> lst;
+  EXPECT_TRUE(lst.begin() == lst.end());
+}
+
+TEST(list_test, list_end_decrement_test) {
+  s21::list<int> lst({1, 2, 3});
+  auto it = lst.end();
+  --it;
+  ASSERT_EQ(*it, 3);
+  lst.erase(it);
+  ASSERT_EQ(lst.back(), 2);
+}
+
+TEST(list_test_THROW, list_erase_end_test) {
+  s21::list<int> lst({1, 2, 3});
+  EXPECT_THROW(lst.erase(lst.end()), std::exception);
+  ASSERT_EQ(lst.size(), 3);
+}
+
+TEST(list_test, list_splice_iterators_test) {
+  s21::list<int> lst({1, 2});
+  s21::list<int> lst2({3, 4});
+  auto it = lst2.begin();
+  lst.splice(lst.end(), lst2);
+  ASSERT_EQ(*it, 3);
+  ASSERT_EQ(lst.size(), 4);
+  EXPECT_TRUE(lst2.empty());
+  EXPECT_TRUE(lst2.begin() == lst2.end());
+  std::list<int> og({1, 2, 3, 4});
+  EXPECT_TRUE(compare_list(og, lst));
+}
+
+TEST(list_test, list_reverse_test_2) {
+  s21::list<int> lst({1, 2, 3, 4});
+  lst.reverse();
+  std::list<int> og({4, 3, 2, 1});
+  EXPECT_TRUE(compare_list(og, lst));
+  s21::list<int> empty;
+  empty.reverse();
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(list_test, list_copy_empty_test) {
+  s21::list<std::string> lst;
+  s21::list<std::string> lst2(lst);
+  lst2.push_back("abc");
+  ASSERT_EQ(lst2.front(), "abc");
+  EXPECT_TRUE(lst.empty());
+}
+
+TEST(list_test, list_unique_runs_test) {
+  s21::list<int> lst({1, 1, 1, 2, 3, 3, 3, 3, 1, 1});
+  std::list<int> og({1, 1, 1, 2, 3, 3, 3, 3, 1, 1});
+  ASSERT_EQ(lst.unique(), 6);
+  og.unique();
+  EXPECT_TRUE(compare_list(og, lst));
+}
+
+TEST(list_test, list_unique_predicate_test) {
+  s21::list<int> lst({1, 2, 4, 5, 7, 8, 12});
+  std::list<int> og({1, 2, 4, 5, 7, 8, 12});
+  auto close = [](int a, int b) { return b - a < 3; };
+  lst.unique(close);
+  og.unique(close);
+  EXPECT_TRUE(compare_list(og, lst));
+}
+
+TEST(list_test, list_remove_test) {
+  s21::list<int> lst({5, 1, 5, 5, 2, 5, 3, 5});
+  std::list<int> og({5, 1, 5, 5, 2, 5, 3, 5});
+  ASSERT_EQ(lst.remove(5), 5);
+  og.remove(5);
+  EXPECT_TRUE(compare_list(og, lst));
+  ASSERT_EQ(lst.remove(42), 0);
+  ASSERT_EQ(lst.size(), 3);
+}
+
+TEST(list_test, list_remove_self_reference_test) {
+  s21::list<int> lst({7, 7, 1, 7});
+  lst.remove(lst.front());
+  ASSERT_EQ(lst.size(), 1);
+  ASSERT_EQ(lst.front(), 1);
+}
+
+TEST(list_test, list_remove_if_test) {
+  s21::list<int> lst({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  auto even = [](int x) { return x % 2 == 0; };
+  ASSERT_EQ(lst.remove_if(even), 5);
+  std::list<int> og({1, 3, 5, 7, 9});
+  EXPECT_TRUE(compare_list(og, lst));
+  ASSERT_EQ(lst.remove_if([](int) { return true; }), 5);
+  EXPECT_TRUE(lst.empty());
+  EXPECT_TRUE(lst.begin() == lst.end());
+}
+
 // List end
 
 // Queue start
@@ -843,6 +1020,73 @@ TEST(queue_suite, emplace_back) {
   EXPECT_TRUE(compare_queue(og, test));
 }
 
+TEST(queue_suite, wrap_around) {
+  s21::queue<int> test;
+  std::queue<int> og;
+  for (int i = 0; i < 100; ++i) {
+    test.push(i);
+    og.push(i);
+    if (i % 3 == 0) {
+      test.pop();
+      og.pop();
+    }
+  }
+  EXPECT_EQ(test.front(), og.front());
+  EXPECT_EQ(test.back(), og.back());
+  EXPECT_TRUE(compare_queue(og, test));
+}
+
+TEST(queue_suite, reserve_capacity) {
+  s21::queue<int> test;
+  EXPECT_EQ(test.capacity(), 0);
+  test.reserve(100);
+  EXPECT_EQ(test.capacity(), 128);
+  for (int i = 0; i < 128; ++i) test.push(i);
+  EXPECT_EQ(test.capacity(), 128);
+  test.push(128);
+  EXPECT_EQ(test.capacity(), 256);
+  EXPECT_EQ(test.front(), 0);
+  EXPECT_EQ(test.back(), 128);
+}
+
+TEST(queue_suite, push_range_pop_n) {
+  s21::queue<int> test({1, 2, 3});
+  std::vector<int> in({4, 5, 6, 7, 8, 9, 10, 11, 12});
+  test.push_range(in.begin(), in.end());
+  EXPECT_EQ(test.size(), 12);
+  std::vector<int> out;
+  test.pop_n(5, std::back_inserter(out));
+  EXPECT_EQ(out, std::vector<int>({1, 2, 3, 4, 5}));
+  test.pop_n(2);
+  std::queue<int> og({8, 9, 10, 11, 12});
+  EXPECT_TRUE(compare_queue(og, test));
+}
+
+TEST(queue_suite_THROW, pop_n_too_many) {
+  s21::queue<int> test({1, 2});
+  EXPECT_ANY_THROW(test.pop_n(3));
+  EXPECT_EQ(test.size(), 2);
+}
+
+TEST(queue_suite_THROW, reserve_too_many) {
+  s21::queue<int> test({1, 2});
+  EXPECT_THROW(test.reserve(SIZE_MAX), std::length_error);
+  EXPECT_THROW(test.reserve(test.max_size() + 1), std::length_error);
+  EXPECT_EQ(test.size(), 2);
+  EXPECT_EQ(test.front(), 1);
+}
+
+TEST(queue_suite, strings) {
+  s21::queue<std::string> test;
+  for (int i = 0; i < 20; ++i) test.push(std::to_string(i));
+  s21::queue<std::string> copy = test;
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(copy.front(), std::to_string(i));
+    copy.pop();
+  }
+  EXPECT_EQ(test.size(), 20);
+}
+
 // Queue end
 
 // Stack start
@@ -1057,6 +1301,73 @@ TEST(stack_test, stack_emplace_test) {
   ASSERT_EQ(stack.size(), 6);
 }
 
+TEST(stack_test, stack_deep_copy_test) {
+  s21::stack<int> stack;
+  stack.reserve(1000000);
+  for (int i = 0; i < 1000000; ++i) stack.push(i);
+  s21::stack<int> copy(stack);
+  ASSERT_EQ(copy.size(), 1000000);
+  ASSERT_EQ(copy.top(), 999999);
+  copy.pop();
+  ASSERT_EQ(copy.top(), 999998);
+  ASSERT_EQ(stack.top(), 999999);
+}
+
+TEST(stack_test, stack_strings_test) {
+  s21::stack<std::string> stack;
+  for (int i = 0; i < 50; ++i) stack.push(std::to_string(i));
+  s21::stack<std::string> copy(stack);
+  for (int i = 49; i >= 0; --i) {
+    ASSERT_EQ(copy.top(), std::to_string(i));
+    copy.pop();
+  }
+  EXPECT_TRUE(copy.empty());
+  ASSERT_EQ(stack.size(), 50);
+}
+
+TEST(stack_test, stack_container_test) {
+  s21::stack<int, std::vector<int>> stack({1, 2, 3});
+  stack.push(4);
+  ASSERT_EQ(stack.top(), 4);
+  stack.pop();
+  ASSERT_EQ(stack.top(), 3);
+  ASSERT_EQ(stack.size(), 3);
+}
+
+TEST(stack_test, stack_move_assign_test) {
+  s21::stack<int> stack({1, 2, 3});
+  s21::stack<int> other({7});
+  other = std::move(stack);
+  ASSERT_EQ(other.top(), 3);
+  ASSERT_EQ(other.size(), 3);
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(stack_test, push_moves_rvalues) {
+  s21::stack<CopyCounter> test;
+  test.reserve(4);
+  CopyCounter::copies = 0;
+  test.push(CopyCounter(1));
+  CopyCounter lvalue(2);
+  test.push(lvalue);
+  EXPECT_EQ(CopyCounter::copies, 1);
+  EXPECT_EQ(test.top().value, 2);
+  test.pop();
+  EXPECT_EQ(test.top().value, 1);
+}
+
+TEST(stack_test, pop_releases_element) {
+  auto owned = std::make_shared<int>(7);
+  s21::stack<std::shared_ptr<int>> test;
+  test.push(owned);
+  test.push(owned);
+  EXPECT_EQ(owned.use_count(), 3);
+  test.pop();
+  EXPECT_EQ(owned.use_count(), 2);
+  test.pop();
+  EXPECT_EQ(owned.use_count(), 1);
+}
+
 // Stack end
 
 // Vector start
@@ -1718,6 +2029,42 @@ TEST(vector_suite, emplace) {
   EXPECT_TRUE(compare_vector(og, test));
 }
 
+TEST(vector_suite, push_back_moves_rvalues) {
+  s21::vector<CopyCounter> test;
+  test.reserve(4);
+  CopyCounter::copies = 0;
+  test.push_back(CopyCounter(1));
+  CopyCounter lvalue(2);
+  test.push_back(lvalue);
+  EXPECT_EQ(CopyCounter::copies, 1);
+  CopyCounter::copies = 0;
+  test.push_back(CopyCounter(3));
+  test.push_back(CopyCounter(4));
+  test.push_back(CopyCounter(5));  // с переездом
+  EXPECT_EQ(CopyCounter::copies, 0);
+  CopyCounter::copies = 0;
+  test.insert(test.begin() + 1, lvalue);
+  test.erase(test.begin());
+  EXPECT_EQ(CopyCounter::copies, 1);
+  EXPECT_EQ(test[0].value, 2);
+  EXPECT_EQ(test[4].value, 5);
+}
+
+// аргумент push_back может лежать в самом векторе, и при переезде он не
+// должен читаться из освобождённой памяти
+TEST(vector_suite, push_back_own_element) {
+  s21::vector<std::string> test;
+  test.push_back(std::string(40, 'a'));
+  test.shrink_to_fit();
+  test.push_back(test[0]);
+  test.push_back(test[1]);
+  test.push_back(std::move(test[0]));
+  ASSERT_EQ(test.size(), 4U);
+  EXPECT_EQ(test[1], std::string(40, 'a'));
+  EXPECT_EQ(test[2], std::string(40, 'a'));
+  EXPECT_EQ(test[3], std::string(40, 'a'));
+}
+
 // Vector end
 
 // Map start
@@ -2110,6 +2457,28 @@ TEST(map_suite, emplace) {
   EXPECT_EQ(*(res[1].first), 15);
 }
 
+// удаление в перемешанном порядке проходит все случаи балансировки, в том
+// числе с NULL-племянниками
+TEST(map_test, erase_shuffled_matches_std) {
+  s21::map<int, int> test;
+  std::map<int, int> og;
+  for (int i = 0; i < 1000; ++i) {
+    test.insert(i, i);
+    og.insert({i, i});
+  }
+  std::vector<int> keys(1000);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    test.erase(test.find(keys[i]));
+    og.erase(keys[i]);
+    if (i % 100 == 0) {
+      ASSERT_TRUE(compare_maps(og, test));
+    }
+  }
+  EXPECT_TRUE(test.empty());
+}
+
 // Map end
 
 // Set start
@@ -2602,6 +2971,25 @@ TEST(set_test, set_emplace) {
   EXPECT_TRUE(compare_sets(og, st));
 }
 
+TEST(set_test, erase_from_both_ends) {
+  s21::set<int> test;
+  std::set<int> og;
+  for (int i = 0; i < 500; ++i) {
+    test.insert(i);
+    og.insert(i);
+  }
+  while (!og.empty()) {
+    ASSERT_EQ(*test.begin(), *og.begin());
+    test.erase(test.begin());
+    og.erase(og.begin());
+    if (og.empty()) break;
+    ASSERT_EQ(*--test.end(), *og.rbegin());
+    test.erase(--test.end());
+    og.erase(--og.end());
+  }
+  EXPECT_TRUE(test.empty());
+}
+
 // Set end
 
 // Multiset start
@@ -3089,8 +3477,2263 @@ TEST(multiset_test, set_emplace_empty) {
   EXPECT_TRUE(compare_multisets(og, st));
 }
 
+TEST(multiset_test, erase_begin_until_empty) {
+  s21::multiset<int> test;
+  std::multiset<int> og;
+  for (int i = 0; i < 2000; ++i) {
+    int value = (i * 7919) % 1013;
+    test.insert(value);
+    og.insert(value);
+  }
+  while (!og.empty()) {
+    ASSERT_EQ(*test.begin(), *og.begin());
+    test.erase(test.begin());
+    og.erase(og.begin());
+  }
+  EXPECT_TRUE(test.empty());
+}
+
 // Multiset end
 
+// SPSC queue start
+
+TEST(spsc_queue_test, push_pop) {
+  s21::spsc_queue<int> test(3);
+  EXPECT_EQ(test.capacity(), 4);
+  EXPECT_TRUE(test.empty());
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(test.try_push(i));
+  EXPECT_FALSE(test.try_push(4));
+  EXPECT_EQ(test.size(), 4);
+  int value = -1;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(test.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(test.try_pop(value));
+}
+
+TEST(spsc_queue_test, batch) {
+  s21::spsc_queue<std::string> test(8);
+  std::vector<std::string> in({"a", "b", "c", "d", "e", "f", "g", "h", "i"});
+  EXPECT_EQ(test.try_push_n(in.begin(), in.size()), 8);
+  std::vector<std::string> out;
+  EXPECT_EQ(test.try_pop_n(std::back_inserter(out), 5), 5);
+  EXPECT_EQ(out, std::vector<std::string>({"a", "b", "c", "d", "e"}));
+  EXPECT_EQ(test.try_push_n(in.begin() + 8, 1), 1);
+  EXPECT_EQ(test.try_pop_n(std::back_inserter(out), 10), 4);
+  EXPECT_EQ(out.back(), "i");
+}
+
+TEST(spsc_queue_test_THROW, zero_capacity) {
+  EXPECT_ANY_THROW(s21::spsc_queue<int>(0));
+}
+
+TEST(spsc_queue_test, stress) {
+  const int n = 1000000;
+  s21::spsc_queue<int> test(256);
+  std::thread producer([&] {
+    for (int i = 0; i < n; ++i) {
+      while (!test.try_push(i)) std::this_thread::yield();
+    }
+  });
+  bool ordered = true;
+  int value = 0;
+  for (int i = 0; i < n; ++i) {
+    while (!test.try_pop(value)) std::this_thread::yield();
+    if (value != i) ordered = false;
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(test.empty());
+}
+
+// SPSC queue end
+
+// MPMC queue start
+
+TEST(mpmc_queue_test, push_pop) {
+  s21::mpmc_queue<int> test(5);
+  EXPECT_EQ(test.capacity(), 8);
+  for (int i = 0; i < 8; ++i) EXPECT_TRUE(test.try_push(i));
+  EXPECT_FALSE(test.try_push(8));
+  EXPECT_EQ(test.size(), 8);
+  int value = -1;
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(test.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(test.try_pop(value));
+  EXPECT_TRUE(test.empty());
+}
+
+TEST(mpmc_queue_test, batch) {
+  s21::mpmc_queue<std::string> test(4);
+  std::vector<std::string> in({"a", "b", "c", "d", "e"});
+  EXPECT_EQ(test.try_push_n(in.begin(), in.size()), 4);
+  std::vector<std::string> out;
+  EXPECT_EQ(test.try_pop_n(std::back_inserter(out), 3), 3);
+  EXPECT_EQ(test.try_push_n(in.begin() + 4, 1), 1);
+  EXPECT_EQ(test.try_pop_n(std::back_inserter(out), 10), 2);
+  EXPECT_EQ(out, in);
+}
+
+TEST(mpmc_queue_test_THROW, small_capacity) {
+  EXPECT_ANY_THROW(s21::mpmc_queue<int>(1));
+}
+
+TEST(mpmc_queue_test, stress_blocking) {
+  const int threads = 4;
+  const int per_thread = 100000;
+  s21::mpmc_queue<long long> test(64);
+  std::atomic<long long> sum{0};
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&test, t] {
+      for (int i = 0; i < per_thread; ++i) test.push(t * per_thread + i + 1);
+    });
+    workers.emplace_back([&test, &sum] {
+      long long local = 0, value = 0;
+      for (int i = 0; i < per_thread; ++i) {
+        test.pop(value);
+        local += value;
+      }
+      sum += local;
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  long long total = 1LL * threads * per_thread;
+  EXPECT_EQ(sum.load(), total * (total + 1) / 2);
+  EXPECT_TRUE(test.empty());
+}
+
+// MPMC queue end
+
+// Work-stealing deque start
+
+TEST(ws_deque_test, owner_and_thief_ends) {
+  s21::ws_deque<int> test(2);
+  for (int i = 0; i < 10; ++i) test.push(i);
+  EXPECT_EQ(test.size(), 10);
+  EXPECT_GE(test.capacity(), 10);
+  int value = -1;
+  EXPECT_TRUE(test.pop(value));
+  EXPECT_EQ(value, 9);
+  EXPECT_TRUE(test.steal(value));
+  EXPECT_EQ(value, 0);
+  for (int i = 8; i >= 1; --i) {
+    EXPECT_TRUE(test.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(test.pop(value));
+  EXPECT_FALSE(test.steal(value));
+  EXPECT_TRUE(test.empty());
+}
+
+TEST(ws_deque_test, concurrent_steal) {
+  const long long n = 200000;
+  s21::ws_deque<long long> test;
+  std::atomic<bool> done{false};
+  std::atomic<long long> stolen_sum{0};
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < 3; ++t) {
+    thieves.emplace_back([&] {
+      long long local = 0, value = 0;
+      while (!done.load() || !test.empty()) {
+        if (test.steal(value)) local += value;
+      }
+      stolen_sum += local;
+    });
+  }
+  long long popped_sum = 0, value = 0;
+  for (long long i = 1; i <= n; ++i) {
+    test.push(i);
+    if (i % 3 == 0 && test.pop(value)) popped_sum += value;
+  }
+  while (test.pop(value)) popped_sum += value;
+  done = true;
+  for (auto &thief : thieves) thief.join();
+  EXPECT_EQ(popped_sum + stolen_sum.load(), n * (n + 1) / 2);
+}
+
+TEST(thread_pool_test, parallel_for) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4);
+  std::vector<int> data(100000, 1);
+  std::atomic<long long> sum{0};
+  pool.parallel_for(0, data.size(), 1000, [&](std::size_t first,
+                                               std::size_t last) {
+    long long local = 0;
+    for (std::size_t i = first; i < last; ++i) local += data[i] + i;
+    sum += local;
+  });
+  long long n = data.size();
+  EXPECT_EQ(sum.load(), n + n * (n - 1) / 2);
+  pool.parallel_for(5, 5, 10, [](std::size_t, std::size_t) { FAIL(); });
+}
+
+// Work-stealing deque end
+
+// Deque start
+
+template <typename T>
+testing::AssertionResult compare_deque(const std::deque<T> &og,
+                                       const s21::deque<T> &test) {
+  testing::AssertionResult res = testing::AssertionSuccess() << "Deques match";
+  if (og.size() != test.size()) {
+    res = testing::AssertionFailure()
+          << "Sizes don't match " << og.size() << " != " << test.size();
+  } else {
+    for (std::size_t i = 0; i < og.size() && res; ++i) {
+      if (og[i] != test[i]) {
+        res = testing::AssertionFailure()
+              << "at " << i << ": " << og[i] << " != " << test[i];
+      }
+    }
+  }
+  return res;
+}
+
+TEST(deque_test, push_pop_both_ends) {
+  s21::deque<int> test;
+  std::deque<int> og;
+  for (int i = 0; i < 5000; ++i) {
+    if (i % 3) {
+      test.push_back(i);
+      og.push_back(i);
+    } else {
+      test.push_front(i);
+      og.push_front(i);
+    }
+  }
+  EXPECT_TRUE(compare_deque(og, test));
+  for (int i = 0; i < 1500; ++i) {
+    test.pop_front();
+    og.pop_front();
+    test.pop_back();
+    og.pop_back();
+  }
+  EXPECT_TRUE(compare_deque(og, test));
+  EXPECT_EQ(test.front(), og.front());
+  EXPECT_EQ(test.back(), og.back());
+}
+
+TEST(deque_test, stable_references) {
+  s21::deque<int> test({1, 2, 3});
+  int *first = &test[0];
+  int *last = &test[2];
+  for (int i = 0; i < 100000; ++i) {
+    test.push_back(i);
+    test.push_front(-i);
+  }
+  EXPECT_EQ(*first, 1);
+  EXPECT_EQ(*last, 3);
+}
+
+TEST(deque_test, fifo_reuses_memory) {
+  s21::deque<std::string> test;
+  for (int i = 0; i < 100000; ++i) {
+    test.push_back(std::to_string(i));
+    if (i >= 10) test.pop_front();
+  }
+  EXPECT_EQ(test.size(), 10);
+  EXPECT_EQ(test.front(), "99990");
+  EXPECT_EQ(test.back(), "99999");
+}
+
+TEST(deque_test, random_access_iterators) {
+  s21::deque<int> test({5, 3, 9, 1, 7});
+  std::sort(test.begin(), test.end());
+  std::deque<int> og({1, 3, 5, 7, 9});
+  EXPECT_TRUE(compare_deque(og, test));
+  auto it = test.begin() + 3;
+  EXPECT_EQ(*it, 7);
+  EXPECT_EQ(it - test.begin(), 3);
+  EXPECT_EQ(test.end() - test.begin(), 5);
+  EXPECT_EQ(it[-1], 5);
+  const s21::deque<int> &ref = test;
+  int sum = 0;
+  for (auto value : ref) sum += value;
+  EXPECT_EQ(sum, 25);
+}
+
+TEST(deque_test, copy_move) {
+  s21::deque<int> test({1, 2, 3});
+  s21::deque<int> copy(test);
+  copy.push_front(0);
+  EXPECT_EQ(test.size(), 3);
+  EXPECT_EQ(copy.front(), 0);
+  s21::deque<int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 4);
+  EXPECT_TRUE(copy.empty());
+  test = std::move(moved);
+  EXPECT_EQ(test.size(), 4);
+}
+
+TEST(deque_test_THROW, empty) {
+  s21::deque<int> test;
+  EXPECT_ANY_THROW(test.front());
+  EXPECT_ANY_THROW(test.back());
+  EXPECT_ANY_THROW(test.pop_back());
+  EXPECT_ANY_THROW(test.pop_front());
+  EXPECT_ANY_THROW(test.at(0));
+}
+
+TEST(deque_test, stack_backing_store) {
+  s21::stack<int, s21::deque<int>> stack({1, 2, 3});
+  stack.push(4);
+  EXPECT_EQ(stack.top(), 4);
+  stack.pop();
+  EXPECT_EQ(stack.top(), 3);
+  EXPECT_EQ(stack.size(), 3);
+}
+
+// Deque end
+
+// Priority queue start
+
+TEST(priority_queue_test, push_pop) {
+  s21::priority_queue<int> test;
+  std::priority_queue<int> og;
+  for (int i = 0; i < 1000; ++i) {
+    int value = (i * 7919) % 1009;
+    test.push(value);
+    og.push(value);
+  }
+  EXPECT_EQ(test.size(), og.size());
+  while (!og.empty()) {
+    ASSERT_EQ(test.top(), og.top());
+    test.pop();
+    og.pop();
+  }
+  EXPECT_TRUE(test.empty());
+}
+
+TEST(priority_queue_test, initializer_list_and_compare) {
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> test(
+      {5, 1, 4, 2, 3});
+  for (int i = 1; i <= 5; ++i) {
+    EXPECT_EQ(test.top(), i);
+    test.pop();
+  }
+  s21::priority_queue<std::string, s21::deque<std::string>> words(
+      {"pear", "apple", "plum"});
+  EXPECT_EQ(words.top(), "plum");
+}
+
+TEST(priority_queue_test_THROW, empty) {
+  s21::priority_queue<int> test;
+  EXPECT_ANY_THROW(test.top());
+  EXPECT_ANY_THROW(test.pop());
+}
+
+TEST(d_ary_heap_test, push_pop_sorted) {
+  s21::d_ary_heap<int> test;
+  std::vector<int> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back((i * 7919) % 1009);
+    test.push(values.back());
+  }
+  std::sort(values.begin(), values.end());
+  for (int value : values) {
+    ASSERT_EQ(test.top(), value);
+    test.pop();
+  }
+  EXPECT_TRUE(test.empty());
+}
+
+TEST(d_ary_heap_test, decrease_key_update_erase) {
+  s21::d_ary_heap<int> test;
+  auto a = test.push(50);
+  auto b = test.push(40);
+  auto c = test.push(30);
+  EXPECT_EQ(test.top_handle(), c);
+  test.decrease_key(a, 10);
+  EXPECT_EQ(test.top_handle(), a);
+  EXPECT_ANY_THROW(test.decrease_key(b, 45));
+  test.update(a, 100);
+  EXPECT_EQ(test.top(), 30);
+  test.erase(c);
+  EXPECT_FALSE(test.contains(c));
+  EXPECT_EQ(test.top_handle(), b);
+  EXPECT_EQ(test.value(a), 100);
+  auto d = test.push(1);
+  EXPECT_EQ(d, c);
+  EXPECT_EQ(test.top(), 1);
+  EXPECT_EQ(test.size(), 3);
+  EXPECT_ANY_THROW(test.value(42));
+}
+
+TEST(d_ary_heap_test, dijkstra) {
+  // граф: 0->1 (4), 0->2 (1), 2->1 (2), 1->3 (1), 2->3 (5)
+  std::vector<std::vector<std::pair<int, int>>> graph(4);
+  graph[0] = {{1, 4}, {2, 1}};
+  graph[2] = {{1, 2}, {3, 5}};
+  graph[1] = {{3, 1}};
+  std::vector<int> dist(4, 1 << 30);
+  std::vector<std::size_t> handles(4);
+  std::vector<bool> queued(4, false);
+  s21::d_ary_heap<std::pair<int, int>> heap;
+  dist[0] = 0;
+  handles[0] = heap.push({0, 0});
+  queued[0] = true;
+  while (!heap.empty()) {
+    auto [d, u] = heap.top();
+    heap.pop();
+    queued[u] = false;
+    for (auto [v, w] : graph[u]) {
+      if (d + w < dist[v]) {
+        dist[v] = d + w;
+        if (queued[v]) {
+          heap.decrease_key(handles[v], {dist[v], v});
+        } else {
+          handles[v] = heap.push({dist[v], v});
+          queued[v] = true;
+        }
+      }
+    }
+  }
+  EXPECT_EQ(dist, std::vector<int>({0, 3, 1, 4}));
+}
+
+// Priority queue end
+
+// Unordered map start
+
+namespace {
+struct string_hash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+};
+
+// одинаково работает с s21::map и s21::unordered_map
+template <typename Map>
+int word_score(Map &m) {
+  m.insert(1, 10);
+  m.insert_or_assign(2, 20);
+  m[3] += 30;
+  m.insert(1, 100);
+  return m.contains(4) ? -1 : m.at(1) + m[2] + m[3];
+}
+}  // namespace
+
+TEST(unordered_map_test, insert_find_erase_random) {
+  s21::unordered_map<int, int> test;
+  std::unordered_map<int, int> og;
+  unsigned seed = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>((seed >> 8) % 4096);
+    if (seed & 1) {
+      EXPECT_EQ(test.insert(key, i).second, og.insert({key, i}).second);
+    } else {
+      EXPECT_EQ(test.erase(key), og.erase(key));
+    }
+  }
+  EXPECT_EQ(test.size(), og.size());
+  for (int key = 0; key < 4096; ++key) {
+    auto it = og.find(key);
+    if (it == og.end()) {
+      EXPECT_FALSE(test.contains(key));
+      EXPECT_TRUE(test.find(key) == test.end());
+    } else {
+      EXPECT_EQ(test.find(key)->second, it->second);
+    }
+  }
+  std::size_t visited = 0;
+  for (auto &item : test) {
+    EXPECT_EQ(og.at(item.first), item.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, og.size());
+}
+
+TEST(unordered_map_test, map_api) {
+  s21::unordered_map<int, int> hashed;
+  s21::map<int, int> ordered;
+  EXPECT_EQ(word_score(hashed), 60);
+  EXPECT_EQ(word_score(ordered), 60);
+
+  s21::unordered_map<std::string, int> test({{"one", 1}, {"two", 2}});
+  auto result = test.insert_or_assign("one", 11);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, 11);
+  test.erase(test.find("two"));
+  EXPECT_EQ(test.size(), 1U);
+  EXPECT_EQ(test["three"], 0);
+  EXPECT_EQ(test.size(), 2U);
+  auto emplaced = test.emplace(std::pair<const std::string, int>("four", 4),
+                               std::pair<const std::string, int>("one", 0));
+  EXPECT_TRUE(emplaced[0].second);
+  EXPECT_FALSE(emplaced[1].second);
+  EXPECT_EQ(emplaced[0].first->second, 4);
+}
+
+TEST(unordered_map_test_THROW, at) {
+  s21::unordered_map<int, int> test({{1, 1}});
+  const auto &ref = test;
+  EXPECT_EQ(ref.at(1), 1);
+  EXPECT_THROW(test.at(2), std::out_of_range);
+  EXPECT_THROW(ref.at(2), std::out_of_range);
+}
+
+TEST(unordered_map_test, heterogeneous_lookup) {
+  s21::unordered_map<std::string, int, string_hash, std::equal_to<>> test(
+      {{"alpha", 1}, {"beta", 2}});
+  std::string_view key = "beta";
+  EXPECT_TRUE(test.contains(key));
+  EXPECT_EQ(test.at("alpha"), 1);
+  EXPECT_EQ(test.find(key)->second, 2);
+  EXPECT_EQ(test.erase(key), 1U);
+  EXPECT_FALSE(test.contains("beta"));
+}
+
+TEST(unordered_map_test, reserve_rehash_load_factor) {
+  s21::unordered_map<int, int> test;
+  EXPECT_EQ(test.bucket_count(), 0U);
+  test.reserve(1000);
+  std::size_t buckets = test.bucket_count();
+  EXPECT_GE(buckets * test.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; ++i) test[i] = i;
+  EXPECT_EQ(test.bucket_count(), buckets);
+
+  test.max_load_factor(0.5f);
+  EXPECT_LE(test.load_factor(), 0.5f);
+  test.rehash(buckets * 4);
+  EXPECT_GE(test.bucket_count(), buckets * 4);
+  for (int i = 0; i < 1000; ++i) ASSERT_EQ(test.at(i), i);
+
+  test.max_load_factor(1.0f);
+  test.clear();
+  for (int i = 0; i < 100000; ++i) test[i] = i;
+  EXPECT_LT(test.size(), test.bucket_count());
+}
+
+TEST(unordered_map_test_THROW, max_load_factor) {
+  s21::unordered_map<int, int> test;
+  EXPECT_THROW(test.max_load_factor(0.0f), std::invalid_argument);
+  EXPECT_THROW(test.max_load_factor(1.5f), std::invalid_argument);
+}
+
+TEST(unordered_map_test, erase_heavy_reuses_slots) {
+  s21::unordered_map<int, int> test;
+  test.reserve(64);
+  std::size_t buckets = test.bucket_count();
+  for (int round = 0; round < 1000; ++round) {
+    for (int i = 0; i < 32; ++i) test[round * 32 + i] = i;
+    for (int i = 0; i < 32; ++i) test.erase(round * 32 + i);
+  }
+  EXPECT_TRUE(test.empty());
+  EXPECT_EQ(test.bucket_count(), buckets);
+}
+
+// значение берётся из этой же таблицы как раз тогда, когда вставка её
+// расширяет
+TEST(unordered_map_test, insert_own_element_at_rehash) {
+  s21::unordered_map<int, std::string> test;
+  test.insert(0, std::string(40, 'x'));
+  int rehashes = 0;
+  for (int key = 1; key < 1000; ++key) {
+    std::size_t buckets = test.bucket_count();
+    EXPECT_TRUE(test.insert(key, test.at(0)).second);
+    if (test.bucket_count() != buckets) ++rehashes;
+    EXPECT_EQ(test.at(key), std::string(40, 'x'));
+  }
+  EXPECT_GT(rehashes, 0);
+  EXPECT_EQ(test.at(0), std::string(40, 'x'));
+}
+
+TEST(unordered_map_test, copy_move_swap_merge) {
+  s21::unordered_map<int, std::string> test({{1, "a"}, {2, "b"}, {3, "c"}});
+  s21::unordered_map<int, std::string> copy(test);
+  copy[1] = "z";
+  EXPECT_EQ(test.at(1), "a");
+  s21::unordered_map<int, std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  EXPECT_EQ(copy.at(1), "z");
+
+  s21::unordered_map<int, std::string> other({{3, "x"}, {4, "d"}});
+  test.merge(other);
+  EXPECT_EQ(test.size(), 4U);
+  EXPECT_EQ(test.at(3), "c");
+  EXPECT_EQ(test.at(4), "d");
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at(3), "x");
+
+  test.swap(other);
+  EXPECT_EQ(test.size(), 1U);
+  EXPECT_EQ(other.size(), 4U);
+}
+
+TEST(unordered_set_test, set_api) {
+  s21::unordered_set<int> test({5, 1, 5, 3});
+  std::unordered_set<int> og({5, 1, 5, 3});
+  EXPECT_EQ(test.size(), og.size());
+  for (int value : test) EXPECT_TRUE(og.count(value));
+  EXPECT_FALSE(test.insert(1).second);
+  EXPECT_EQ(*test.insert(7).first, 7);
+  test.erase(test.find(5));
+  EXPECT_FALSE(test.contains(5));
+  EXPECT_EQ(test.erase(42), 0U);
+
+  s21::unordered_set<int> other({3, 9});
+  test.merge(other);
+  EXPECT_TRUE(test.contains(9));
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains(3));
+
+  auto result = test.emplace(10, 1);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(*result[0].first, 10);
+}
+
+TEST(unordered_set_test, heterogeneous_lookup) {
+  s21::unordered_set<std::string, string_hash, std::equal_to<>> test(
+      {"red", "green"});
+  EXPECT_TRUE(test.contains(std::string_view("red")));
+  EXPECT_FALSE(test.contains("blue"));
+  EXPECT_EQ(*test.find("green"), "green");
+}
+
+// Unordered map end
+
+// Flat map start
+
+TEST(flat_map_test, matches_std_map) {
+  s21::flat_map<int, int> test;
+  std::map<int, int> og;
+  unsigned seed = 777;
+  for (int i = 0; i < 5000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>((seed >> 8) % 1000);
+    if (seed & 1) {
+      EXPECT_EQ(test.insert(key, i).second, og.insert({key, i}).second);
+    } else {
+      EXPECT_EQ(test.erase(key), og.erase(key));
+    }
+  }
+  ASSERT_EQ(test.size(), og.size());
+  auto it = test.begin();
+  for (auto &item : og) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ((*it).second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == test.end());
+  for (int key = -1; key <= 1001; ++key) {
+    auto lower = og.lower_bound(key);
+    auto upper = og.upper_bound(key);
+    EXPECT_EQ(test.lower_bound(key) - test.begin(),
+              std::distance(og.begin(), lower));
+    EXPECT_EQ(test.upper_bound(key) - test.begin(),
+              std::distance(og.begin(), upper));
+    EXPECT_EQ(test.contains(key), og.count(key) == 1);
+  }
+}
+
+TEST(flat_map_test, map_api) {
+  s21::flat_map<int, int> flat;
+  EXPECT_EQ(word_score(flat), 60);
+
+  s21::flat_map<std::string, int> test({{"b", 2}, {"a", 1}});
+  EXPECT_EQ(test.begin()->first, "a");
+  EXPECT_FALSE(test.insert_or_assign("a", 10).second);
+  EXPECT_EQ(test.at("a"), 10);
+  test["c"] = 3;
+  test.erase(test.find("b"));
+  EXPECT_EQ(test.size(), 2U);
+  auto result = test.emplace(std::pair<std::string, int>("d", 4),
+                             std::pair<std::string, int>("0", 0));
+  EXPECT_TRUE(result[0].second);
+  EXPECT_EQ(result[0].first->first, "d");
+  EXPECT_EQ(result[1].first->first, "0");
+  EXPECT_EQ(test.keys()[0], "0");
+
+  const s21::flat_map<std::string, int> copy(test);
+  EXPECT_EQ(copy.at("c"), 3);
+  EXPECT_EQ(copy.find("zzz"), copy.end());
+}
+
+TEST(flat_map_test_THROW, at) {
+  s21::flat_map<int, int> test({{1, 1}});
+  EXPECT_THROW(test.at(2), std::out_of_range);
+  s21::vector<int> keys({1, 2});
+  s21::vector<int> values({1});
+  EXPECT_THROW((s21::flat_map<int, int>(std::move(keys), std::move(values))),
+               std::invalid_argument);
+}
+
+TEST(flat_map_test, bulk_build_sorts_and_dedups) {
+  std::vector<std::pair<int, char>> items = {
+      {3, 'a'}, {1, 'b'}, {3, 'c'}, {2, 'd'}, {1, 'e'}};
+  s21::flat_map<int, char> test(items.begin(), items.end());
+  ASSERT_EQ(test.size(), 3U);
+  EXPECT_EQ(test.at(1), 'b');
+  EXPECT_EQ(test.at(2), 'd');
+  EXPECT_EQ(test.at(3), 'a');
+
+  const std::size_t n = 1000000;
+  s21::vector<std::uint64_t> keys, values;
+  keys.reserve(n);
+  values.reserve(n);
+  for (std::uint64_t i = 0; i < n; ++i) {
+    keys.push_back((i * 2654435761u) % n);
+    values.push_back(i);
+  }
+  s21::flat_map<std::uint64_t, std::uint64_t> big(std::move(keys),
+                                                  std::move(values));
+  EXPECT_EQ(big.size(), n);
+  std::size_t bytes = big.keys().capacity() * sizeof(std::uint64_t) +
+                      big.values().capacity() * sizeof(std::uint64_t);
+  EXPECT_EQ(bytes, n * 16);
+  EXPECT_EQ(big.at(2654435761u % n), 1U);
+}
+
+TEST(flat_map_test, merge) {
+  s21::flat_map<int, char> test({{1, 'a'}, {3, 'c'}});
+  s21::flat_map<int, char> other({{2, 'b'}, {3, 'x'}, {4, 'd'}});
+  test.merge(other);
+  EXPECT_EQ(test.size(), 4U);
+  EXPECT_EQ(test.at(3), 'c');
+  ASSERT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at(3), 'x');
+  int expected = 1;
+  for (auto item : test) EXPECT_EQ(item.first, expected++);
+}
+
+TEST(flat_set_test, set_api) {
+  s21::flat_set<int> test({5, 1, 5, 3});
+  std::set<int> og({5, 1, 5, 3});
+  EXPECT_TRUE(std::equal(test.begin(), test.end(), og.begin(), og.end()));
+  EXPECT_FALSE(test.insert(3).second);
+  EXPECT_EQ(*test.insert(4).first, 4);
+  EXPECT_EQ(*test.lower_bound(2), 3);
+  EXPECT_EQ(*test.upper_bound(4), 5);
+  EXPECT_EQ(test.upper_bound(5), test.end());
+  test.erase(test.find(1));
+  EXPECT_FALSE(test.contains(1));
+  EXPECT_EQ(test.erase(42), 0U);
+
+  s21::flat_set<int> other({2, 3, 9});
+  test.merge(other);
+  EXPECT_EQ(test.size(), 5U);
+  EXPECT_TRUE(std::is_sorted(test.begin(), test.end()));
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains(3));
+
+  s21::flat_set<int, std::greater<int>> desc({1, 3, 2});
+  EXPECT_EQ(*desc.begin(), 3);
+  EXPECT_EQ(*desc.lower_bound(2), 2);
+}
+
+// Flat map end
+
+// Static set start
+
+TEST(static_set_test, matches_sorted_order_and_bounds) {
+  for (int n : {0, 1, 2, 3, 7, 8, 9, 100, 1000}) {
+    std::set<int> og;
+    for (int i = 0; i < n; ++i) og.insert(i * 3);
+    s21::static_set<int> test(og.begin(), og.end());
+    ASSERT_EQ(test.size(), og.size());
+    EXPECT_TRUE(std::equal(test.begin(), test.end(), og.begin(), og.end()));
+    if (n) {
+      EXPECT_EQ(*--test.end(), *og.rbegin());
+    }
+    for (int key = -2; key <= n * 3 + 2; ++key) {
+      auto lower = og.lower_bound(key);
+      auto upper = og.upper_bound(key);
+      if (lower == og.end()) {
+        EXPECT_TRUE(test.lower_bound(key) == test.end());
+      } else {
+        EXPECT_EQ(*test.lower_bound(key), *lower);
+      }
+      if (upper == og.end()) {
+        EXPECT_TRUE(test.upper_bound(key) == test.end());
+      } else {
+        EXPECT_EQ(*test.upper_bound(key), *upper);
+      }
+      EXPECT_EQ(test.contains(key), og.count(key) == 1);
+    }
+  }
+}
+
+TEST(static_set_test, build_from_set_and_unsorted_range) {
+  s21::set<int> source({5, 1, 4, 2});
+  s21::static_set<int> test(source);
+  EXPECT_EQ(test.size(), 4U);
+  EXPECT_TRUE(test.find(3) == test.end());
+  EXPECT_EQ(*test.find(4), 4);
+
+  s21::static_set<std::string> words({"pear", "apple", "pear", "fig"});
+  std::vector<std::string> sorted(words.begin(), words.end());
+  EXPECT_EQ(sorted, std::vector<std::string>({"apple", "fig", "pear"}));
+
+  s21::static_set<std::string> copy(words);
+  s21::static_set<std::string> moved(std::move(words));
+  EXPECT_TRUE(words.empty());
+  EXPECT_TRUE(copy.contains("fig"));
+  EXPECT_TRUE(moved.contains("apple"));
+
+  s21::set<int> none;
+  EXPECT_TRUE(s21::static_set<int>(none).empty());
+}
+
+// ключ копируется один раз - в буфер, в раскладку он переносится
+TEST(static_set_test, build_copies_each_key_once) {
+  struct ByValue {
+    bool operator()(const CopyCounter &a, const CopyCounter &b) const {
+      return a.value < b.value;
+    }
+  };
+  std::vector<CopyCounter> items;
+  for (int i = 0; i < 100; ++i) items.emplace_back((i * 37) % 50);
+  CopyCounter::copies = 0;
+  s21::static_set<CopyCounter, ByValue> test(items.begin(), items.end());
+  EXPECT_EQ(CopyCounter::copies, 100);
+  EXPECT_EQ(test.size(), 50U);
+
+  s21::set<int> source({1, 2, 3, 4});
+  s21::static_set<int, std::greater<int>> reversed(source);
+  std::vector<int> order(reversed.begin(), reversed.end());
+  EXPECT_EQ(order, std::vector<int>({4, 3, 2, 1}));
+}
+
+TEST(static_map_test, lookups) {
+  s21::map<int, std::string> source({{3, "c"}, {1, "a"}, {2, "b"}});
+  s21::static_map<int, std::string> test(source);
+  EXPECT_EQ(test.at(2), "b");
+  EXPECT_FALSE(test.contains(4));
+  EXPECT_EQ(test.lower_bound(0)->second, "a");
+  EXPECT_TRUE(test.upper_bound(3) == test.end());
+  std::string joined;
+  for (auto item : test) joined += item.second;
+  EXPECT_EQ(joined, "abc");
+
+  // диапазоны адресов: ключ - начало диапазона, значение - его имя
+  s21::static_map<unsigned, std::string> ranges(
+      {{0x0A000000u, "ten"}, {0xC0A80000u, "lan"}, {0x7F000000u, "loop"}});
+  auto it = ranges.upper_bound(0xC0A80101u);
+  --it;
+  EXPECT_EQ(it->second, "lan");
+}
+
+TEST(static_map_test_THROW, at) {
+  s21::static_map<int, int> test({{1, 1}});
+  EXPECT_THROW(test.at(2), std::out_of_range);
+  s21::static_map<int, int> empty;
+  EXPECT_THROW(empty.at(0), std::out_of_range);
+}
+
+// Static set end
+
+// B-tree start
+
+TEST(btree_map_test, matches_std_map) {
+  s21::btree_map<int, int> test;
+  std::map<int, int> og;
+  unsigned seed = 2024;
+  for (int i = 0; i < 40000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>((seed >> 8) % 3000);
+    if ((seed >> 4) % 3) {
+      EXPECT_EQ(test.insert(key, i).second, og.insert({key, i}).second);
+    } else {
+      EXPECT_EQ(test.erase(key), og.erase(key));
+    }
+  }
+  ASSERT_EQ(test.size(), og.size());
+  auto it = test.begin();
+  for (auto &item : og) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ((*it).second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == test.end());
+  for (auto rit = og.rbegin(); rit != og.rend(); ++rit) {
+    --it;
+    EXPECT_EQ(it->first, rit->first);
+  }
+  EXPECT_TRUE(it == test.begin());
+  for (int key = -1; key <= 3001; ++key) {
+    auto lower = og.lower_bound(key);
+    auto upper = og.upper_bound(key);
+    EXPECT_EQ(std::distance(test.begin(), test.lower_bound(key)),
+              std::distance(og.begin(), lower));
+    EXPECT_EQ(std::distance(test.begin(), test.upper_bound(key)),
+              std::distance(og.begin(), upper));
+    EXPECT_EQ(test.contains(key), og.count(key) == 1);
+  }
+  while (!og.empty()) {
+    test.erase(test.begin());
+    og.erase(og.begin());
+    if (!og.empty() && og.size() % 500 == 0) {
+      ASSERT_EQ(test.begin()->first, og.begin()->first);
+    }
+  }
+  EXPECT_TRUE(test.empty());
+  EXPECT_TRUE(test.begin() == test.end());
+}
+
+TEST(btree_map_test, map_api) {
+  s21::btree_map<std::string, int> test({{"b", 2}, {"a", 1}});
+  EXPECT_EQ(test.begin()->first, "a");
+  EXPECT_FALSE(test.insert_or_assign("a", 10).second);
+  EXPECT_EQ(test.at("a"), 10);
+  test["c"] = 3;
+  test.erase(test.find("b"));
+  EXPECT_EQ(test.size(), 2U);
+  auto result = test.emplace(std::pair<std::string, int>("d", 4),
+                             std::pair<std::string, int>("0", 0));
+  EXPECT_TRUE(result[0].second);
+  EXPECT_EQ(result[0].first->first, "d");
+  EXPECT_EQ(result[1].first->first, "0");
+
+  // длинные строковые ключи: узлы по 7 элементов, много уровней
+  for (int i = 0; i < 2000; ++i) test[std::to_string(i * 7919 % 2000)] = i;
+  const s21::btree_map<std::string, int> copy(test);
+  s21::btree_map<std::string, int> moved(std::move(test));
+  EXPECT_TRUE(test.empty());
+  EXPECT_EQ(copy.size(), moved.size());
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), moved.begin(), moved.end(),
+                         [](auto a, auto b) { return a.first == b.first; }));
+  EXPECT_EQ(copy.at("c"), 3);
+  EXPECT_TRUE(copy.find("zzz") == copy.end());
+  auto range = moved.equal_range("1999");
+  EXPECT_EQ(std::distance(range.first, range.second), 1);
+
+  s21::btree_map<std::string, int> other({{"c", 30}, {"e", 5}});
+  moved.merge(other);
+  EXPECT_EQ(moved.at("e"), 5);
+  ASSERT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at("c"), 30);
+}
+
+TEST(btree_map_test_THROW, at) {
+  s21::btree_map<int, int> test({{1, 1}});
+  EXPECT_THROW(test.at(2), std::out_of_range);
+  s21::btree_map<int, int> empty;
+  EXPECT_THROW(empty.at(0), std::out_of_range);
+}
+
+TEST(btree_set_test, set_api) {
+  s21::btree_set<int> test({5, 1, 5, 3});
+  std::set<int> og({5, 1, 5, 3});
+  EXPECT_TRUE(std::equal(test.begin(), test.end(), og.begin(), og.end()));
+  EXPECT_FALSE(test.insert(3).second);
+  EXPECT_EQ(*test.insert(4).first, 4);
+  EXPECT_EQ(*test.lower_bound(2), 3);
+  EXPECT_EQ(*test.upper_bound(4), 5);
+  EXPECT_TRUE(test.upper_bound(5) == test.end());
+  test.erase(test.find(1));
+  EXPECT_FALSE(test.contains(1));
+  EXPECT_EQ(test.erase(42), 0U);
+
+  s21::btree_set<int> other({2, 3, 9});
+  test.merge(other);
+  EXPECT_EQ(test.size(), 5U);
+  EXPECT_TRUE(std::is_sorted(test.begin(), test.end()));
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains(3));
+
+  s21::btree_set<int, std::greater<int>> desc;
+  for (int i = 0; i < 1000; ++i) desc.insert(i);
+  EXPECT_EQ(*desc.begin(), 999);
+  EXPECT_EQ(*desc.lower_bound(500), 500);
+  EXPECT_EQ(*--desc.end(), 0);
+}
+
+TEST(btree_multiset_test, matches_std_multiset) {
+  s21::btree_multiset<int> test;
+  std::multiset<int> og;
+  unsigned seed = 99;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>((seed >> 8) % 200);
+    if ((seed >> 4) % 4) {
+      EXPECT_EQ(*test.insert(key), key);
+      og.insert(key);
+    } else if (og.count(key)) {
+      test.erase(test.find(key));
+      og.erase(og.find(key));
+    }
+  }
+  ASSERT_EQ(test.size(), og.size());
+  EXPECT_TRUE(std::equal(test.begin(), test.end(), og.begin(), og.end()));
+  for (int key = -1; key <= 200; ++key) {
+    auto range = test.equal_range(key);
+    EXPECT_EQ(test.count(key), og.count(key));
+    auto dist = std::distance(range.first, range.second);
+    EXPECT_EQ(static_cast<std::size_t>(dist), og.count(key));
+  }
+  EXPECT_EQ(test.erase(7), og.erase(7));
+  EXPECT_FALSE(test.contains(7));
+
+  s21::btree_multiset<int> other({1, 1, 500});
+  std::size_t before = test.size();
+  test.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(test.size(), before + 3);
+  EXPECT_EQ(*--test.end(), 500);
+  auto result = test.emplace(3, 3);
+  EXPECT_EQ(*result[1].first, 3);
+}
+
+// B-tree end
+
+// Persistent map start
+
+TEST(persistent_map_test, snapshots_are_isolated) {
+  s21::persistent_map<int, int> test;
+  std::map<int, int> og;
+  std::vector<std::pair<s21::persistent_map<int, int>, std::map<int, int>>>
+      versions;
+  unsigned seed = 31;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>((seed >> 8) % 2000);
+    if ((seed >> 4) % 3 == 0) {
+      EXPECT_EQ(test.erase(key), og.erase(key));
+    } else if ((seed >> 4) % 3 == 1) {
+      EXPECT_EQ(test.insert(key, i).second, og.insert({key, i}).second);
+    } else {
+      test.insert_or_assign(key, -i);
+      og[key] = -i;
+    }
+    if (i % 2000 == 0) versions.push_back({test.snapshot(), og});
+  }
+  versions.push_back({test, og});
+  for (auto &version : versions) {
+    ASSERT_EQ(version.first.size(), version.second.size());
+    EXPECT_TRUE(std::equal(version.first.begin(), version.first.end(),
+                           version.second.begin(), version.second.end()));
+  }
+  for (int key = -1; key <= 2001; ++key) {
+    auto lower = og.lower_bound(key);
+    auto upper = og.upper_bound(key);
+    EXPECT_EQ(std::distance(test.begin(), test.lower_bound(key)),
+              std::distance(og.begin(), lower));
+    EXPECT_EQ(std::distance(test.begin(), test.upper_bound(key)),
+              std::distance(og.begin(), upper));
+    EXPECT_EQ(test.count(key), og.count(key));
+  }
+}
+
+TEST(persistent_map_test, map_api) {
+  s21::persistent_map<std::string, int> test({{"b", 2}, {"a", 1}});
+  s21::persistent_map<std::string, int> before = test;
+  EXPECT_FALSE(test.insert_or_assign("a", 10).second);
+  EXPECT_EQ(test.at("a"), 10);
+  EXPECT_EQ(before.at("a"), 1);
+  test.erase(test.find("b"));
+  EXPECT_FALSE(test.contains("b"));
+  EXPECT_TRUE(before.contains("b"));
+  auto result = test.emplace(std::pair<std::string, int>("d", 4),
+                             std::pair<std::string, int>("0", 0));
+  EXPECT_EQ(result[0].first->first, "d");
+  EXPECT_EQ(result[1].first->second, 0);
+
+  s21::persistent_map<std::string, int> other({{"a", 5}, {"e", 5}});
+  test.merge(other);
+  EXPECT_EQ(test.size(), 4U);
+  ASSERT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at("a"), 5);
+  s21::persistent_map<std::string, int> moved(std::move(test));
+  EXPECT_TRUE(test.empty());
+  EXPECT_EQ(moved.begin()->first, "0");
+}
+
+TEST(persistent_map_test_THROW, at) {
+  s21::persistent_map<int, int> test({{1, 1}});
+  EXPECT_THROW(test.at(2), std::out_of_range);
+}
+
+TEST(persistent_set_test, set_api) {
+  s21::persistent_set<int> test({5, 1, 5, 3});
+  s21::persistent_set<int> v1 = test.snapshot();
+  EXPECT_FALSE(test.insert(3).second);
+  EXPECT_EQ(*test.insert(4).first, 4);
+  EXPECT_EQ(*test.lower_bound(2), 3);
+  EXPECT_TRUE(test.upper_bound(5) == test.end());
+  EXPECT_EQ(test.erase(1), 1U);
+  std::vector<int> now(test.begin(), test.end());
+  std::vector<int> then(v1.begin(), v1.end());
+  EXPECT_EQ(now, std::vector<int>({3, 4, 5}));
+  EXPECT_EQ(then, std::vector<int>({1, 3, 5}));
+}
+
+// писатель меняет отображение и публикует снимки, читатели проверяют, что
+// каждый снимок целостен: все значения в нём равны номеру версии
+TEST(persistent_map_test, concurrent_readers) {
+  const int kKeys = 64, kVersions = 300;
+  s21::persistent_map<int, int> published;
+  std::mutex lock;
+  std::atomic<bool> done{false};
+  std::atomic<int> broken{0};
+  for (int key = 0; key < kKeys; ++key) published.insert(key, 0);
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 3; ++r) {
+    readers.emplace_back([&] {
+      while (!done.load()) {
+        s21::persistent_map<int, int> snap;
+        {
+          std::lock_guard<std::mutex> guard(lock);
+          snap = published.snapshot();
+        }
+        int version = snap.begin()->second;
+        for (auto &item : snap) broken += item.second != version;
+      }
+    });
+  }
+  s21::persistent_map<int, int> writer = published;
+  for (int version = 1; version <= kVersions; ++version) {
+    for (int key = 0; key < kKeys; ++key) writer.insert_or_assign(key, version);
+    std::lock_guard<std::mutex> guard(lock);
+    published = writer.snapshot();
+  }
+  done = true;
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(broken.load(), 0);
+  EXPECT_EQ(published.at(kKeys - 1), kVersions);
+}
+
+// копия итератора переносит путь и дальше идёт независимо от оригинала
+TEST(persistent_map_test, iterator_copy_and_end) {
+  s21::persistent_map<int, int> test;
+  for (int i = 0; i < 100; ++i) test.insert(i, i * 2);
+  auto it = test.begin();
+  for (int i = 0; i < 40; ++i) ++it;
+  auto copy = it;
+  ++it;
+  EXPECT_EQ(copy->first, 40);
+  EXPECT_EQ(it->first, 41);
+  copy = it;
+  int count = 0;
+  for (; copy != test.end(); ++copy) ++count;
+  EXPECT_EQ(count, 59);
+  EXPECT_TRUE((copy == s21::persistent_map<int, int>::iterator()));
+  EXPECT_EQ(it->second, 82);
+}
+
+// Persistent map end
+
+// Concurrent map start
+
+TEST(concurrent_map_test, matches_std_map) {
+  s21::concurrent_map<int, int> test;
+  std::map<int, int> og;
+  unsigned seed = 5;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>((seed >> 8) % 1000);
+    if ((seed >> 4) % 3) {
+      EXPECT_EQ(test.insert(key, i).second, og.insert({key, i}).second);
+    } else {
+      EXPECT_EQ(test.erase(key), og.erase(key));
+    }
+  }
+  ASSERT_EQ(test.size(), og.size());
+  auto it = test.begin();
+  for (auto &item : og) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ((*it).second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == test.end());
+  for (int key = -1; key <= 1001; ++key) {
+    auto lower = og.lower_bound(key);
+    auto upper = og.upper_bound(key);
+    if (lower == og.end()) {
+      EXPECT_TRUE(test.lower_bound(key) == test.end());
+    } else {
+      EXPECT_EQ(test.lower_bound(key)->first, lower->first);
+    }
+    if (upper == og.end()) {
+      EXPECT_TRUE(test.upper_bound(key) == test.end());
+    } else {
+      EXPECT_EQ(test.upper_bound(key)->first, upper->first);
+    }
+    EXPECT_EQ(test.contains(key), og.count(key) == 1);
+  }
+  test.clear();
+  EXPECT_TRUE(test.empty());
+  EXPECT_TRUE(test.begin() == test.end());
+}
+
+TEST(concurrent_map_test, map_api) {
+  s21::concurrent_map<std::string, int> test({{"b", 2}, {"a", 1}});
+  EXPECT_EQ(test.begin()->first, "a");
+  EXPECT_FALSE(test.insert("a", 10).second);
+  EXPECT_EQ(test.at("a"), 1);
+  test.erase(test.find("b"));
+  EXPECT_FALSE(test.contains("b"));
+  auto result = test.emplace(std::pair<std::string, int>("d", 4),
+                             std::pair<std::string, int>("0", 0));
+  EXPECT_TRUE(result[0].second);
+  EXPECT_EQ(result[0].first->first, "d");
+  EXPECT_EQ(result[1].first->second, 0);
+  EXPECT_EQ(test.size(), 3U);
+}
+
+TEST(concurrent_map_test_THROW, at) {
+  s21::concurrent_map<int, int> test({{1, 1}});
+  EXPECT_THROW(test.at(2), std::out_of_range);
+}
+
+// Писатели вставляют и удаляют пересекающиеся диапазоны ключей, читатели
+// всё это время обходят контейнер и ищут ключи: обход должен оставаться
+// строго упорядоченным. Затем все писатели удаляют все ключи, и контейнер
+// должен опустеть.
+TEST(concurrent_map_test, concurrent_writers_and_readers) {
+  const int kWriters = 4, kKeys = 2000;
+  s21::concurrent_map<int, int> test;
+  std::atomic<bool> done{false};
+  std::atomic<int> broken{0}, erased{0};
+  std::vector<std::thread> writers, readers;
+  for (int w = 0; w < kWriters; ++w) {
+    writers.emplace_back([&, w] {
+      for (int round = 0; round < 3; ++round) {
+        for (int key = w; key < kKeys; key += 2) test.insert(key, key * 10);
+        for (int key = w; key < kKeys; key += kWriters) test.erase(key);
+      }
+    });
+  }
+  for (int r = 0; r < 2; ++r) {
+    readers.emplace_back([&] {
+      while (!done.load()) {
+        int last = -1;
+        for (auto item : test) {
+          broken += item.first <= last || item.second != item.first * 10;
+          last = item.first;
+        }
+        for (int key = 0; key < kKeys; key += 97) {
+          auto it = test.find(key);
+          broken += it != test.end() && it->first != key;
+        }
+      }
+    });
+  }
+  for (auto &thread : writers) thread.join();
+  std::size_t listed = 0;
+  for (auto it = test.begin(); it != test.end(); ++it) ++listed;
+  EXPECT_EQ(test.size(), listed);
+  writers.clear();
+  for (int w = 0; w < kWriters; ++w) {
+    writers.emplace_back([&] {
+      for (int key = 0; key < kKeys; ++key) erased += test.erase(key);
+    });
+  }
+  for (auto &thread : writers) thread.join();
+  done = true;
+  for (auto &thread : readers) thread.join();
+  EXPECT_EQ(broken.load(), 0);
+  EXPECT_EQ(static_cast<std::size_t>(erased.load()), listed);
+  EXPECT_TRUE(test.empty());
+  EXPECT_TRUE(test.begin() == test.end());
+}
+
+// вставка и удаление одного ключа из разных потоков: size() не должен
+// уходить через ноль
+TEST(concurrent_map_test, size_never_wraps) {
+  const int kKeys = 8;
+  s21::concurrent_map<int, int> test;
+  std::atomic<bool> done{false};
+  std::atomic<int> wrapped{0};
+  std::thread reader([&] {
+    while (!done.load()) wrapped += test.size() > kKeys;
+  });
+  std::vector<std::thread> writers;
+  for (int w = 0; w < 2; ++w) {
+    writers.emplace_back([&, w] {
+      for (int i = 0; i < 20000; ++i) {
+        if (w == 0) {
+          test.insert(i % kKeys, i);
+        } else {
+          test.erase(i % kKeys);
+        }
+      }
+    });
+  }
+  for (auto &thread : writers) thread.join();
+  done = true;
+  reader.join();
+  EXPECT_EQ(wrapped.load(), 0);
+  std::size_t listed = 0;
+  for (auto it = test.begin(); it != test.end(); ++it) ++listed;
+  EXPECT_EQ(test.size(), listed);
+}
+
+// erase(iterator) удаляет свой узел, а не заново вставленный ключ
+TEST(concurrent_map_test, erase_iterator_node) {
+  s21::concurrent_map<int, int> test({{1, 10}, {2, 20}});
+  auto stale = test.find(1);
+  EXPECT_EQ(test.erase(1), 1U);
+  test.insert(1, 11);
+  test.erase(stale);
+  EXPECT_TRUE(test.contains(1));
+  EXPECT_EQ(test.at(1), 11);
+  test.erase(test.find(1));
+  EXPECT_FALSE(test.contains(1));
+  EXPECT_EQ(test.size(), 1U);
+}
+
+// Concurrent map end
+
+// Bulk ops start
+
+// Каждая ширина векторов, доступная процессору, сверяется со скалярными
+// алгоритмами std на длинах вокруг границ векторов и блоков.
+template <typename T>
+void bulk_check_all_levels() {
+  std::mt19937 gen(11);
+  for (auto level : {s21::SimdLevel::kScalar, s21::SimdLevel::k128,
+                     s21::SimdLevel::k256, s21::SimdLevel::k512}) {
+    s21::set_simd_level(level);
+    for (std::size_t n : {0, 1, 7, 16, 33, 64, 127, 256, 1000, 5000}) {
+      s21::vector<T> a(n), b(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        a[i] = b[i] = static_cast<T>(gen() % 50);
+      }
+      T value = static_cast<T>(gen() % 60);
+      auto found = std::find(a.begin(), a.end(), value);
+      auto count = std::count(a.begin(), a.end(), value);
+      EXPECT_EQ(s21::bulk_find(a, value),
+                static_cast<std::size_t>(found - a.begin()));
+      EXPECT_EQ(s21::bulk_count(a, value), static_cast<std::size_t>(count));
+      EXPECT_TRUE(s21::bulk_equal(a, b));
+      EXPECT_EQ(s21::bulk_compare(a, b), 0);
+      if (n != 0) {
+        b[n - 1] = static_cast<T>(b[n - 1] + 1);
+        EXPECT_FALSE(s21::bulk_equal(a, b));
+        EXPECT_EQ(s21::bulk_mismatch(a.data(), b.data(), n), n - 1);
+        EXPECT_LT(s21::bulk_compare(a, b), 0);
+        EXPECT_GT(s21::bulk_compare(b, a), 0);
+        auto mm = std::minmax_element(a.begin(), a.end());
+        EXPECT_EQ(s21::bulk_min(a), *mm.first);
+        EXPECT_EQ(s21::bulk_max(a), *mm.second);
+      }
+      using S = typename s21::BulkSum<T>::type;
+      S sum{}, dot{};
+      for (std::size_t i = 0; i < n; ++i) {
+        sum += static_cast<S>(a[i]);
+        dot += static_cast<S>(a[i]) * static_cast<S>(a[i]);
+      }
+      EXPECT_EQ(s21::bulk_sum(a), sum);
+      EXPECT_EQ(s21::bulk_dot(a, a), dot);
+      std::vector<T> og(a.begin(), a.end());
+      std::replace(og.begin(), og.end(), value, static_cast<T>(1));
+      s21::bulk_replace(a, value, static_cast<T>(1));
+      EXPECT_TRUE(std::equal(og.begin(), og.end(), a.begin()));
+      s21::bulk_fill(a, value);
+      EXPECT_EQ(static_cast<std::size_t>(std::count(a.begin(), a.end(), value)),
+                n);
+    }
+  }
+  s21::set_simd_level(s21::simd_detect());
+}
+
+TEST(bulk_ops_test, int8) { bulk_check_all_levels<std::int8_t>(); }
+TEST(bulk_ops_test, uint16) { bulk_check_all_levels<std::uint16_t>(); }
+TEST(bulk_ops_test, int32) { bulk_check_all_levels<int>(); }
+TEST(bulk_ops_test, uint64) { bulk_check_all_levels<std::uint64_t>(); }
+TEST(bulk_ops_test, float) { bulk_check_all_levels<float>(); }
+TEST(bulk_ops_test, double) { bulk_check_all_levels<double>(); }
+
+TEST(bulk_ops_test, count_many_bytes) {
+  s21::vector<char> v(100000);
+  s21::bulk_fill(v, 'x');
+  v[500] = 'y';
+  EXPECT_EQ(s21::bulk_count(v, 'x'), 99999U);
+}
+
+TEST(bulk_ops_test, nan_and_lengths) {
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  s21::vector<float> a(100), b(100);
+  s21::bulk_fill(a, 1.0f);
+  s21::bulk_fill(b, 1.0f);
+  a[10] = b[10] = nan;
+  EXPECT_FALSE(s21::bulk_equal(a, b));
+  EXPECT_EQ(s21::bulk_find(a, nan), 100U);
+  EXPECT_EQ(s21::bulk_compare(a, b), 0);
+  b[50] = 2.0f;
+  EXPECT_LT(s21::bulk_compare(a, b), 0);
+  s21::vector<float> shorter(50);
+  s21::bulk_fill(shorter, 1.0f);
+  EXPECT_GT(s21::bulk_compare(b, shorter), 0);
+  EXPECT_FLOAT_EQ(s21::bulk_sum(shorter), 50.0f);
+}
+
+TEST(bulk_ops_test, large_array) {
+  s21::array<double, 200> a, b;
+  a.fill(2.5);
+  b.fill(2.5);
+  EXPECT_TRUE(a == b);
+  b[199] = 3.0;
+  EXPECT_TRUE(a < b);
+  EXPECT_DOUBLE_EQ(s21::bulk_dot(a, b), 2.5 * 2.5 * 199 + 2.5 * 3.0);
+}
+
+// -0.0 доходит до всех элементов: дорожки заполняются без сложения
+template <typename T>
+void bulk_check_negative_zero() {
+  for (auto level : {s21::SimdLevel::kScalar, s21::SimdLevel::k128,
+                     s21::SimdLevel::k256, s21::SimdLevel::k512}) {
+    s21::set_simd_level(level);
+    s21::vector<T> a(100);
+    s21::bulk_fill(a, static_cast<T>(-0.0));
+    for (std::size_t i = 0; i < a.size(); ++i) EXPECT_TRUE(std::signbit(a[i]));
+    s21::bulk_fill(a, static_cast<T>(1));
+    s21::bulk_replace(a, static_cast<T>(1), static_cast<T>(-0.0));
+    for (std::size_t i = 0; i < a.size(); ++i) EXPECT_TRUE(std::signbit(a[i]));
+    s21::array<T, 64> arr;
+    arr.fill(static_cast<T>(-0.0));
+    for (T item : arr) EXPECT_TRUE(std::signbit(item));
+  }
+  s21::set_simd_level(s21::simd_detect());
+}
+
+TEST(bulk_ops_test, negative_zero_float) {
+  bulk_check_negative_zero<float>();
+}
+TEST(bulk_ops_test, negative_zero_double) {
+  bulk_check_negative_zero<double>();
+}
+
+TEST(bulk_ops_test_THROW, empty_min) {
+  s21::vector<int> v;
+  EXPECT_THROW(s21::bulk_min(v), std::invalid_argument);
+  s21::vector<int> a(2), b(3);
+  EXPECT_THROW(s21::bulk_dot(a, b), std::invalid_argument);
+}
+
+// Bulk ops end
+
+// Small vector start
+
+TEST(small_vector_test, stays_inline_up_to_n) {
+  s21::small_vector<int, 8> test;
+  const char *object = reinterpret_cast<const char *>(&test);
+  for (int i = 0; i < 8; ++i) test.push_back(i);
+  EXPECT_TRUE(test.is_inline());
+  EXPECT_EQ(test.capacity(), 8U);
+  const char *data = reinterpret_cast<const char *>(test.data());
+  EXPECT_TRUE(data >= object && data < object + sizeof(test));
+  test.push_back(8);
+  EXPECT_FALSE(test.is_inline());
+  EXPECT_EQ(test.capacity(), 16U);
+  for (int i = 0; i < 9; ++i) EXPECT_EQ(test[i], i);
+  test.pop_back();
+  test.shrink_to_fit();
+  EXPECT_TRUE(test.is_inline());
+  EXPECT_EQ(test.size(), 8U);
+  EXPECT_EQ(test.back(), 7);
+}
+
+TEST(small_vector_test, matches_std_vector) {
+  s21::small_vector<std::string, 4> test;
+  std::vector<std::string> og;
+  for (int i = 0; i < 40; ++i) {
+    std::string value(20, static_cast<char>('a' + i % 26));
+    if (i % 5 == 4) {
+      test.erase(test.begin() + 1);
+      og.erase(og.begin() + 1);
+    } else if (i % 3 == 0) {
+      test.insert(test.begin(), value);
+      og.insert(og.begin(), value);
+    } else {
+      test.push_back(value);
+      og.push_back(value);
+    }
+    ASSERT_TRUE(std::equal(og.begin(), og.end(), test.begin(), test.end()));
+  }
+  test.push_back(test[0]);
+  EXPECT_EQ(test.back(), og[0]);
+}
+
+TEST(small_vector_test, copy_and_move_between_modes) {
+  s21::small_vector<std::string, 3> small({"a", "b"});
+  s21::small_vector<std::string, 3> big({"1", "2", "3", "4", "5"});
+  EXPECT_TRUE(small.is_inline());
+  EXPECT_FALSE(big.is_inline());
+
+  s21::small_vector<std::string, 3> copy(big);
+  EXPECT_EQ(copy.size(), 5U);
+  EXPECT_EQ(copy[4], "5");
+  copy = small;
+  EXPECT_EQ(copy.size(), 2U);
+  EXPECT_EQ(copy[1], "b");
+
+  const std::string *heap = big.data();
+  s21::small_vector<std::string, 3> moved_big(std::move(big));
+  EXPECT_EQ(moved_big.data(), heap);
+  EXPECT_TRUE(big.empty());
+  EXPECT_TRUE(big.is_inline());
+  s21::small_vector<std::string, 3> moved_small(std::move(small));
+  EXPECT_TRUE(moved_small.is_inline());
+  EXPECT_EQ(moved_small[0], "a");
+  EXPECT_TRUE(small.empty());
+
+  moved_small.swap(moved_big);
+  EXPECT_EQ(moved_small.size(), 5U);
+  EXPECT_EQ(moved_small.data(), heap);
+  EXPECT_EQ(moved_big.size(), 2U);
+  EXPECT_TRUE(moved_big.is_inline());
+  moved_big = std::move(moved_small);
+  EXPECT_EQ(moved_big.size(), 5U);
+  EXPECT_EQ(moved_big[2], "3");
+}
+
+TEST(small_vector_test, emplace) {
+  s21::small_vector<int, 2> test({1, 4});
+  auto it = test.emplace(test.begin() + 1, 2, 3);
+  EXPECT_EQ(*it, 4);
+  test.emplace_back(5, 6);
+  s21::small_vector<int, 2> og({1, 2, 3, 4, 5, 6});
+  EXPECT_TRUE(std::equal(og.begin(), og.end(), test.begin(), test.end()));
+}
+
+TEST(small_vector_test_THROW, at) {
+  s21::small_vector<int, 2> test({1});
+  EXPECT_THROW(test.at(1), std::out_of_range);
+  EXPECT_THROW(test.reserve(test.max_size() + 1), std::length_error);
+}
+
+// Small vector end
+
+// Stable vector start
+
+TEST(stable_vector_test, addresses_survive_growth) {
+  s21::stable_vector<int, 16> test;
+  s21::vector<const int *> addresses;
+  for (int i = 0; i < 1000; ++i) {
+    test.push_back(i);
+    addresses.push_back(&test.back());
+  }
+  EXPECT_EQ(test.size(), 1000U);
+  EXPECT_EQ(test.capacity(), 1008U);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(addresses[i], &test[i]);
+    EXPECT_EQ(*addresses[i], i);
+  }
+}
+
+TEST(stable_vector_test, matches_std_vector) {
+  s21::stable_vector<std::string, 8> test;
+  std::vector<std::string> og;
+  for (int i = 0; i < 100; ++i) {
+    std::string value(20, static_cast<char>('a' + i % 26));
+    if (i % 7 == 6) {
+      test.pop_back();
+      og.pop_back();
+    } else {
+      test.push_back(value);
+      og.push_back(value);
+    }
+  }
+  ASSERT_EQ(test.size(), og.size());
+  EXPECT_TRUE(std::equal(og.begin(), og.end(), test.begin(), test.end()));
+  test.emplace_back("x", "y");
+  EXPECT_EQ(test.back(), "y");
+  EXPECT_EQ(test[test.size() - 2], "x");
+  EXPECT_EQ(test.front(), og.front());
+}
+
+TEST(stable_vector_test, iterators_sort) {
+  s21::stable_vector<int, 4> test;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 77; ++i) test.push_back(static_cast<int>(gen() % 50));
+  std::sort(test.begin(), test.end());
+  EXPECT_TRUE(std::is_sorted(test.begin(), test.end()));
+  const s21::stable_vector<int, 4> &ref = test;
+  s21::stable_vector<int, 4>::const_iterator it = test.begin();
+  EXPECT_EQ(ref.end() - it, 77);
+  EXPECT_EQ(it[76], test.back());
+  EXPECT_EQ(*(ref.begin() + 10), test[10]);
+}
+
+TEST(stable_vector_test, copy_move_shrink) {
+  s21::stable_vector<std::string, 4> test({"a", "b", "c", "d", "e", "f"});
+  s21::stable_vector<std::string, 4> copy(test);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), test.begin(), test.end()));
+  const std::string *first = &test[0];
+  s21::stable_vector<std::string, 4> moved(std::move(test));
+  EXPECT_EQ(&moved[0], first);
+  EXPECT_TRUE(test.empty());
+  test = copy;
+  EXPECT_EQ(test.size(), 6U);
+  copy = std::move(moved);
+  EXPECT_EQ(&copy[0], first);
+  copy.reserve(20);
+  EXPECT_EQ(copy.capacity(), 20U);
+  copy.pop_back();
+  copy.pop_back();
+  copy.pop_back();
+  copy.shrink_to_fit();
+  EXPECT_EQ(copy.capacity(), 4U);
+  EXPECT_EQ(&copy[0], first);
+  EXPECT_EQ(copy.back(), "c");
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(stable_vector_test, at_THROW) {
+  s21::stable_vector<int> test(3);
+  EXPECT_EQ(test.at(2), 0);
+  EXPECT_THROW(test.at(3), std::out_of_range);
+  EXPECT_THROW(test.reserve(test.max_size() + 1), std::length_error);
+}
+
+// Stable vector end
+
+// SoA vector start
+
+TEST(soa_vector_test, columns_are_contiguous) {
+  s21::soa_vector<int, double, std::string> test;
+  for (int i = 0; i < 100; ++i) {
+    test.push_back({i, i * 0.5, std::to_string(i)});
+  }
+  EXPECT_EQ(test.size(), 100U);
+  s21::span<int> ids = test.column<0>();
+  s21::span<double> prices = test.column<1>();
+  ASSERT_EQ(ids.size(), 100U);
+  for (std::size_t i = 1; i < ids.size(); ++i) {
+    EXPECT_EQ(&ids[i], &ids[i - 1] + 1);
+    EXPECT_EQ(&prices[i], &prices[i - 1] + 1);
+  }
+  EXPECT_EQ(&std::get<0>(test[42]), &ids[42]);
+  EXPECT_DOUBLE_EQ(std::accumulate(prices.begin(), prices.end(), 0.0),
+                   2475.0);
+  EXPECT_EQ(std::get<2>(test.at(7)), "7");
+  EXPECT_THROW(test.at(100), std::out_of_range);
+}
+
+TEST(soa_vector_test, proxy_references_write_through) {
+  s21::soa_vector<int, int> test({{1, 10}, {2, 20}, {3, 30}});
+  for (auto [a, b] : test) b += a;
+  std::get<0>(test[0]) = 7;
+  EXPECT_EQ(test[0], std::make_tuple(7, 11));
+  EXPECT_EQ(test.back(), std::make_tuple(3, 33));
+  auto it = test.begin() + 1;
+  EXPECT_EQ(std::get<1>(*it), 22);
+  EXPECT_EQ(test.end() - it, 2);
+  const s21::soa_vector<int, int> &ref = test;
+  int sum = 0;
+  for (auto [a, b] : ref) sum += a + b;
+  EXPECT_EQ(sum, 7 + 11 + 2 + 22 + 3 + 33);
+  s21::span<const int> column = ref.column<1>();
+  EXPECT_EQ(column.back(), 33);
+}
+
+TEST(soa_vector_test, copy_move_swap) {
+  s21::soa_vector<std::string, long> test;
+  test.emplace_back(std::make_tuple(std::string("a"), 1L),
+                    std::make_tuple(std::string("b"), 2L));
+  s21::soa_vector<std::string, long> copy(test);
+  EXPECT_TRUE(std::equal(test.begin(), test.end(), copy.begin()));
+  s21::soa_vector<std::string, long> other;
+  other.push_back({"z", 26L});
+  other.swap(copy);
+  EXPECT_EQ(copy.size(), 1U);
+  EXPECT_EQ(other.size(), 2U);
+  other = std::move(copy);
+  EXPECT_EQ(other.front(), std::make_tuple(std::string("z"), 26L));
+  test = other;
+  EXPECT_EQ(test.size(), 1U);
+  test.pop_back();
+  EXPECT_TRUE(test.empty());
+  test.reserve(10);
+  EXPECT_GE(test.capacity(), 10U);
+  other.clear();
+  EXPECT_TRUE(other.empty());
+}
+
+// SoA vector end
+
+// Dynamic bitset start
+
+TEST(dynamic_bitset_test, matches_vector_bool) {
+  std::mt19937 gen(46);
+  s21::dynamic_bitset test(300);
+  std::vector<bool> og(300);
+  for (int step = 0; step < 200; ++step) {
+    std::size_t pos = gen() % og.size();
+    std::size_t len = gen() % (og.size() - pos + 1);
+    switch (gen() % 4) {
+      case 0:
+        test.set(pos, len, true);
+        for (std::size_t i = pos; i < pos + len; ++i) og[i] = true;
+        break;
+      case 1:
+        test.reset(pos, len);
+        for (std::size_t i = pos; i < pos + len; ++i) og[i] = false;
+        break;
+      case 2:
+        test.flip(pos, len);
+        for (std::size_t i = pos; i < pos + len; ++i) og[i] = !og[i];
+        break;
+      default:
+        test.push_back(step % 2 == 0);
+        og.push_back(step % 2 == 0);
+    }
+    ASSERT_EQ(test.size(), og.size());
+    for (std::size_t i = 0; i < og.size(); ++i) ASSERT_EQ(test[i], og[i]);
+    ASSERT_EQ(test.count(),
+              static_cast<std::size_t>(std::count(og.begin(), og.end(), true)));
+  }
+}
+
+TEST(dynamic_bitset_test, find_first_next) {
+  s21::dynamic_bitset test(1000);
+  EXPECT_EQ(test.find_first(), s21::dynamic_bitset::npos);
+  EXPECT_TRUE(test.none());
+  std::vector<std::size_t> expected = {0, 63, 64, 65, 127, 500, 999};
+  for (std::size_t pos : expected) test.set(pos);
+  std::vector<std::size_t> found;
+  for (std::size_t pos = test.find_first(); pos != s21::dynamic_bitset::npos;
+       pos = test.find_next(pos)) {
+    found.push_back(pos);
+  }
+  EXPECT_EQ(found, expected);
+  EXPECT_EQ(test.find_next(999), s21::dynamic_bitset::npos);
+  test.resize(1500, true);
+  EXPECT_EQ(test.find_next(999), 1000U);
+  EXPECT_EQ(test.count(), expected.size() + 500);
+  test.resize(70);
+  EXPECT_EQ(test.count(), 4U);
+}
+
+TEST(dynamic_bitset_test, bitwise_ops) {
+  s21::dynamic_bitset a(1000), b(1000);
+  for (std::size_t i = 0; i < 1000; i += 2) a.set(i);
+  for (std::size_t i = 0; i < 1000; i += 3) b.set(i);
+  s21::dynamic_bitset both = a & b, either = a | b, one = a ^ b, diff = a - b;
+  for (std::size_t i = 0; i < 1000; ++i) {
+    bool x = i % 2 == 0, y = i % 3 == 0;
+    ASSERT_EQ(both[i], x && y);
+    ASSERT_EQ(either[i], x || y);
+    ASSERT_EQ(one[i], x != y);
+    ASSERT_EQ(diff[i], x && !y);
+  }
+  EXPECT_EQ(both.count(), 167U);
+  EXPECT_EQ(~~a, a);
+  EXPECT_NE(~a, a);
+  EXPECT_EQ((~a).count(), 500U);
+  s21::dynamic_bitset all(130, true);
+  EXPECT_TRUE(all.all());
+  EXPECT_EQ(all.count(), 130U);
+  all.flip();
+  EXPECT_TRUE(all.none());
+  all.set();
+  EXPECT_EQ(all.count(), 130U);
+  all[129] = false;
+  EXPECT_FALSE(all.test(129));
+  EXPECT_FALSE(all.all());
+}
+
+TEST(dynamic_bitset_test, bitwise_THROW) {
+  s21::dynamic_bitset a(10), b(11);
+  EXPECT_THROW(a &= b, std::invalid_argument);
+  EXPECT_THROW(a.test(10), std::out_of_range);
+  EXPECT_THROW(a.set(5, 6, true), std::out_of_range);
+  s21::dynamic_bitset c(std::move(b));
+  EXPECT_TRUE(b.empty());
+  a = c;
+  EXPECT_EQ(a.size(), 11U);
+}
+
+// Dynamic bitset end
+
+// Circular buffer start
+
+TEST(circular_buffer_test, overwrite_keeps_last_n) {
+  s21::circular_buffer<int> test(5);
+  std::deque<int> og;
+  for (int i = 0; i < 23; ++i) {
+    EXPECT_TRUE(test.push_back(i));
+    og.push_back(i);
+    if (og.size() > 5) og.pop_front();
+    ASSERT_EQ(test.size(), og.size());
+    ASSERT_TRUE(std::equal(og.begin(), og.end(), test.begin(), test.end()));
+  }
+  EXPECT_TRUE(test.full());
+  EXPECT_EQ(test.front(), 18);
+  EXPECT_EQ(test.back(), 22);
+  EXPECT_TRUE(test.push_front(100));
+  EXPECT_EQ(test.front(), 100);
+  EXPECT_EQ(test.back(), 21);
+  EXPECT_EQ(test[1], 18);
+  EXPECT_THROW(test.at(5), std::out_of_range);
+}
+
+TEST(circular_buffer_test, reject_policy) {
+  s21::circular_buffer<std::string> test(3, s21::CircularPolicy::kReject);
+  EXPECT_TRUE(test.push_back("a"));
+  EXPECT_TRUE(test.push_front("b"));
+  EXPECT_TRUE(test.push_back("c"));
+  EXPECT_FALSE(test.push_back("d"));
+  EXPECT_FALSE(test.push_front("e"));
+  EXPECT_EQ(test.front(), "b");
+  EXPECT_EQ(test.back(), "c");
+  test.pop_front();
+  EXPECT_TRUE(test.push_back("f"));
+  test.pop_back();
+  EXPECT_EQ(test.back(), "c");
+  test.set_policy(s21::CircularPolicy::kOverwrite);
+  test.push_back("g");
+  EXPECT_TRUE(test.push_back("h"));
+  EXPECT_EQ(test.front(), "c");
+  s21::circular_buffer<int> none(0);
+  EXPECT_FALSE(none.push_back(1));
+  EXPECT_TRUE(none.empty());
+}
+
+TEST(circular_buffer_test, spans_and_linearize) {
+  s21::circular_buffer<int> test(8);
+  for (int i = 0; i < 11; ++i) test.push_back(i);
+  s21::span<int> one = test.array_one(), two = test.array_two();
+  EXPECT_EQ(one.size() + two.size(), 8U);
+  EXPECT_EQ(one.front(), 3);
+  EXPECT_EQ(two.back(), 10);
+  EXPECT_EQ(one.data() + one.size(), two.data() + 8);
+  s21::span<int> all = test.linearize();
+  ASSERT_EQ(all.size(), 8U);
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(all[i], i + 3);
+  EXPECT_TRUE(test.array_two().empty());
+  s21::circular_buffer<std::string> part(6);
+  for (int i = 0; i < 5; ++i) part.push_back(std::to_string(i));
+  part.pop_front();
+  part.pop_front();
+  part.pop_front();
+  part.push_back("5");
+  part.push_back("6");
+  EXPECT_FALSE(part.array_two().empty());
+  s21::span<std::string> linear = part.linearize();
+  std::vector<std::string> expected = {"3", "4", "5", "6"};
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), linear.begin(),
+                         linear.end()));
+  EXPECT_EQ(part.capacity(), 6U);
+}
+
+TEST(circular_buffer_test, copy_and_move) {
+  s21::circular_buffer<std::string> test({"a", "b", "c"});
+  test.push_back("d");
+  s21::circular_buffer<std::string> copy(test);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), test.begin(), test.end()));
+  s21::circular_buffer<std::string> moved(std::move(test));
+  EXPECT_EQ(moved.front(), "b");
+  EXPECT_EQ(test.capacity(), 0U);
+  test = moved;
+  EXPECT_EQ(test.size(), 3U);
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+  copy = std::move(moved);
+  EXPECT_EQ(copy.back(), "d");
+  std::sort(copy.begin(), copy.end(), std::greater<std::string>());
+  EXPECT_EQ(copy.front(), "d");
+}
+
+// Circular buffer end
+
+// Arena start
+
+// считает выданные байты, чтобы проверить размеры в deallocate
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t outstanding_ = 0;
+  std::size_t allocations_ = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    outstanding_ += bytes;
+    ++allocations_;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *ptr, std::size_t bytes,
+                     std::size_t alignment) override {
+    outstanding_ -= bytes;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST(arena_test, bump_reset_reuse) {
+  CountingResource upstream;
+  s21::arena test(1024, &upstream);
+  std::vector<void *> ptrs;
+  for (std::size_t i = 1; i < 200; ++i) {
+    std::size_t align = std::size_t{1} << (i % 7);
+    void *ptr = test.allocate(i, align);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % align, 0U);
+    ptrs.push_back(ptr);
+  }
+  std::sort(ptrs.begin(), ptrs.end());
+  EXPECT_EQ(std::adjacent_find(ptrs.begin(), ptrs.end()), ptrs.end());
+  EXPECT_EQ(test.used(), 199U * 200U / 2U);
+  std::size_t reserved = test.reserved();
+  std::size_t blocks = upstream.allocations_;
+  EXPECT_EQ(upstream.outstanding_, reserved);
+  test.reset();
+  EXPECT_EQ(test.used(), 0U);
+  for (std::size_t i = 1; i < 200; ++i) {
+    EXPECT_NE(test.allocate(i, 8), nullptr);
+  }
+  EXPECT_EQ(upstream.allocations_, blocks);
+  EXPECT_EQ(test.reserved(), reserved);
+  void *big = test.allocate(1 << 20, 64);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % 64, 0U);
+  test.release();
+  EXPECT_EQ(test.reserved(), 0U);
+  EXPECT_EQ(upstream.outstanding_, 0U);
+}
+
+TEST(arena_test, containers_on_resource) {
+  CountingResource resource;
+  {
+    s21::pmr::vector<std::string> vec({"a", "b"}, &resource);
+    s21::pmr::list<std::string> lst(&resource);
+    s21::pmr::map<int, std::string> mp(&resource);
+    s21::pmr::set<int> st(&resource);
+    s21::pmr::multiset<int> ms(&resource);
+    std::vector<std::string> og_vec = {"a", "b"};
+    std::list<std::string> og_lst;
+    std::map<int, std::string> og_mp;
+    std::multiset<int> og_ms;
+    for (int i = 0; i < 300; ++i) {
+      int key = (i * 37) % 101;
+      std::string value(i % 40, 'x');
+      vec.push_back(value);
+      og_vec.push_back(value);
+      lst.push_front(value);
+      og_lst.push_front(value);
+      mp.insert(key, value);
+      og_mp.insert({key, value});
+      st.insert(key);
+      ms.insert(key);
+      og_ms.insert(key);
+      if (i % 3 == 0) {
+        lst.pop_back();
+        og_lst.pop_back();
+        mp.erase(mp.begin());
+        og_mp.erase(og_mp.begin());
+        ms.erase(ms.begin());
+        og_ms.erase(og_ms.begin());
+      }
+    }
+    EXPECT_GT(resource.outstanding_, 0U);
+    ASSERT_EQ(vec.size(), og_vec.size());
+    for (std::size_t i = 0; i < vec.size(); ++i) EXPECT_EQ(vec[i], og_vec[i]);
+    EXPECT_TRUE(std::equal(og_lst.begin(), og_lst.end(), lst.begin()));
+    EXPECT_EQ(lst.size(), og_lst.size());
+    EXPECT_EQ(mp.size(), og_mp.size());
+    for (auto &item : og_mp) EXPECT_EQ(mp.at(item.first), item.second);
+    EXPECT_EQ(st.size(), 101U);
+    EXPECT_TRUE(std::equal(og_ms.begin(), og_ms.end(), ms.begin()));
+    EXPECT_EQ(ms.size(), og_ms.size());
+    vec.clear();
+    lst.clear();
+    mp.clear();
+  }
+  EXPECT_EQ(resource.outstanding_, 0U);
+}
+
+TEST(arena_test, copy_and_move_keep_resource) {
+  s21::arena memory;
+  s21::pmr::list<int> lst({1, 2, 3}, &memory);
+  s21::pmr::list<int> lst_copy(lst);
+  EXPECT_EQ(lst_copy.resource(), &memory);
+  s21::pmr::list<int> other({7}, std::pmr::new_delete_resource());
+  other = std::move(lst_copy);
+  EXPECT_EQ(other.resource(), &memory);
+  EXPECT_EQ(other.size(), 3U);
+  s21::pmr::map<int, int> mp({{1, 10}, {2, 20}}, &memory);
+  s21::pmr::map<int, int> mp_copy(mp);
+  mp_copy[1] = 11;
+  EXPECT_EQ(mp.at(1), 10);
+  EXPECT_EQ(mp_copy.resource(), &memory);
+  s21::pmr::set<int> st(std::move(s21::pmr::set<int>({5, 4}, &memory)));
+  EXPECT_EQ(st.resource(), &memory);
+  EXPECT_TRUE(st.contains(4));
+  s21::pmr::vector<int> vec({1, 2}, &memory);
+  s21::pmr::vector<int> vec_copy(vec);
+  vec_copy.push_back(3);
+  EXPECT_EQ(vec.size(), 2U);
+  EXPECT_EQ(vec_copy.resource(), &memory);
+  s21::pmr::stack<int> stk{s21::pmr::vector<int>(&memory)};
+  for (int i = 0; i < 100; ++i) stk.push(i);
+  EXPECT_EQ(stk.top(), 99);
+  EXPECT_GT(memory.used(), 0U);
+}
+
+TEST(arena_test, skip_destroy) {
+  s21::arena memory(256);
+  for (int round = 0; round < 3; ++round) {
+    {
+      s21::pmr::map<int, double> mp(&memory, s21::pmr::DestroyMode::kSkip);
+      s21::pmr::list<int> lst(&memory, s21::pmr::DestroyMode::kSkip);
+      s21::pmr::vector<int> vec(&memory, s21::pmr::DestroyMode::kSkip);
+      for (int i = 0; i < 1000; ++i) {
+        mp[i] = i * 0.5;
+        lst.push_back(i);
+        vec.push_back(i);
+      }
+      EXPECT_EQ(mp.at(999), 499.5);
+      EXPECT_EQ(lst.back(), 999);
+      EXPECT_EQ(vec[999], 999);
+    }
+    memory.reset();
+  }
+  CountingResource resource;
+  using s21::pmr::DestroyMode;
+  EXPECT_THROW(s21::pmr::list<std::string>(&memory, DestroyMode::kSkip),
+               std::invalid_argument);
+  EXPECT_THROW((s21::pmr::map<int, std::string>(&memory, DestroyMode::kSkip)),
+               std::invalid_argument);
+  EXPECT_THROW(s21::pmr::set<int>(&resource, DestroyMode::kSkip),
+               std::invalid_argument);
+  EXPECT_THROW(s21::pmr::vector<int>(nullptr), std::invalid_argument);
+}
+
+TEST(arena_test, splice_and_merge_need_same_resource) {
+  s21::arena first;
+  s21::arena second;
+  s21::pmr::list<int> lst({1, 3, 5}, &first);
+  s21::pmr::list<int> other({2, 4}, &second);
+  EXPECT_THROW(lst.splice(lst.begin(), other), std::invalid_argument);
+  EXPECT_THROW(lst.merge(other), std::invalid_argument);
+  EXPECT_EQ(lst.size(), 3U);
+  EXPECT_EQ(other.size(), 2U);
+  EXPECT_EQ(other.front(), 2);
+  s21::pmr::list<int> same({2, 4}, &first);
+  lst.merge(same);
+  EXPECT_EQ(lst.size(), 5U);
+  EXPECT_TRUE(same.empty());
+  s21::pmr::list<int> tail({6}, &first);
+  lst.splice(lst.end(), tail);
+  EXPECT_EQ(lst.back(), 6);
+  int expected = 1;
+  for (int item : lst) EXPECT_EQ(item, expected++);
+}
+
+// ресурс хранится только в pmr-контейнерах; обычным он не стоит ни байта
+TEST(arena_test, heap_containers_carry_no_source) {
+  EXPECT_EQ(sizeof(s21::vector<int>), 3 * sizeof(void *));
+  EXPECT_EQ(sizeof(s21::stack<int>), 3 * sizeof(void *));
+  EXPECT_EQ(sizeof(s21::list<int>), 2 * sizeof(void *));
+  EXPECT_EQ(sizeof(s21::map<int, int>), 2 * sizeof(void *));
+  EXPECT_EQ(sizeof(s21::set<int>), 2 * sizeof(void *));
+  EXPECT_EQ(sizeof(s21::multiset<int>), 2 * sizeof(void *));
+  EXPECT_EQ(sizeof(s21::pmr::vector<int>), 4 * sizeof(void *));
+  EXPECT_EQ(sizeof(s21::pmr::map<int, int>), 3 * sizeof(void *));
+}
+
+// Arena end
+
+// Instrument start
+
+// make test_instrument собирает тесты с -DS21_INSTRUMENT; в обычной сборке
+// те же операции не должны дойти до приёмника
+TEST(instrument_test, counters_reach_sink) {
+  using s21::Counter;
+  using s21::Tracked;
+  s21::CountingSink sink;
+  s21::instrument::set_sink(&sink);
+  {
+    s21::map<int, int> mp;
+    for (int i = 0; i < 100; ++i) mp.insert(i, i);
+    EXPECT_TRUE(mp.contains(50));
+    for (int i = 0; i < 50; ++i) mp.erase(mp.find(i));
+    s21::vector<int> vec;
+    for (int i = 0; i < 100; ++i) vec.push_back(i);
+    s21::list<int> lst;
+    for (int i = 0; i < 10; ++i) lst.push_back(i);
+    s21::queue<int> q;
+    for (int i = 0; i < 100; ++i) q.push(i);
+    s21::set<int> st({1, 2, 3});
+  }
+  s21::instrument::set_sink(nullptr);
+#ifdef S21_INSTRUMENT
+  EXPECT_EQ(sink.get(Tracked::kMap, Counter::kAllocations), 100U);
+  EXPECT_EQ(sink.get(Tracked::kMap, Counter::kFrees), 100U);
+  EXPECT_EQ(sink.get(Tracked::kMap, Counter::kBytesAllocated),
+            100U * sizeof(s21::RBTreeNode<int, int>));
+  EXPECT_GT(sink.get(Tracked::kMap, Counter::kRotations), 0U);
+  EXPECT_EQ(sink.get(Tracked::kMap, Counter::kDeleteCaseOne), 50U);
+  std::size_t lookups = sink.get(Tracked::kMap, Counter::kLookups);
+  std::size_t visits = sink.get(Tracked::kMap, Counter::kNodeVisits);
+  EXPECT_GT(lookups, 200U);
+  EXPECT_GT(visits, lookups);
+  EXPECT_GE(sink.get(Tracked::kMap, Counter::kComparisons), visits);
+  // ёмкость 1, 2, 4, ..., 128
+  EXPECT_EQ(sink.get(Tracked::kVector, Counter::kAllocations), 8U);
+  EXPECT_EQ(sink.get(Tracked::kVector, Counter::kReallocations), 7U);
+  EXPECT_EQ(sink.get(Tracked::kVector, Counter::kRelocatedBytes),
+            127U * sizeof(int));
+  EXPECT_EQ(sink.get(Tracked::kVector, Counter::kFrees), 8U);
+  // узлы и фиктивный узел
+  EXPECT_EQ(sink.get(Tracked::kList, Counter::kAllocations), 11U);
+  EXPECT_EQ(sink.get(Tracked::kList, Counter::kFrees), 11U);
+  std::size_t queue_blocks = sink.get(Tracked::kQueue, Counter::kAllocations);
+  EXPECT_GT(queue_blocks, 1U);
+  EXPECT_EQ(sink.get(Tracked::kQueue, Counter::kReallocations),
+            queue_blocks - 1);
+  EXPECT_EQ(sink.get(Tracked::kQueue, Counter::kFrees), queue_blocks);
+  EXPECT_EQ(sink.get(Tracked::kSet, Counter::kAllocations), 3U);
+  EXPECT_EQ(sink.get(Tracked::kMultiset, Counter::kAllocations), 0U);
+  sink.reset();
+  EXPECT_EQ(sink.get(Tracked::kMap, Counter::kAllocations), 0U);
+#else
+  for (int c = 0; c < static_cast<int>(Tracked::kCount); ++c) {
+    for (int k = 0; k < static_cast<int>(Counter::kCount); ++k) {
+      EXPECT_EQ(sink.get(Tracked(c), Counter(k)), 0U);
+    }
+  }
+#endif
+}
+
+// Instrument end
+
+// Memory report start
+
+namespace {
+template <typename C>
+std::size_t report_sum(const C &c) {
+  s21::MemoryReport r = c.memory_report();
+  return r.payload + r.pointers + r.control + r.padding + r.slack +
+         r.headers + r.object;
+}
+}  // namespace
+
+TEST(memory_report_test, vector_slack_and_total) {
+  s21::vector<int> vec;
+  EXPECT_EQ(vec.memory_usage(), sizeof(vec));
+  for (int i = 0; i < 5; ++i) vec.push_back(i);
+  s21::MemoryReport r = vec.memory_report();
+  EXPECT_EQ(r.payload, 5 * sizeof(int));
+  EXPECT_EQ(r.slack, (vec.capacity() - 5) * sizeof(int));
+  EXPECT_EQ(r.pointers, 0U);
+  EXPECT_EQ(r.object, sizeof(vec));
+  EXPECT_EQ(vec.memory_usage(), report_sum(vec));
+  vec.shrink_to_fit();
+  EXPECT_EQ(vec.memory_report().slack, 0U);
+}
+
+// узел map: ключ, значение, три указателя и цвет - padding дополняет до
+// sizeof узла; у set вторая копия ключа в узле - slack
+TEST(memory_report_test, tree_nodes) {
+  s21::map<int, int> mp;
+  s21::set<int> st;
+  for (int i = 0; i < 100; ++i) {
+    mp.insert(i, i);
+    st.insert(i);
+  }
+  s21::MemoryReport r = mp.memory_report();
+  EXPECT_EQ(r.payload, 100 * 2 * sizeof(int));
+  EXPECT_EQ(r.pointers, 100 * 3 * sizeof(void *));
+  EXPECT_GT(r.control, 0U);
+  EXPECT_EQ(r.payload + r.pointers + r.control + r.padding,
+            100 * sizeof(s21::RBTreeNode<int, int>));
+  EXPECT_EQ(mp.memory_usage(), report_sum(mp));
+  s21::MemoryReport rs = st.memory_report();
+  EXPECT_EQ(rs.payload, 100 * sizeof(int));
+  EXPECT_EQ(rs.slack, 100 * sizeof(int));
+  mp.clear();
+  EXPECT_EQ(mp.memory_usage(), sizeof(mp));
+}
+
+// то, ради чего отчёт: на тех же данных плоские и хэш-структуры меньше
+TEST(memory_report_test, compare_layouts) {
+  s21::map<int, int> mp;
+  s21::flat_map<int, int> flat;
+  s21::unordered_map<int, int> hash;
+  s21::btree_map<int, int> btree;
+  s21::list<int> lst;
+  s21::deque<int> dq;
+  for (int i = 0; i < 1000; ++i) {
+    mp.insert(i, i);
+    flat.insert({i, i});
+    hash.insert({i, i});
+    btree.insert({i, i});
+    lst.push_back(i);
+    dq.push_back(i);
+  }
+  EXPECT_LT(flat.memory_usage(), hash.memory_usage());
+  EXPECT_LT(hash.memory_usage(), mp.memory_usage());
+  EXPECT_LT(btree.memory_usage(), mp.memory_usage());
+  EXPECT_LT(dq.memory_usage(), lst.memory_usage());
+  EXPECT_EQ(flat.memory_report().payload, mp.memory_report().payload);
+  EXPECT_EQ(hash.memory_report().payload, mp.memory_report().payload);
+  EXPECT_EQ(btree.memory_report().payload, mp.memory_report().payload);
+  EXPECT_EQ(flat.memory_usage(), report_sum(flat));
+  EXPECT_EQ(hash.memory_usage(), report_sum(hash));
+  EXPECT_EQ(btree.memory_usage(), report_sum(btree));
+  EXPECT_EQ(lst.memory_usage(), report_sum(lst));
+  EXPECT_EQ(dq.memory_usage(), report_sum(dq));
+}
+
+// у памяти из pmr-ресурса заголовков распределителя нет
+TEST(memory_report_test, pmr_without_headers) {
+  s21::arena arena;
+  s21::pmr::map<int, int> mp(&arena);
+  s21::map<int, int> heap;
+  for (int i = 0; i < 100; ++i) {
+    mp.insert(i, i);
+    heap.insert(i, i);
+  }
+  EXPECT_EQ(mp.memory_report().headers, 0U);
+  EXPECT_EQ(mp.memory_report().payload, heap.memory_report().payload);
+  EXPECT_LE(mp.memory_usage(), heap.memory_usage());
+}
+
+TEST(memory_report_test, heap_overhead) {
+#if defined(__GLIBC__) && SIZE_MAX == UINT64_MAX
+  // блоки glibc: 8 байт размера, кратность 16, минимум 32
+  EXPECT_EQ(s21::memory::heap_overhead(1), 31U);
+  EXPECT_EQ(s21::memory::heap_overhead(24), 8U);
+  EXPECT_EQ(s21::memory::heap_overhead(25), 23U);
+  EXPECT_EQ(s21::memory::heap_overhead(40), 8U);
+#else
+  EXPECT_EQ(s21::memory::heap_overhead(40), 0U);
+#endif
+  EXPECT_EQ(s21::memory::array_cookie<int>(), 0U);
+  EXPECT_EQ(s21::memory::array_cookie<std::string>(), sizeof(std::size_t));
+}
+
+TEST(memory_report_test, other_containers) {
+  s21::small_vector<int, 4> small;
+  for (int i = 0; i < 4; ++i) small.push_back(i);
+  EXPECT_EQ(small.memory_report().headers, 0U);
+  EXPECT_EQ(small.memory_usage(), sizeof(small));
+  small.push_back(4);
+  EXPECT_EQ(small.memory_report().slack,
+            (small.capacity() - 5 + 4) * sizeof(int));
+  s21::circular_buffer<int> ring(8);
+  ring.push_back(1);
+  EXPECT_EQ(ring.memory_report().slack, 7 * sizeof(int));
+  s21::persistent_map<int, int> pm;
+  for (int i = 0; i < 10; ++i) pm.insert(i, i);
+  EXPECT_EQ(pm.memory_report().payload, 10 * 2 * sizeof(int));
+  s21::concurrent_map<int, int> cm;
+  for (int i = 0; i < 10; ++i) cm.insert(i, i);
+  EXPECT_EQ(cm.memory_report().payload, 10 * 2 * sizeof(int));
+  EXPECT_GE(cm.memory_report().pointers, 10 * sizeof(s21::SkipLink));
+  s21::stack<int> stk;
+  stk.push(1);
+  EXPECT_EQ(stk.memory_report().payload, sizeof(int));
+  EXPECT_EQ(stk.memory_usage(), report_sum(stk));
+  s21::array<int, 4> arr;
+  EXPECT_EQ(arr.memory_usage(), sizeof(arr));
+}
+
+// Memory report end
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();